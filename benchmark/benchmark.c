@@ -0,0 +1,1119 @@
+/*
+benchmark.c - throughput benchmark and correctness sweep for muUtility
+
+Usage:
+	benchmark [--check] [--quick] [--time-ms N] [--filter NAME]
+
+Without --check, measures the throughput of every byte accessor (single-value
+and array), of memcpy/bswap baselines, and of the bulk primitives (varints,
+checksums, hashing, f16/bf16 conversion, records) over aligned and unaligned
+data, for buffer sizes meant to fit in L1, L2, L3, and DRAM. Results are printed
+as CSV on stdout:
+
+	kind,name,offset,size,ns,gbps
+
+where 'ns' is the best time of one pass over the buffer and 'gbps' is the
+amount of bytes on the byte-data side processed per nanosecond.
+
+With --check, runs a correctness sweep of the same functions against simple
+reference implementations instead (repeated with each SIMD level disabled in
+turn), printing failures on stderr and exiting with 1 if any occurred.
+
+--quick only uses the L1 and L2 sizes and a shorter minimum time per case,
+--time-ms sets the minimum time spent per case (10 by default), and --filter
+only runs cases whose name contains the given string.
+*/
+
+#define _DEFAULT_SOURCE
+#include <stddef.h>
+
+/* The header allocates through a deliberately unfriendly allocator, whose memory
+is only 8-byte aligned and guarded past its end, so that the checks catch code
+relying on malloc's alignment or writing past what it asked for. */
+
+static void* skew_alloc(size_t size);
+static inline void* skew_realloc(void* p, size_t size);
+static void skew_free(void* p);
+
+#define MU_ALLOC(size) skew_alloc(size)
+#define MU_REALLOC(p, size) skew_realloc(p, size)
+#define MU_FREE(p) skew_free(p)
+
+#include "../muUtility.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static size_t skew_overruns = 0;
+
+// Before the returned pointer are the malloc'd pointer and the size; after it
+// are 32 guard bytes
+static void* skew_alloc(size_t size) {
+	muByte* base = (muByte*)malloc(size + 64);
+	if (!base) {
+		return 0;
+	}
+	muByte* p = (muByte*)((((size_t)base + 39) & ~(size_t)15) - 8);
+	((void**)p)[-2] = base;
+	((size_t*)p)[-1] = size;
+	memset(&p[size], 0xA5, 32);
+	return p;
+}
+
+static void skew_free(void* p) {
+	if (p) {
+		muByte* b = (muByte*)p;
+		size_t size = ((size_t*)p)[-1];
+		for (size_t i = 0; i < 32; ++i) {
+			skew_overruns += (b[size + i] != 0xA5);
+		}
+		free(((void**)p)[-2]);
+	}
+}
+
+// Inline since only some of the header's optional parts reallocate
+static inline void* skew_realloc(void* p, size_t size) {
+	void* n = skew_alloc(size);
+	if (n && p) {
+		size_t old = ((size_t*)p)[-1];
+		memcpy(n, p, (old < size) ? old : size);
+		skew_free(p);
+	}
+	return n;
+}
+
+/* Benchmark state */
+
+static volatile uint64_m sink;
+static uint64_m min_ns = 10000000;
+static const char* filter = 0;
+
+/* Portable byte swaps for the baselines */
+
+static uint16_m swap16(uint16_m n) {
+	return (uint16_m)((n << 8) | (n >> 8));
+}
+
+static uint32_m swap32(uint32_m n) {
+	return ((n & 0xFF) << 24) | ((n & 0xFF00) << 8) | ((n >> 8) & 0xFF00) | (n >> 24);
+}
+
+static uint64_m swap64(uint64_m n) {
+	return ((uint64_m)swap32((uint32_m)n) << 32) | swap32((uint32_m)(n >> 32));
+}
+
+/* Accessor table
+
+Every accessor is listed once as (suffix, type, size, big-endian, signed), and
+expanded into wrappers with uniform signatures for the checks and benchmarks. */
+
+#define ACCESSORS(X) \
+	X(leu8,  uint8_m,  1, 0, 0) X(les8,  int8_m,  1, 0, 1) X(beu8,  uint8_m,  1, 1, 0) X(bes8,  int8_m,  1, 1, 1) \
+	X(leu16, uint16_m, 2, 0, 0) X(les16, int16_m, 2, 0, 1) X(beu16, uint16_m, 2, 1, 0) X(bes16, int16_m, 2, 1, 1) \
+	X(leu24, uint32_m, 3, 0, 0) X(les24, int32_m, 3, 0, 1) X(beu24, uint32_m, 3, 1, 0) X(bes24, int32_m, 3, 1, 1) \
+	X(leu32, uint32_m, 4, 0, 0) X(les32, int32_m, 4, 0, 1) X(beu32, uint32_m, 4, 1, 0) X(bes32, int32_m, 4, 1, 1) \
+	X(leu64, uint64_m, 8, 0, 0) X(les64, int64_m, 8, 0, 1) X(beu64, uint64_m, 8, 1, 0) X(bes64, int64_m, 8, 1, 1)
+
+typedef uint64_m (*read_func)(muByte* b);
+typedef void (*write_func)(muByte* b, uint64_m n);
+typedef void (*array_func)(muByte* b, void* n, size_m len);
+typedef void (*bench_func)(muByte* b, muByte* d, size_m bytes);
+
+#define WRAPPERS(s, T, size, be, sign) \
+	static uint64_m read_##s(muByte* b) { return (uint64_m)(int64_m)muu_r##s(b); } \
+	static void write_##s(muByte* b, uint64_m n) { muu_w##s(b, (T)n); } \
+	static void read_array_##s(muByte* b, void* n, size_m len) { muu_r##s##_array(b, (T*)n, len); } \
+	static void write_array_##s(muByte* b, void* n, size_m len) { muu_w##s##_array(b, (T*)n, len); } \
+	static void bench_read_##s(muByte* b, muByte* d, size_m bytes) { \
+		uint64_m acc = 0; \
+		(void)d; \
+		for (size_m i = 0; i + size <= bytes; i += size) { \
+			acc += (uint64_m)muu_r##s(&b[i]); \
+		} \
+		sink += acc; \
+	} \
+	static void bench_write_##s(muByte* b, muByte* d, size_m bytes) { \
+		(void)d; \
+		for (size_m i = 0; i + size <= bytes; i += size) { \
+			muu_w##s(&b[i], (T)i); \
+		} \
+	} \
+	static void bench_read_array_##s(muByte* b, muByte* d, size_m bytes) { muu_r##s##_array(b, (T*)d, bytes / size); } \
+	static void bench_write_array_##s(muByte* b, muByte* d, size_m bytes) { muu_w##s##_array(b, (T*)d, bytes / size); }
+
+ACCESSORS(WRAPPERS)
+
+struct accessor {
+	const char* name;
+	size_m size;
+	size_m elem;
+	int be;
+	int sign;
+	read_func read;
+	write_func write;
+	array_func read_array;
+	array_func write_array;
+	bench_func bench_read;
+	bench_func bench_write;
+	bench_func bench_read_array;
+	bench_func bench_write_array;
+};
+
+#define ENTRY(s, T, size, be, sign) { #s, size, sizeof(T), be, sign, read_##s, write_##s, read_array_##s, write_array_##s, bench_read_##s, bench_write_##s, bench_read_array_##s, bench_write_array_##s },
+
+static const struct accessor accessors[] = { ACCESSORS(ENTRY) };
+#define ACCESSOR_COUNT (sizeof(accessors) / sizeof(accessors[0]))
+
+/* Reference implementations */
+
+static uint64_m ref_read(muByte* b, size_m size, int be, int sign) {
+	uint64_m n = 0;
+	for (size_m i = 0; i < size; ++i) {
+		n |= (uint64_m)b[be ? size - 1 - i : i] << (i * 8);
+	}
+	if (sign && size < 8 && (n >> (size * 8 - 1)) & 1) {
+		n |= ~(uint64_m)0 << (size * 8);
+	}
+	return n;
+}
+
+static void ref_write(muByte* b, size_m size, int be, uint64_m n) {
+	for (size_m i = 0; i < size; ++i) {
+		b[be ? size - 1 - i : i] = (muByte)(n >> (i * 8));
+	}
+}
+
+static uint32_m ref_crc32(uint32_m crc, muByte* b, size_m len) {
+	crc = ~crc;
+	while (len--) {
+		crc ^= *b++;
+		for (int k = 0; k < 8; ++k) {
+			crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+		}
+	}
+	return ~crc;
+}
+
+static uint32_m ref_adler32(uint32_m adler, muByte* b, size_m len) {
+	uint32_m s1 = adler & 0xFFFF, s2 = adler >> 16;
+	while (len--) {
+		s1 = (s1 + *b++) % 65521;
+		s2 = (s2 + s1) % 65521;
+	}
+	return (s2 << 16) | s1;
+}
+
+static uint64_m fnv1a(muByte* b, size_m len) {
+	uint64_m h = 0xCBF29CE484222325ull;
+	while (len--) {
+		h ^= *b++;
+		h *= 0x100000001B3ull;
+	}
+	return h;
+}
+
+/* Random numbers (xorshift64*) */
+
+static uint64_m rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint64_m rng(void) {
+	rng_state ^= rng_state >> 12;
+	rng_state ^= rng_state << 25;
+	rng_state ^= rng_state >> 27;
+	return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static void fill(muByte* b, size_m len) {
+	for (size_m i = 0; i < len; ++i) {
+		b[i] = (muByte)rng();
+	}
+}
+
+/* Correctness sweep */
+
+static size_m failures = 0;
+
+#define CHECK(cond, ...) do { \
+	if (!(cond)) { \
+		if (failures < 50) { \
+			fprintf(stderr, "FAIL %s:%d: ", __FILE__, __LINE__); \
+			fprintf(stderr, __VA_ARGS__); \
+			fprintf(stderr, "\n"); \
+		} \
+		failures++; \
+	} \
+} while (0)
+
+static void check_accessors(void) {
+	muByte buf[1024], ref[1024];
+	uint64_m vals[128];
+
+	for (size_m a = 0; a < ACCESSOR_COUNT; ++a) {
+		const struct accessor* x = &accessors[a];
+
+		// Single values at every alignment
+		for (size_m off = 0; off < 8; ++off) {
+			for (int i = 0; i < 256; ++i) {
+				fill(buf, 32);
+				CHECK(x->read(&buf[off]) == ref_read(&buf[off], x->size, x->be, x->sign), "read %s off %zu", x->name, off);
+
+				uint64_m v = rng() >> (rng() % 64);
+				mu_memset(buf, 0xAA, 32);
+				mu_memset(ref, 0xAA, 32);
+				x->write(&buf[off], v);
+				ref_write(&ref[off], x->size, x->be, v);
+				CHECK(!memcmp(buf, ref, 32), "write %s off %zu", x->name, off);
+			}
+		}
+
+		// Arrays against the single-value functions
+		for (size_m off = 0; off < 4; ++off) {
+			for (size_m len = 0; len < 100; ++len) {
+				fill(buf, sizeof(buf));
+				mu_memset(vals, 0, sizeof(vals));
+				x->read_array(&buf[off], vals, len);
+				for (size_m i = 0; i < len; ++i) {
+					uint64_m v = 0;
+					mu_memcpy(&v, (muByte*)vals + i * x->elem, x->elem);
+					uint64_m r = ref_read(&buf[off + i * x->size], x->size, x->be, x->sign);
+					uint64_m mask = (x->elem == 8) ? ~(uint64_m)0 : (((uint64_m)1 << (x->elem * 8)) - 1);
+					#ifdef MU_BIG_ENDIAN
+						v >>= 64 - x->elem * 8;
+					#endif
+					CHECK((v & mask) == (r & mask), "read array %s off %zu len %zu index %zu", x->name, off, len, i);
+				}
+
+				mu_memset(buf, 0xAA, sizeof(buf));
+				mu_memset(ref, 0xAA, sizeof(ref));
+				x->write_array(&buf[off], vals, len);
+				for (size_m i = 0; i < len; ++i) {
+					x->write(&ref[off + i * x->size], x->read(&buf[off + i * x->size]));
+				}
+				CHECK(!memcmp(buf, ref, sizeof(buf)), "write array %s off %zu len %zu", x->name, off, len);
+
+				// Reading in place, except for 24-bit arrays, whose sizes differ
+				if (x->size == x->elem) {
+					fill(buf, sizeof(buf));
+					mu_memcpy(ref, buf, sizeof(buf));
+					x->read_array(buf, buf, len);
+					for (size_m i = 0; i < len; ++i) {
+						uint64_m v = 0;
+						mu_memcpy(&v, &buf[i * x->elem], x->elem);
+						#ifdef MU_BIG_ENDIAN
+							v >>= 64 - x->elem * 8;
+						#endif
+						uint64_m mask = (x->elem == 8) ? ~(uint64_m)0 : (((uint64_m)1 << (x->elem * 8)) - 1);
+						CHECK((v & mask) == (ref_read(&ref[i * x->size], x->size, x->be, x->sign) & mask), "in-place array %s len %zu", x->name, len);
+					}
+				}
+			}
+		}
+	}
+}
+
+static void check_varints(void) {
+	muByte buf[MU_SVB_MAX_SIZE(200)];
+	for (int i = 0; i < 100000; ++i) {
+		uint64_m u = rng() >> (rng() % 64);
+		int64_m s = (int64_m)u * ((i & 1) ? -1 : 1);
+		uint64_m ru = 0;
+		int64_m rs = 0;
+		size_m n = muu_wleb128u(buf, u);
+		CHECK(muu_rleb128u(buf, n, &ru) == n && ru == u, "leb128u %llu", (unsigned long long)u);
+		n = muu_wleb128s(buf, s);
+		CHECK(muu_rleb128s(buf, n, &rs) == n && rs == s, "leb128s %lld", (long long)s);
+		CHECK(muu_zigzag_decode(muu_zigzag_encode(s)) == s, "zigzag %lld", (long long)s);
+	}
+
+	// A 10th byte can only hold bit 63 (and, for signed integers, copies of it)
+	muByte over[MU_LEB128_MAX];
+	uint64_m ou = 0;
+	int64_m os = 0;
+	mu_memset(over, 0xFF, sizeof(over));
+	for (int last = 0; last < 0x80; ++last) {
+		over[MU_LEB128_MAX - 1] = (muByte)last;
+		CHECK((muu_rleb128u(over, sizeof(over), &ou) != 0) == (last <= 1), "leb128u 10th byte %d", last);
+		CHECK((muu_rleb128s(over, sizeof(over), &os) != 0) == (last == 0 || last == 0x7F), "leb128s 10th byte %d", last);
+	}
+
+	uint32_m in[200], out[200];
+	for (size_m len = 0; len < 200; ++len) {
+		for (size_m i = 0; i < len; ++i) {
+			in[i] = (uint32_m)(rng() >> (rng() % 64));
+		}
+		size_m n = muu_svb_encode_u32(buf, in, len);
+		mu_memset(out, 0, sizeof(out));
+		CHECK(muu_svb_decode_u32(buf, n, out, len) == n && !memcmp(in, out, len * 4), "svb len %zu", len);
+	}
+}
+
+static void check_checksums(void) {
+	static muByte buf[20000];
+	fill(buf, sizeof(buf));
+	CHECK(muu_crc32(MU_CRC32_INIT, (muByte*)"123456789", 9) == 0xCBF43926, "crc32 check value");
+	CHECK(muu_adler32(MU_ADLER32_INIT, (muByte*)"Wikipedia", 9) == 0x11E60398, "adler32 check value");
+	for (size_m len = 0; len < 600; len += 1 + len / 16) {
+		for (size_m off = 0; off < 4; ++off) {
+			CHECK(muu_crc32(MU_CRC32_INIT, &buf[off], len) == ref_crc32(0, &buf[off], len), "crc32 len %zu off %zu", len, off);
+			CHECK(muu_adler32(MU_ADLER32_INIT, &buf[off], len) == ref_adler32(1, &buf[off], len), "adler32 len %zu off %zu", len, off);
+		}
+	}
+	size_m split = 1234;
+	uint32_m crc = muu_crc32(muu_crc32(MU_CRC32_INIT, buf, split), &buf[split], sizeof(buf) - split);
+	CHECK(crc == ref_crc32(0, buf, sizeof(buf)), "crc32 incremental");
+	uint32_m adler = muu_adler32(muu_adler32(MU_ADLER32_INIT, buf, split), &buf[split], sizeof(buf) - split);
+	CHECK(adler == ref_adler32(1, buf, sizeof(buf)), "adler32 incremental");
+}
+
+static void check_hash(void) {
+	muByte buf[400];
+	fill(buf, sizeof(buf));
+	for (size_m len = 0; len < 300; ++len) {
+		uint64_m h = muu_hash64(buf, len, len);
+		for (size_m step = 1; step < 64; step += 13) {
+			muHasher s;
+			muu_hasher_init(&s, len);
+			for (size_m i = 0; i < len; i += step) {
+				muu_hasher_update(&s, &buf[i], (len - i < step) ? len - i : step);
+			}
+			CHECK(muu_hasher_digest(&s) == h, "hasher len %zu step %zu", len, step);
+		}
+	}
+	for (int i = 0; i < 1000; ++i) {
+		uint64_m v = rng();
+		MU_WLEU64(buf, v);
+		CHECK(muu_hash64_u64(v, 5) == muu_hash64(buf, 8, 5), "hash64_u64");
+		CHECK(muu_hash64_u32((uint32_m)v, 5) == muu_hash64(buf, 4, 5), "hash64_u32");
+	}
+}
+
+// Scales, clamps, and rounds half to even like the 24-bit sample writers
+static int32_m ref_s24(float f) {
+	double v = (double)f * 8388608.0;
+	if (v != v) {
+		return 0;
+	}
+	if (v < -8388608.0) {
+		return -8388608;
+	}
+	if (v > 8388607.0) {
+		return 8388607;
+	}
+	int64_m t = (int64_m)v;
+	double frac = v - (double)t;
+	if (frac > 0.5 || (frac == 0.5 && (t & 1))) {
+		t++;
+	} else if (frac < -0.5 || (frac == -0.5 && (t & 1))) {
+		t--;
+	}
+	return (int32_m)t;
+}
+
+static void check_sample_rounding(void) {
+	// Ties and their neighbouring floats, which every path must round the same way
+	float vals[300];
+	size_m count = 0;
+	for (int k = -40; k < 40; ++k) {
+		float tie = ((float)k + 0.5f) / 8388608.f;
+		uint32_m u;
+		mu_memcpy(&u, &tie, 4);
+		for (int d = -1; d <= 1; ++d) {
+			uint32_m v = u + (uint32_m)d;
+			mu_memcpy(&vals[count++], &v, 4);
+		}
+	}
+	vals[count++] = 0.49999997f / 8388608.f;
+	vals[count++] = -0.49999997f / 8388608.f;
+	vals[count++] = 8388606.5f / 8388608.f;
+	vals[count++] = -8388607.5f / 8388608.f;
+
+	muByte buf[300 * 3];
+	for (size_m len = 1; len <= count; len += (len < 40) ? 1 : 37) {
+		for (size_m start = 0; start + len <= count; start += (len < 8) ? 1 : len) {
+			muu_wles24_f32_array(buf, &vals[start], len);
+			for (size_m i = 0; i < len; ++i) {
+				CHECK(MU_RLES24(&buf[i * 3]) == ref_s24(vals[start + i]), "wles24_f32 rounding of %.9g len %zu index %zu", (double)vals[start + i], len, i);
+			}
+			muu_wbes24_f32_array(buf, &vals[start], len);
+			for (size_m i = 0; i < len; ++i) {
+				CHECK(MU_RBES24(&buf[i * 3]) == ref_s24(vals[start + i]), "wbes24_f32 rounding of %.9g len %zu index %zu", (double)vals[start + i], len, i);
+			}
+		}
+	}
+}
+
+static void check_half(void) {
+	// Compares the bulk conversions against the single-value accessors
+	muByte buf[300], ref[300];
+	float vals[140], out[140];
+	for (size_m len = 0; len < 140; len += 1 + len / 8) {
+		for (size_m off = 0; off < 2; ++off) {
+			fill(buf, sizeof(buf));
+			muu_rlef16_array(&buf[off], out, len);
+			for (size_m i = 0; i < len; ++i) {
+				float r = MU_RLEF16(&buf[off + i * 2]);
+				CHECK(!memcmp(&out[i], &r, 4) || (r != r && out[i] != out[i]), "rlef16 array off %zu len %zu index %zu", off, len, i);
+			}
+			muu_rbebf16_array(&buf[off], out, len);
+			for (size_m i = 0; i < len; ++i) {
+				float r = MU_RBEBF16(&buf[off + i * 2]);
+				CHECK(!memcmp(&out[i], &r, 4) || (r != r && out[i] != out[i]), "rbebf16 array off %zu len %zu index %zu", off, len, i);
+			}
+
+			for (size_m i = 0; i < len; ++i) {
+				uint32_m u = (uint32_m)rng();
+				mu_memcpy(&vals[i], &u, 4);
+			}
+			mu_memset(buf, 0xAA, sizeof(buf));
+			mu_memset(ref, 0xAA, sizeof(ref));
+			muu_wbef16_array(&buf[off], vals, len);
+			for (size_m i = 0; i < len; ++i) {
+				MU_WBEF16(&ref[off + i * 2], vals[i]);
+			}
+			CHECK(!memcmp(buf, ref, sizeof(buf)), "wbef16 array off %zu len %zu", off, len);
+			mu_memset(buf, 0xAA, sizeof(buf));
+			mu_memset(ref, 0xAA, sizeof(ref));
+			muu_wlebf16_array(&buf[off], vals, len);
+			for (size_m i = 0; i < len; ++i) {
+				MU_WLEBF16(&ref[off + i * 2], vals[i]);
+			}
+			CHECK(!memcmp(buf, ref, sizeof(buf)), "wlebf16 array off %zu len %zu", off, len);
+		}
+	}
+}
+
+static muBool same_f32(float a, float b) {
+	// Compares bits, treating any two NaNs as equal since moving one through
+	// registers may quiet it
+	return !memcmp(&a, &b, 4) || (a != a && b != b);
+}
+
+static muBool same_f64(double a, double b) {
+	return !memcmp(&a, &b, 8) || (a != a && b != b);
+}
+
+static void check_floats(void) {
+	muByte buf[8 * 70 + 8], ref[8 * 70 + 8];
+	float f[70], fo[70];
+	double d[70], dout[70];
+
+	for (int i = 0; i < 2000; ++i) {
+		fill(buf, 8);
+		for (int be = 0; be < 2; ++be) {
+			uint32_m u32 = (uint32_m)ref_read(buf, 4, be, 0);
+			uint64_m u64 = ref_read(buf, 8, be, 0);
+			float rf;
+			double rd;
+			mu_memcpy(&rf, &u32, 4);
+			mu_memcpy(&rd, &u64, 8);
+			CHECK(same_f32(be ? MU_RBEF32(buf) : MU_RLEF32(buf), rf), "r%sf32 %08x", be ? "be" : "le", (unsigned)u32);
+			CHECK(same_f64(be ? MU_RBEF64(buf) : MU_RLEF64(buf), rd), "r%sf64 %016llx", be ? "be" : "le", (unsigned long long)u64);
+
+			// Writes are checked with non-NaN values, whose bits must be kept exactly
+			if (rf == rf) {
+				if (be) {
+					MU_WBEF32(ref, rf);
+				} else {
+					MU_WLEF32(ref, rf);
+				}
+				CHECK(ref_read(ref, 4, be, 0) == u32, "w%sf32 %08x", be ? "be" : "le", (unsigned)u32);
+			}
+			if (rd == rd) {
+				if (be) {
+					MU_WBEF64(ref, rd);
+				} else {
+					MU_WLEF64(ref, rd);
+				}
+				CHECK(ref_read(ref, 8, be, 0) == u64, "w%sf64 %016llx", be ? "be" : "le", (unsigned long long)u64);
+			}
+		}
+	}
+
+	for (size_m len = 0; len < 70; ++len) {
+		size_m off = len % 4;
+		fill(buf, sizeof(buf));
+		muu_rlef32_array(&buf[off], f, len);
+		muu_rbef64_array(&buf[off], d, len);
+		for (size_m i = 0; i < len; ++i) {
+			CHECK(same_f32(f[i], MU_RLEF32(&buf[off + i * 4])), "rlef32 array len %zu index %zu", len, i);
+			CHECK(same_f64(d[i], MU_RBEF64(&buf[off + i * 8])), "rbef64 array len %zu index %zu", len, i);
+		}
+		muu_rbef32_array(&buf[off], f, len);
+		muu_rlef64_array(&buf[off], d, len);
+		for (size_m i = 0; i < len; ++i) {
+			CHECK(same_f32(f[i], MU_RBEF32(&buf[off + i * 4])), "rbef32 array len %zu index %zu", len, i);
+			CHECK(same_f64(d[i], MU_RLEF64(&buf[off + i * 8])), "rlef64 array len %zu index %zu", len, i);
+		}
+
+		for (size_m i = 0; i < len; ++i) {
+			fo[i] = (float)(int32_m)rng() / 1024.f;
+			dout[i] = (double)(int64_m)rng() / 1048576.0;
+		}
+		mu_memset(buf, 0xAA, sizeof(buf));
+		mu_memset(ref, 0xAA, sizeof(ref));
+		muu_wbef32_array(&buf[off], fo, len);
+		for (size_m i = 0; i < len; ++i) {
+			MU_WBEF32(&ref[off + i * 4], fo[i]);
+		}
+		CHECK(!memcmp(buf, ref, sizeof(buf)), "wbef32 array len %zu", len);
+		mu_memset(buf, 0xAA, sizeof(buf));
+		mu_memset(ref, 0xAA, sizeof(ref));
+		muu_wlef64_array(&buf[off], dout, len);
+		for (size_m i = 0; i < len; ++i) {
+			MU_WLEF64(&ref[off + i * 8], dout[i]);
+		}
+		CHECK(!memcmp(buf, ref, sizeof(buf)), "wlef64 array len %zu", len);
+	}
+}
+
+static void check_samples(void) {
+	// Lengths that aren't multiples of any SIMD width, at unaligned float offsets
+	static muByte buf[600 * 3];
+	static float vals[600 + 4], out[600 + 4];
+	for (size_m len = 0; len < 600; len += (len < 70) ? 1 : 97) {
+		for (size_m off = 0; off < 4; ++off) {
+			fill(buf, sizeof(buf));
+			muu_rles24_f32_array(buf, &out[off], len);
+			for (size_m i = 0; i < len; ++i) {
+				float r = (float)(int32_m)ref_read(&buf[i * 3], 3, 0, 1) / 8388608.f;
+				CHECK(same_f32(out[off + i], r), "rles24_f32 len %zu off %zu index %zu", len, off, i);
+			}
+			muu_rbes24_f32_array(buf, &out[off], len);
+			for (size_m i = 0; i < len; ++i) {
+				float r = (float)(int32_m)ref_read(&buf[i * 3], 3, 1, 1) / 8388608.f;
+				CHECK(same_f32(out[off + i], r), "rbes24_f32 len %zu off %zu index %zu", len, off, i);
+			}
+
+			// Values mostly in range, with some out of range, infinite, and NaN
+			for (size_m i = 0; i < len; ++i) {
+				uint64_m r = rng();
+				if ((r & 31) == 0) {
+					uint32_m u = (uint32_m)(r >> 32);
+					mu_memcpy(&vals[off + i], &u, 4);
+				} else {
+					vals[off + i] = (float)((double)(int64_m)r / 6148914691236517205.0);
+				}
+			}
+			muu_wles24_f32_array(buf, &vals[off], len);
+			for (size_m i = 0; i < len; ++i) {
+				CHECK((int32_m)ref_read(&buf[i * 3], 3, 0, 1) == ref_s24(vals[off + i]), "wles24_f32 of %.9g len %zu off %zu index %zu", (double)vals[off + i], len, off, i);
+			}
+			muu_wbes24_f32_array(buf, &vals[off], len);
+			for (size_m i = 0; i < len; ++i) {
+				CHECK((int32_m)ref_read(&buf[i * 3], 3, 1, 1) == ref_s24(vals[off + i]), "wbes24_f32 of %.9g len %zu off %zu index %zu", (double)vals[off + i], len, off, i);
+			}
+		}
+	}
+}
+
+static void check_bits(void) {
+	static muByte buf[4096], ref[4096];
+	static uint64_m vals[1000];
+	static uint32_m widths[1000];
+	for (int msb = 0; msb < 2; ++msb) {
+		for (size_m count = 0; count < 1000; count += 1 + count / 3) {
+			// Reference stream, written bit by bit
+			size_m bits = 0;
+			mu_memset(ref, 0, sizeof(ref));
+			for (size_m i = 0; i < count; ++i) {
+				widths[i] = (uint32_m)(rng() % 58);
+				vals[i] = (widths[i] == 0) ? 0 : rng() & ((((uint64_m)1) << widths[i]) - 1);
+				for (uint32_m k = 0; k < widths[i]; ++k, ++bits) {
+					uint64_m bit = msb ? (vals[i] >> (widths[i] - 1 - k)) & 1 : (vals[i] >> k) & 1;
+					ref[bits / 8] |= (muByte)(bit << (msb ? 7 - bits % 8 : bits % 8));
+				}
+			}
+
+			muBitWriter w;
+			muuResult res = MUU_SUCCESS;
+			fill(buf, sizeof(buf));
+			muu_bit_writer_init(&w, buf, sizeof(buf));
+			for (size_m i = 0; i < count; ++i) {
+				if (msb) {
+					muu_bit_writer_msb_write(&w, vals[i], widths[i]);
+				} else {
+					muu_bit_writer_lsb_write(&w, vals[i], widths[i]);
+				}
+			}
+			size_m n = msb ? muu_bit_writer_msb_finish(&w, &res) : muu_bit_writer_lsb_finish(&w, &res);
+			CHECK(res == MUU_SUCCESS && n == (bits + 7) / 8, "bit writer %s count %zu size %zu", msb ? "msb" : "lsb", count, n);
+			CHECK(!memcmp(buf, ref, (bits + 7) / 8), "bit writer %s count %zu stream", msb ? "msb" : "lsb", count);
+
+			// Reading exactly the written bytes exercises the reader's end of data
+			muBitReader r;
+			muu_bit_reader_init(&r, buf, n);
+			for (size_m i = 0; i < count; ++i) {
+				uint64_m v = msb ? muu_bit_reader_msb_read(&r, widths[i]) : muu_bit_reader_lsb_read(&r, widths[i]);
+				CHECK(v == vals[i], "bit reader %s count %zu index %zu width %u", msb ? "msb" : "lsb", count, i, (unsigned)widths[i]);
+			}
+			CHECK(!muu_bit_reader_overrun(&r), "bit reader %s count %zu overrun", msb ? "msb" : "lsb", count);
+		}
+	}
+}
+
+// A source and sink in odd-sized chunks, for the byte reader and writer
+
+struct chunks {
+	muByte* data;
+	size_m len;
+	size_m pos;
+};
+
+static size_m chunk_refill(void* user, muByte* data, size_m len) {
+	struct chunks* c = (struct chunks*)user;
+	size_m n = 1 + (size_m)(rng() % 7);
+	n = (n > len) ? len : n;
+	n = (n > c->len - c->pos) ? c->len - c->pos : n;
+	mu_memcpy(data, &c->data[c->pos], n);
+	c->pos += n;
+	return n;
+}
+
+static muBool chunk_flush(void* user, muByte* data, size_m len) {
+	struct chunks* c = (struct chunks*)user;
+	if (c->pos + len > c->len) {
+		return MU_FALSE;
+	}
+	mu_memcpy(&c->data[c->pos], data, len);
+	c->pos += len;
+	return MU_TRUE;
+}
+
+static void check_streams(void) {
+	static muByte out[8192], ref[8192], raw[64], got[64];
+	static uint64_m vals[600];
+	static uint32_m kinds[600];
+	muByte buf[16];
+
+	for (size_m count = 1; count < 600; count += 1 + count / 2) {
+		// Reference encoding, written directly into one buffer
+		size_m len = 0;
+		for (size_m i = 0; i < count; ++i) {
+			kinds[i] = (uint32_m)(rng() % 6);
+			vals[i] = rng() >> (rng() % 64);
+			switch (kinds[i]) {
+				case 0: ref[len++] = (muByte)vals[i]; break;
+				case 1: MU_WBEU16(&ref[len], (uint16_m)vals[i]); len += 2; break;
+				case 2: MU_WLEU24(&ref[len], (uint32_m)vals[i] & 0xFFFFFF); len += 3; break;
+				case 3: MU_WBEU64(&ref[len], vals[i]); len += 8; break;
+				case 4: len += muu_wleb128u(&ref[len], vals[i]); break;
+				// Raw runs longer than the buffer
+				default: vals[i] %= 40; fill(&ref[len], (size_m)vals[i]); len += (size_m)vals[i]; break;
+			}
+		}
+
+		// Writing through a 16-byte buffer with flushes
+		struct chunks sink_c = { out, sizeof(out), 0 };
+		muByteWriter w;
+		muuResult res = MUU_SUCCESS;
+		size_m pos = 0;
+		muu_byte_writer_init_flush(&w, buf, sizeof(buf), chunk_flush, &sink_c);
+		for (size_m i = 0; i < count; ++i) {
+			switch (kinds[i]) {
+				case 0: muu_byte_writer_wleu8(&w, (uint8_m)vals[i], &res); break;
+				case 1: muu_byte_writer_wbeu16(&w, (uint16_m)vals[i], &res); break;
+				case 2: muu_byte_writer_wleu24(&w, (uint32_m)vals[i] & 0xFFFFFF, &res); break;
+				case 3: muu_byte_writer_wbeu64(&w, vals[i], &res); break;
+				case 4: muu_byte_writer_wleb128u(&w, vals[i], &res); break;
+				default: muu_byte_writer_write(&w, &ref[pos], (size_m)vals[i], &res); break;
+			}
+			pos += (kinds[i] == 0) ? 1 : (kinds[i] == 1) ? 2 : (kinds[i] == 2) ? 3 : (kinds[i] == 3) ? 8 : (kinds[i] == 4) ? muu_wleb128u(raw, vals[i]) : (size_m)vals[i];
+		}
+		muu_byte_writer_flush(&w, &res);
+		CHECK(res == MUU_SUCCESS && sink_c.pos == len && !memcmp(out, ref, len), "byte writer count %zu", count);
+
+		// Reading back through a 16-byte buffer refilled in chunks of 1 to 7 bytes
+		struct chunks src = { ref, len, 0 };
+		muByteReader r;
+		res = MUU_SUCCESS;
+		muu_byte_reader_init_refill(&r, buf, sizeof(buf), chunk_refill, &src);
+		for (size_m i = 0; i < count; ++i) {
+			uint64_m v = 0, e = vals[i];
+			switch (kinds[i]) {
+				case 0: v = muu_byte_reader_rleu8(&r, &res); e &= 0xFF; break;
+				case 1: v = muu_byte_reader_rbeu16(&r, &res); e &= 0xFFFF; break;
+				case 2: v = muu_byte_reader_rleu24(&r, &res); e &= 0xFFFFFF; break;
+				case 3: v = muu_byte_reader_rbeu64(&r, &res); break;
+				case 4: v = muu_byte_reader_rleb128u(&r, &res); break;
+				default:
+					muu_byte_reader_read(&r, got, (size_m)vals[i], &res);
+					v = e = !memcmp(got, &ref[r.offset + r.pos - (size_m)vals[i]], (size_m)vals[i]);
+					break;
+			}
+			CHECK(res == MUU_SUCCESS && v == e, "byte reader count %zu index %zu kind %u", count, i, (unsigned)kinds[i]);
+		}
+		CHECK(r.offset + r.pos == len, "byte reader count %zu consumed", count);
+		muu_byte_reader_rleu8(&r, &res);
+		CHECK(res == MUU_OUT_OF_DATA, "byte reader count %zu end of data", count);
+	}
+}
+
+// A typical table entry of mixed big-endian fields, 32 bytes long
+
+#define BENCH_RECORD(FIELD, ARRAY) \
+	FIELD(id, 0, BE, U32) \
+	FIELD(flags, 4, BE, U16) \
+	FIELD(kind, 6, BE, U8) \
+	FIELD(offset, 8, BE, U64) \
+	FIELD(length, 16, BE, U32) \
+	ARRAY(pos, 20, BE, S16, 3) \
+	FIELD(scale, 26, BE, F16) \
+	FIELD(crc, 28, BE, U32)
+
+MU_RECORD(BenchRecord, 32, BENCH_RECORD)
+
+static void check_records(void) {
+	static muByte buf[32 * 100], out[32 * 100], ref[32 * 100];
+	static BenchRecord recs[100];
+	for (size_m count = 0; count <= 100; count += 1 + count / 4) {
+		fill(buf, sizeof(buf));
+		BenchRecord_unpack(buf, recs, count);
+		for (size_m i = 0; i < count; ++i) {
+			muByte* b = &buf[i * 32];
+			BenchRecord* n = &recs[i];
+			CHECK(n->id == MU_RBEU32(b) && n->flags == MU_RBEU16(&b[4]) && n->kind == b[6] && n->offset == MU_RBEU64(&b[8]) && n->length == MU_RBEU32(&b[16]), "record unpack count %zu index %zu", count, i);
+			CHECK(n->pos[0] == MU_RBES16(&b[20]) && n->pos[1] == MU_RBES16(&b[22]) && n->pos[2] == MU_RBES16(&b[24]), "record unpack array count %zu index %zu", count, i);
+			CHECK(same_f32(n->scale, MU_RBEF16(&b[26])) && n->crc == MU_RBEU32(&b[28]), "record unpack float count %zu index %zu", count, i);
+		}
+
+		// Packing matches writing every field back one by one, leaving the gap at byte 7 alone
+		mu_memset(out, 0x5A, sizeof(out));
+		mu_memset(ref, 0x5A, sizeof(ref));
+		BenchRecord_pack(out, recs, count);
+		for (size_m i = 0; i < count; ++i) {
+			muByte* b = &ref[i * 32];
+			BenchRecord* n = &recs[i];
+			MU_WBEU32(b, n->id);
+			MU_WBEU16(&b[4], n->flags);
+			b[6] = n->kind;
+			MU_WBEU64(&b[8], n->offset);
+			MU_WBEU32(&b[16], n->length);
+			MU_WBES16(&b[20], n->pos[0]);
+			MU_WBES16(&b[22], n->pos[1]);
+			MU_WBES16(&b[24], n->pos[2]);
+			MU_WBEF16(&b[26], n->scale);
+			MU_WBEU32(&b[28], n->crc);
+		}
+		CHECK(!memcmp(out, ref, sizeof(out)), "record pack count %zu", count);
+	}
+}
+
+static void check_arena(void) {
+	muArena a;
+	muuResult res = MUU_SUCCESS;
+	static muByte buffer[200];
+
+	// Alignments at or past that of the blocks, filling whatever was handed out
+	for (int buffered = 0; buffered < 2; ++buffered) {
+		if (buffered) {
+			muu_arena_init_buffer(&a, &buffer[1], sizeof(buffer) - 1, 64);
+		} else {
+			muu_arena_init(&a, 64);
+		}
+		size_t before = skew_overruns;
+		for (int i = 0; i < 2000; ++i) {
+			size_m align = (size_m)1 << (rng() % 8);
+			size_m size = (size_m)(rng() % ((i & 1) ? 200 : 64));
+			muByte* p = (muByte*)muu_arena_alloc(&a, size, align, &res);
+			CHECK(p && ((size_m)p & (align - 1)) == 0, "arena%s alloc of %zu aligned to %zu", buffered ? " buffer" : "", size, align);
+
+			// Allocations must end within the block they came from
+			muByte* end = a.block ? (muByte*)a.block + MUU_ARENA_HEADER + a.block->capacity : &buffer[sizeof(buffer)];
+			CHECK(p && &p[size] <= end, "arena%s alloc of %zu aligned to %zu is past its block", buffered ? " buffer" : "", size, align);
+			if (p && &p[size] <= end) {
+				memset(p, 0x3C, size);
+			}
+			if ((i % 100) == 99) {
+				muu_arena_reset(&a);
+			}
+		}
+		muu_arena_reset(&a);
+		CHECK(res == MUU_SUCCESS && skew_overruns == before, "arena%s wrote past its blocks", buffered ? " buffer" : "");
+	}
+}
+
+static int run_checks(void) {
+	// Run every check with each runtime-dispatched SIMD level in turn
+	uint32_m features = muu_cpu_features();
+	uint32_m levels[3];
+	levels[0] = features;
+	levels[1] = features & ~(uint32_m)(MU_CPU_AVX2 | MU_CPU_F16C);
+	levels[2] = 0;
+
+	for (int l = 0; l < 3; ++l) {
+		muu_cpu_set_features(levels[l]);
+		check_accessors();
+		check_varints();
+		check_checksums();
+		check_hash();
+		check_half();
+		check_sample_rounding();
+		check_floats();
+		check_samples();
+		check_bits();
+		check_streams();
+		check_records();
+	}
+	check_arena();
+	muu_cpu_set_features(features);
+
+	fprintf(stderr, "check: %zu failure(s)\n", failures);
+	return failures ? 1 : 0;
+}
+
+/* Benchmarks */
+
+static void bench(const char* kind, const char* name, bench_func f, muByte* b, muByte* d, size_m off, size_m bytes) {
+	if (filter && !strstr(name, filter)) {
+		return;
+	}
+
+	// Warm up, then time passes until the minimum time is reached, keeping the best
+	f(&b[off], d, bytes);
+	uint64_m best = ~(uint64_m)0, total = 0;
+	while (total < min_ns) {
+		uint64_m t = muu_time_ns();
+		f(&b[off], d, bytes);
+		t = muu_time_ns() - t;
+		if (t < best) {
+			best = t;
+		}
+		total += t + 1;
+	}
+	if (!best) {
+		best = 1;
+	}
+	printf("%s,%s,%zu,%zu,%llu,%.3f\n", kind, name, off, bytes, (unsigned long long)best, (double)bytes / (double)best);
+	fflush(stdout);
+}
+
+static void base_memcpy(muByte* b, muByte* d, size_m bytes) {
+	mu_memcpy(d, b, bytes);
+}
+
+static void base_memcpy_bswap16(muByte* b, muByte* d, size_m bytes) {
+	uint16_m* n = (uint16_m*)d;
+	mu_memcpy(d, b, bytes);
+	for (size_m i = 0; i < bytes / 2; ++i) {
+		n[i] = swap16(n[i]);
+	}
+}
+
+static void base_memcpy_bswap32(muByte* b, muByte* d, size_m bytes) {
+	uint32_m* n = (uint32_m*)d;
+	mu_memcpy(d, b, bytes);
+	for (size_m i = 0; i < bytes / 4; ++i) {
+		n[i] = swap32(n[i]);
+	}
+}
+
+static void base_memcpy_bswap64(muByte* b, muByte* d, size_m bytes) {
+	uint64_m* n = (uint64_m*)d;
+	mu_memcpy(d, b, bytes);
+	for (size_m i = 0; i < bytes / 8; ++i) {
+		n[i] = swap64(n[i]);
+	}
+}
+
+static void base_load_bswap16(muByte* b, muByte* d, size_m bytes) {
+	uint64_m acc = 0;
+	(void)d;
+	for (size_m i = 0; i + 2 <= bytes; i += 2) {
+		uint16_m v;
+		mu_memcpy(&v, &b[i], 2);
+		acc += swap16(v);
+	}
+	sink += acc;
+}
+
+static void base_load_bswap32(muByte* b, muByte* d, size_m bytes) {
+	uint64_m acc = 0;
+	(void)d;
+	for (size_m i = 0; i + 4 <= bytes; i += 4) {
+		uint32_m v;
+		mu_memcpy(&v, &b[i], 4);
+		acc += swap32(v);
+	}
+	sink += acc;
+}
+
+static void base_load_bswap64(muByte* b, muByte* d, size_m bytes) {
+	uint64_m acc = 0;
+	(void)d;
+	for (size_m i = 0; i + 8 <= bytes; i += 8) {
+		uint64_m v;
+		mu_memcpy(&v, &b[i], 8);
+		acc += swap64(v);
+	}
+	sink += acc;
+}
+
+static void bulk_crc32(muByte* b, muByte* d, size_m bytes) {
+	(void)d;
+	sink += muu_crc32(MU_CRC32_INIT, b, bytes);
+}
+
+static void bulk_adler32(muByte* b, muByte* d, size_m bytes) {
+	(void)d;
+	sink += muu_adler32(MU_ADLER32_INIT, b, bytes);
+}
+
+static void bulk_hash64(muByte* b, muByte* d, size_m bytes) {
+	(void)d;
+	sink += muu_hash64(b, bytes, 0);
+}
+
+static void bulk_fnv1a(muByte* b, muByte* d, size_m bytes) {
+	(void)d;
+	sink += fnv1a(b, bytes);
+}
+
+static void bulk_hash64_keys16(muByte* b, muByte* d, size_m bytes) {
+	uint64_m acc = 0;
+	(void)d;
+	for (size_m i = 0; i + 16 <= bytes; i += 16) {
+		acc += muu_hash64(&b[i], 16, 0);
+	}
+	sink += acc;
+}
+
+static void bulk_fnv1a_keys16(muByte* b, muByte* d, size_m bytes) {
+	uint64_m acc = 0;
+	(void)d;
+	for (size_m i = 0; i + 16 <= bytes; i += 16) {
+		acc += fnv1a(&b[i], 16);
+	}
+	sink += acc;
+}
+
+static void bulk_svb_encode(muByte* b, muByte* d, size_m bytes) {
+	// 'b' holds the encoded bytes; 'd' the values
+	muu_svb_encode_u32(b, (uint32_m*)d, bytes / MU_SVB_MAX_SIZE(1));
+}
+
+static void bulk_svb_decode(muByte* b, muByte* d, size_m bytes) {
+	size_m len = bytes / MU_SVB_MAX_SIZE(1);
+	sink += muu_svb_decode_u32(b, MU_SVB_MAX_SIZE(len), (uint32_m*)d, len);
+}
+
+static void bulk_leb128_read(muByte* b, muByte* d, size_m bytes) {
+	uint64_m acc = 0, n = 0;
+	(void)d;
+	for (size_m i = 0; i + MU_LEB128_MAX <= bytes; ) {
+		// Random data can hold runs that are too long to be valid, which are skipped
+		size_m r = muu_rleb128u(&b[i], MU_LEB128_MAX, &n);
+		i += r ? r : 1;
+		acc += n;
+	}
+	sink += acc;
+}
+
+static void bulk_f16_read(muByte* b, muByte* d, size_m bytes) {
+	muu_rlef16_array(b, (float*)d, bytes / 2);
+}
+
+static void bulk_f16_write(muByte* b, muByte* d, size_m bytes) {
+	muu_wlef16_array(b, (float*)d, bytes / 2);
+}
+
+static void bulk_bf16_read(muByte* b, muByte* d, size_m bytes) {
+	muu_rlebf16_array(b, (float*)d, bytes / 2);
+}
+
+static void bulk_bf16_write(muByte* b, muByte* d, size_m bytes) {
+	muu_wlebf16_array(b, (float*)d, bytes / 2);
+}
+
+static void bulk_record_unpack(muByte* b, muByte* d, size_m bytes) {
+	BenchRecord_unpack(b, (BenchRecord*)d, bytes / 32);
+}
+
+static void bulk_record_pack(muByte* b, muByte* d, size_m bytes) {
+	BenchRecord_pack(b, (BenchRecord*)d, bytes / 32);
+}
+
+static int run_benchmarks(muBool quick) {
+	static const size_m all_sizes[] = { 16 << 10, 256 << 10, 8 << 20, 64 << 20 };
+	size_m size_count = quick ? 2 : 4;
+	size_m max = all_sizes[size_count - 1];
+
+	// Byte data gets 64 bytes of slack for the unaligned offset, and is 64-byte aligned
+	muByte* braw = (muByte*)malloc(max + 128);
+	muByte* draw = (muByte*)malloc(max * 2 + 128);
+	if (!braw || !draw) {
+		fprintf(stderr, "allocation failed\n");
+		return 1;
+	}
+	muByte* b = braw + (64 - ((size_m)braw & 63));
+	muByte* d = draw + (64 - ((size_m)draw & 63));
+	fill(b, max + 32);
+	fill(d, max);
+
+	printf("kind,name,offset,size,ns,gbps\n");
+	for (size_m s = 0; s < size_count; ++s) {
+		size_m bytes = all_sizes[s];
+		for (size_m off = 0; off < 2; ++off) {
+			bench("baseline", "memcpy", base_memcpy, b, d, off, bytes);
+			bench("baseline", "memcpy_bswap16", base_memcpy_bswap16, b, d, off, bytes);
+			bench("baseline", "memcpy_bswap32", base_memcpy_bswap32, b, d, off, bytes);
+			bench("baseline", "memcpy_bswap64", base_memcpy_bswap64, b, d, off, bytes);
+			bench("baseline", "load_bswap16", base_load_bswap16, b, d, off, bytes);
+			bench("baseline", "load_bswap32", base_load_bswap32, b, d, off, bytes);
+			bench("baseline", "load_bswap64", base_load_bswap64, b, d, off, bytes);
+
+			for (size_m a = 0; a < ACCESSOR_COUNT; ++a) {
+				const struct accessor* x = &accessors[a];
+				char name[32];
+				snprintf(name, sizeof(name), "r%s", x->name);
+				bench("single", name, x->bench_read, b, d, off, bytes);
+				snprintf(name, sizeof(name), "w%s", x->name);
+				bench("single", name, x->bench_write, b, d, off, bytes);
+				snprintf(name, sizeof(name), "r%s_array", x->name);
+				bench("array", name, x->bench_read_array, b, d, off, bytes);
+				snprintf(name, sizeof(name), "w%s_array", x->name);
+				bench("array", name, x->bench_write_array, b, d, off, bytes);
+			}
+
+			bench("bulk", "crc32", bulk_crc32, b, d, off, bytes);
+			bench("bulk", "adler32", bulk_adler32, b, d, off, bytes);
+			bench("bulk", "hash64", bulk_hash64, b, d, off, bytes);
+			bench("bulk", "fnv1a", bulk_fnv1a, b, d, off, bytes);
+			bench("bulk", "hash64_keys16", bulk_hash64_keys16, b, d, off, bytes);
+			bench("bulk", "fnv1a_keys16", bulk_fnv1a_keys16, b, d, off, bytes);
+			bench("bulk", "svb_encode", bulk_svb_encode, b, d, off, bytes);
+			bench("bulk", "svb_decode", bulk_svb_decode, b, d, off, bytes);
+			bench("bulk", "leb128_read", bulk_leb128_read, b, d, off, bytes);
+			bench("bulk", "f16_read", bulk_f16_read, b, d, off, bytes);
+			bench("bulk", "f16_write", bulk_f16_write, b, d, off, bytes);
+			bench("bulk", "bf16_read", bulk_bf16_read, b, d, off, bytes);
+			bench("bulk", "bf16_write", bulk_bf16_write, b, d, off, bytes);
+			bench("bulk", "record_unpack", bulk_record_unpack, b, d, off, bytes);
+			bench("bulk", "record_pack", bulk_record_pack, b, d, off, bytes);
+		}
+	}
+
+	free(braw);
+	free(draw);
+	return 0;
+}
+
+int main(int argc, char** argv) {
+	muBool check = MU_FALSE, quick = MU_FALSE;
+	for (int i = 1; i < argc; ++i) {
+		if (!strcmp(argv[i], "--check")) {
+			check = MU_TRUE;
+		} else if (!strcmp(argv[i], "--quick")) {
+			quick = MU_TRUE;
+			min_ns = 2000000;
+		} else if (!strcmp(argv[i], "--time-ms") && i + 1 < argc) {
+			min_ns = (uint64_m)strtoull(argv[++i], 0, 10) * 1000000;
+		} else if (!strcmp(argv[i], "--filter") && i + 1 < argc) {
+			filter = argv[++i];
+		} else {
+			fprintf(stderr, "usage: %s [--check] [--quick] [--time-ms N] [--filter NAME]\n", argv[0]);
+			return 2;
+		}
+	}
+	return check ? run_checks() : run_benchmarks(quick);
+}
@@ -203,6 +203,54 @@ muUtility is licensed under public domain or MIT license, whichever you prefer.
 
 		#endif /* stdbool.h */
 
+		// @DOCLINE ## `stdlib.h` dependencies
+		#if !defined(mu_malloc) || \
+			!defined(mu_free) || \
+			!defined(mu_realloc)
+
+			#include <stdlib.h>
+
+			// @DOCLINE * `mu_malloc` - equivalent to `malloc`.
+			#ifndef mu_malloc
+				#define mu_malloc malloc
+			#endif
+
+			// @DOCLINE * `mu_free` - equivalent to `free`.
+			#ifndef mu_free
+				#define mu_free free
+			#endif
+
+			// @DOCLINE * `mu_realloc` - equivalent to `realloc`.
+			#ifndef mu_realloc
+				#define mu_realloc realloc
+			#endif
+
+		#endif /* stdlib.h */
+
+		// @DOCLINE ## `string.h` dependencies
+		#if !defined(mu_memcpy) || \
+			!defined(mu_memmove) || \
+			!defined(mu_memset)
+
+			#include <string.h>
+
+			// @DOCLINE * `mu_memcpy` - equivalent to `memcpy`.
+			#ifndef mu_memcpy
+				#define mu_memcpy memcpy
+			#endif
+
+			// @DOCLINE * `mu_memmove` - equivalent to `memmove`.
+			#ifndef mu_memmove
+				#define mu_memmove memmove
+			#endif
+
+			// @DOCLINE * `mu_memset` - equivalent to `memset`.
+			#ifndef mu_memset
+				#define mu_memset memset
+			#endif
+
+		#endif /* string.h */
+
 	// @DOCLINE # Zero struct
 
 		// @DOCLINE There are two macros, `MU_ZERO_STRUCT` and `MU_ZERO_STRUCT_CONST`, which are functions used to zero-out a struct's contents, with their only parameter being the struct type. The reason this needs to be defined is because the way C and C++ syntax handles an empty struct are different, and need to be adjusted for. These macros are overridable by defining them before `muUtility.h` is included.
@@ -223,551 +271,9521 @@ muUtility is licensed under public domain or MIT license, whichever you prefer.
 			#endif
 		#endif
 
-	// @DOCLINE # Byte manipulation
+	// @DOCLINE # Instruction set recognition
 
-		// @DOCLINE muUtility defines several inline functions that read a value from a given array of bytes. Internally, they're all defined with the prefix `muu_...`, and then a macro is defined for them as `MU_...` (with change in capitalization after the prefix as well). The macros for these functions can be overridden, and, in such case, the original function will go undefined. For example, the function `muu_rleu8` is primarily referenced via the macro `MU_RLEU8`, and if `MU_RLEU8` is overridden, `muu_rleu8` is never defined and is not referenceable.
+		/* @DOCBEGIN
 
-		// @DOCLINE All reading functions take in a pointer of bytes as their only parameter and have a return type of the fixed-width size of bits in question; for example, `muu_rleu8` is defined as:
+		The macros `MU_SSE2`, `MU_SSSE3`, and `MU_AVX2` are defined (if none of them were defined before) when the compiler is targeting the respective x86 instruction set extension, in order to allow mu libraries to compile SIMD code paths. Their respective intrinsic headers are included when they are defined.
+
+		`MU_SSE2` will be defined if `__SSE2__` is defined, or if `_M_X64` is defined, or if `_M_IX86_FP` is defined as at least 2.
+
+		`MU_SSSE3` will be defined if `MU_SSE2` is defined and `__SSSE3__` or `__AVX2__` are defined.
+
+		`MU_AVX2` will be defined if `MU_SSSE3` is defined and `__AVX2__` is defined.
+
+		This functionality can be turned off entirely by defining `MU_NO_SIMD`, in which case all mu code falls back to scalar implementations.
 
-		/* @DOCBEGIN
-		```
-		MUDEF inline uint8_m muu_rleu8(muByte* b);
-		```
 		@DOCEND */
 
-		// @DOCLINE All writing functions take in a pointer of bytes as their first parameter, the number to be written as the second parameter, and have a return type of void; for example, `muu_wleu8` is defined as:
+		#if !defined(MU_NO_SIMD) && !defined(MU_SSE2) && !defined(MU_SSSE3) && !defined(MU_AVX2)
+			#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				#define MU_SSE2
+				#include <emmintrin.h>
+			#endif
+			#if defined(MU_SSE2) && (defined(__SSSE3__) || defined(__AVX2__))
+				#define MU_SSSE3
+				#include <tmmintrin.h>
+			#endif
+			#if defined(MU_SSSE3) && defined(__AVX2__)
+				#define MU_AVX2
+				#include <immintrin.h>
+			#endif
+		#endif
+
+	// @DOCLINE # Atomics
 
 		/* @DOCBEGIN
-		```
-		MUDEF inline void muu_wleu8(muByte* b, uint8_m n);
-		```
+
+		muUtility defines a set of atomic operations with explicit memory ordering in order to allow mu libraries to share data between threads without locks, or to build their own locks. They're macros that map to the GCC/Clang `__atomic` builtins if they're available, C11's `stdatomic.h` if not (and compiling as C11 or later with atomics supported), or MSVC's `Interlocked` intrinsics if not; with any of these, the macro `MU_ATOMICS` is defined. Each macro can be overridden by defining it before the inclusion of muUtility.
+
+		If none of these are available, the operations fall back to plain volatile accesses, which are only correct if a single thread accesses the data, and `MU_ATOMICS` is not defined.
+
 		@DOCEND */
 
-		// @DOCLINE The exception to this is 24-bit, in which case, the fixed-width types are 32-bit (`uint32_m` / `int32_m`).
+		// @DOCLINE ## Memory orders
 
-		// @DOCLINE ## Byte type
+			// @DOCLINE The following macros are the memory orders that can be passed to each atomic operation, matching the C11 memory orders of the same name:
 
-			// @DOCLINE muUtility defines the type `muByte` to refer to a byte. It is defined as `uint8_m`, and is overridable.
-			#ifndef muByte
-				#define muByte uint8_m
-			#endif
+			// @DOCLINE * `MU_ATOMIC_RELAXED` - no ordering; only the operation itself is atomic.
 
-		// @DOCLINE ## 8-bit
+			// @DOCLINE * `MU_ATOMIC_ACQUIRE` - no reads or writes after the operation can be reordered before it; used when reading data published by another thread.
 
-			// @DOCLINE The following macros exist for byte manipulation regarding 8-bit integers:
+			// @DOCLINE * `MU_ATOMIC_RELEASE` - no reads or writes before the operation can be reordered after it; used when publishing data to another thread.
 
-			// @DOCLINE * `MU_RLEU8` - reads an unsigned 8-bit integer from little-endian byte data; overridable macro to `muu_rleu8`.
-			#ifndef MU_RLEU8
-				MUDEF inline uint8_m muu_rleu8(muByte* b) {
-					return b[0];
-				}
-				#define MU_RLEU8 muu_rleu8
-			#endif
+			// @DOCLINE * `MU_ATOMIC_ACQ_REL` - both acquire and release; only meaningful for read-modify-write operations.
 
-			// @DOCLINE * `MU_WLEU8` - writes an unsigned 8-bit integer to little-endian byte data; overridable macro to `muu_wleu8`.
-			#ifndef MU_WLEU8
-				MUDEF inline void muu_wleu8(muByte* b, uint8_m n) {
-					b[0] = n;
-				}
-				#define MU_WLEU8 muu_wleu8
-			#endif
+			// @DOCLINE * `MU_ATOMIC_SEQ_CST` - acquire and release, plus a single total order of all sequentially consistent operations across all threads.
 
-			// @DOCLINE * `MU_RLES8` - reads a signed 8-bit integer from little-endian byte data; overridable macro to `muu_rles8`.
-			#ifndef MU_RLES8
-				MUDEF inline int8_m muu_rles8(muByte* b) {
-					// I'm PRETTY sure this is okay...
-					return *(int8_m*)b;
-				}
-				#define MU_RLES8 muu_rles8
-			#endif
+			// @DOCLINE Loads should only use relaxed, acquire, or sequentially consistent ordering, and stores should only use relaxed, release, or sequentially consistent ordering. The orders should be constants, as the compiler may otherwise fall back to sequentially consistent ordering.
 
-			// @DOCLINE * `MU_WLES8` - writes a signed 8-bit integer to little-endian byte data; overridable macro to `muu_wles8`.
-			#ifndef MU_WLES8
-				MUDEF inline void muu_wles8(muByte* b, int8_m n) {
-					((int8_m*)(b))[0] = n;
-				}
-				#define MU_WLES8 muu_wles8
-			#endif
+		// @DOCLINE ## Atomic types
 
-			// @DOCLINE * `MU_RBEU8` - reads an unsigned 8-bit integer from big-endian byte data; overridable macro to `muu_rbeu8`.
-			#ifndef MU_RBEU8
-				MUDEF inline uint8_m muu_rbeu8(muByte* b) {
-					return b[0];
-				}
-				#define MU_RBEU8 muu_rbeu8
-			#endif
+			// @DOCLINE Atomic operations can only be performed on objects of the following types, which are macros:
 
-			// @DOCLINE * `MU_WBEU8` - writes an unsigned 8-bit integer to big-endian byte data; overridable macro to `muu_wbeu8`.
-			#ifndef MU_WBEU8
-				MUDEF inline void muu_wbeu8(muByte* b, uint8_m n) {
-					b[0] = n;
-				}
-				#define MU_WBEU8 muu_wbeu8
-			#endif
+			// @DOCLINE * `muAtomic32` - an atomic `uint32_m`.
 
-			// @DOCLINE * `MU_RBES8` - reads a signed 8-bit integer from big-endian byte data; overridable macro to `muu_rbes8`.
-			#ifndef MU_RBES8
-				MUDEF inline int8_m muu_rbes8(muByte* b) {
-					return *(int8_m*)b;
-				}
-				#define MU_RBES8 muu_rbes8
-			#endif
+			// @DOCLINE * `muAtomic64` - an atomic `uint64_m`.
 
-			// @DOCLINE * `MU_WBES8` - writes a signed 8-bit integer to big-endian byte data; overridable macro to `muu_wbes8`.
-			#ifndef MU_WBES8
-				MUDEF inline void muu_wbes8(muByte* b, int8_m n) {
-					((int8_m*)(b))[0] = n;
-				}
-				#define MU_WBES8 muu_wbes8
-			#endif
+			// @DOCLINE * `muAtomicPtr` - an atomic `void*`.
 
-		// @DOCLINE ## 16-bit
+			// @DOCLINE Objects of these types should only be accessed through the atomic operations below, as plain accesses are sequentially consistent with C11 atomics but not atomic at all with the other backends. They can be zero-initialized (statically, or with `mu_memset` before being shared with other threads). 64-bit atomics may be emulated with a lock by the compiler on 32-bit targets that don't support them natively.
 
-			// @DOCLINE The following macros exist for byte manipulation regarding 16-bit integers:
+		// @DOCLINE ## Atomic operations
 
-			// @DOCLINE * `MU_RLEU16` - reads an unsigned 16-bit integer from little-endian byte data; overridable macro to `muu_rleu16`.
-			#ifndef MU_RLEU16
-				MUDEF inline uint16_m muu_rleu16(muByte* b) {
-					return (
-						((uint16_m)(b[0]) << 0) |
-						((uint16_m)(b[1]) << 8)
-					);
-				}
-				#define MU_RLEU16 muu_rleu16
-			#endif
+			/* @DOCBEGIN
 
-			// @DOCLINE * `MU_WLEU16` - writes an unsigned 16-bit integer to little-endian byte data; overridable macro to `muu_wleu16`.
-			#ifndef MU_WLEU16
-				MUDEF inline void muu_wleu16(muByte* b, uint16_m n) {
-					b[0] = (uint8_m)(n >> 0);
-					b[1] = (uint8_m)(n >> 8);
+			The following macros perform atomic operations, where `N` is `32`, `64`, or `_ptr` (for example, `mu_atomic_load32`, `mu_atomic_load64`, and `mu_atomic_load_ptr`), `p` is a pointer to the respective atomic type, and `order` is a memory order:
+
+			* `mu_atomic_loadN(p, order)` - returns the value of `*p`.
+
+			* `mu_atomic_storeN(p, v, order)` - sets `*p` to `v`.
+
+			* `mu_atomic_exchangeN(p, v, order)` - sets `*p` to `v`, returning its previous value.
+
+			* `mu_atomic_casN(p, expected, desired, order)` - compares `*p` to `*expected`; if they're equal, `*p` is set to `desired` and `MU_TRUE` is returned, and if not, `*expected` is set to the value of `*p` and `MU_FALSE` is returned. The comparison never fails spuriously. If it fails, the load of `*p` uses the given order without its release part.
+
+			* `mu_atomic_fetch_addN(p, v, order)` - adds `v` to `*p` (wrapping around), returning its previous value; only defined for `32` and `64`.
+
+			* `mu_atomic_fence(order)` - a memory fence of the given order, synchronizing with other threads' fences and operations without being tied to a specific object.
+
+			* `mu_pause()` - hints to the CPU that the calling thread is spinning while waiting on another thread, using `PAUSE` on x86 and `YIELD` on ARM. This lowers power usage and frees up resources for the other hyperthread of the same core. It doesn't yield to the operating system's scheduler.
+
+			@DOCEND */
+
+			#if defined(__ATOMIC_RELAXED) && (defined(__GNUC__) || defined(__clang__))
+
+				#define MU_ATOMICS
+
+				#ifndef MU_ATOMIC_RELAXED
+					#define MU_ATOMIC_RELAXED __ATOMIC_RELAXED
+					#define MU_ATOMIC_ACQUIRE __ATOMIC_ACQUIRE
+					#define MU_ATOMIC_RELEASE __ATOMIC_RELEASE
+					#define MU_ATOMIC_ACQ_REL __ATOMIC_ACQ_REL
+					#define MU_ATOMIC_SEQ_CST __ATOMIC_SEQ_CST
+				#endif
+
+				#ifndef muAtomic32
+					#define muAtomic32 volatile uint32_m
+				#endif
+				#ifndef muAtomic64
+					#define muAtomic64 volatile uint64_m
+				#endif
+				#ifndef muAtomicPtr
+					#define muAtomicPtr void* volatile
+				#endif
+
+				// Ordering of a failed compare-and-swap, which can't have a release part
+				#define MUU_ATOMIC_FAIL(o) ((o) == __ATOMIC_ACQ_REL ? __ATOMIC_ACQUIRE : (o) == __ATOMIC_RELEASE ? __ATOMIC_RELAXED : (o))
+
+				#define MUU_ATOMIC_LOAD(p, o) __atomic_load_n(p, o)
+				#define MUU_ATOMIC_STORE(p, v, o) __atomic_store_n(p, v, o)
+				#define MUU_ATOMIC_EXCHANGE(p, v, o) __atomic_exchange_n(p, v, o)
+				#define MUU_ATOMIC_CAS(p, e, d, o) __atomic_compare_exchange_n(p, e, d, 0, o, MUU_ATOMIC_FAIL(o))
+				#define MUU_ATOMIC_FETCH_ADD(p, v, o) __atomic_fetch_add(p, v, o)
+
+				#ifndef mu_atomic_fence
+					#define mu_atomic_fence(order) __atomic_thread_fence(order)
+				#endif
+
+				#ifndef mu_pause
+					#if defined(__x86_64__) || defined(__i386__)
+						#define mu_pause() __builtin_ia32_pause()
+					#elif defined(__aarch64__) || (defined(__ARM_ARCH) && __ARM_ARCH >= 7)
+						#define mu_pause() __asm__ __volatile__("yield" ::: "memory")
+					#else
+						#define mu_pause() ((void)0)
+					#endif
+				#endif
+
+			#elif !defined(__cplusplus) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+
+				#define MU_ATOMICS
+				#include <stdatomic.h>
+
+				#ifndef MU_ATOMIC_RELAXED
+					#define MU_ATOMIC_RELAXED memory_order_relaxed
+					#define MU_ATOMIC_ACQUIRE memory_order_acquire
+					#define MU_ATOMIC_RELEASE memory_order_release
+					#define MU_ATOMIC_ACQ_REL memory_order_acq_rel
+					#define MU_ATOMIC_SEQ_CST memory_order_seq_cst
+				#endif
+
+				#ifndef muAtomic32
+					#define muAtomic32 _Atomic(uint32_m)
+				#endif
+				#ifndef muAtomic64
+					#define muAtomic64 _Atomic(uint64_m)
+				#endif
+				#ifndef muAtomicPtr
+					#define muAtomicPtr _Atomic(void*)
+				#endif
+
+				#define MUU_ATOMIC_FAIL(o) ((o) == memory_order_acq_rel ? memory_order_acquire : (o) == memory_order_release ? memory_order_relaxed : (o))
+
+				#define MUU_ATOMIC_LOAD(p, o) atomic_load_explicit(p, o)
+				#define MUU_ATOMIC_STORE(p, v, o) atomic_store_explicit(p, v, o)
+				#define MUU_ATOMIC_EXCHANGE(p, v, o) atomic_exchange_explicit(p, v, o)
+				#define MUU_ATOMIC_CAS(p, e, d, o) atomic_compare_exchange_strong_explicit(p, e, d, o, MUU_ATOMIC_FAIL(o))
+				#define MUU_ATOMIC_FETCH_ADD(p, v, o) atomic_fetch_add_explicit(p, v, o)
+
+				#ifndef mu_atomic_fence
+					#define mu_atomic_fence(order) atomic_thread_fence(order)
+				#endif
+
+				#ifndef mu_pause
+					#define mu_pause() ((void)0)
+				#endif
+
+			#else
+
+				#if defined(_MSC_VER)
+					#define MU_ATOMICS
+					#include <intrin.h>
+				#endif
+
+				#ifndef MU_ATOMIC_RELAXED
+					#define MU_ATOMIC_RELAXED 0
+					#define MU_ATOMIC_ACQUIRE 2
+					#define MU_ATOMIC_RELEASE 3
+					#define MU_ATOMIC_ACQ_REL 4
+					#define MU_ATOMIC_SEQ_CST 5
+				#endif
+
+				#ifndef muAtomic32
+					#define muAtomic32 volatile uint32_m
+				#endif
+				#ifndef muAtomic64
+					#define muAtomic64 volatile uint64_m
+				#endif
+				#ifndef muAtomicPtr
+					#define muAtomicPtr void* volatile
+				#endif
+
+				// Fence ordering plain volatile accesses around it: x86 only needs the
+				// compiler to not reorder them, while ARM needs a barrier instruction
+				#if defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
+					#define MUU_ATOMIC_BARRIER() __dmb(0xB)
+				#elif defined(_MSC_VER)
+					#define MUU_ATOMIC_BARRIER() _ReadWriteBarrier()
+				#else
+					#define MUU_ATOMIC_BARRIER() ((void)0)
+				#endif
+
+				// Interlocked functions are full barriers, so ordering is only handled for
+				// plain loads and stores. 64-bit operations on 32-bit x86 go through
+				// 'cmpxchg8b', as plain 64-bit accesses aren't atomic there.
+
+				MUDEF inline uint32_m muu_inner_atomic_load32(muAtomic32* p, int o) {
+					uint32_m v = *p;
+					if (o != MU_ATOMIC_RELAXED) {
+						MUU_ATOMIC_BARRIER();
+					}
+					return v;
 				}
-				#define MU_WLEU16 muu_wleu16
-			#endif
 
-			// @DOCLINE * `MU_RLES16` - reads a signed 16-bit integer from little-endian byte data; overridable macro to `muu_rles16`.
-			#ifndef MU_RLES16
-				MUDEF inline int16_m muu_rles16(muByte* b) {
-					uint16_m u16 = muu_rleu16(b);
-					return *(int16_m*)&u16;
+				MUDEF inline uint32_m muu_inner_atomic_exchange32(muAtomic32* p, uint32_m v, int o) {
+					(void)o;
+					#if defined(_MSC_VER)
+						return (uint32_m)_InterlockedExchange((volatile long*)p, (long)v);
+					#else
+						uint32_m old = *p;
+						*p = v;
+						return old;
+					#endif
 				}
-				#define MU_RLES16 muu_rles16
-			#endif
 
-			// @DOCLINE * `MU_WLES16` - writes a signed 16-bit integer to little-endian byte data; overridable macro to `muu_wles16`.
-			#ifndef MU_WLES16
-				MUDEF inline void muu_wles16(muByte* b, int16_m n) {
-					uint16_m un = *(uint16_m*)&n;
-					b[0] = (uint8_m)(un >> 0);
-					b[1] = (uint8_m)(un >> 8);
+				MUDEF inline void muu_inner_atomic_store32(muAtomic32* p, uint32_m v, int o) {
+					#if defined(_MSC_VER)
+						if (o == MU_ATOMIC_SEQ_CST) {
+							muu_inner_atomic_exchange32(p, v, o);
+							return;
+						}
+					#endif
+					if (o != MU_ATOMIC_RELAXED) {
+						MUU_ATOMIC_BARRIER();
+					}
+					*p = v;
 				}
-				#define MU_WLES16 muu_wles16
-			#endif
 
-			// @DOCLINE * `MU_RBEU16` - reads an unsigned 16-bit integer from big-endian byte data; overridable macro to `muu_rbeu16`.
-			#ifndef MU_RBEU16
-				MUDEF inline uint16_m muu_rbeu16(muByte* b) {
-					return (
-						((uint16_m)(b[1]) << 0) |
-						((uint16_m)(b[0]) << 8)
-					);
+				MUDEF inline muBool muu_inner_atomic_cas32(muAtomic32* p, uint32_m* e, uint32_m d, int o) {
+					(void)o;
+					#if defined(_MSC_VER)
+						uint32_m old = (uint32_m)_InterlockedCompareExchange((volatile long*)p, (long)d, (long)*e);
+					#else
+						uint32_m old = *p;
+						if (old == *e) {
+							*p = d;
+						}
+					#endif
+					if (old == *e) {
+						return MU_TRUE;
+					}
+					*e = old;
+					return MU_FALSE;
 				}
-				#define MU_RBEU16 muu_rbeu16
-			#endif
 
-			// @DOCLINE * `MU_WBEU16` - writes an unsigned 16-bit integer to big-endian byte data; overridable macro to `muu_wbeu16`.
-			#ifndef MU_WBEU16
-				MUDEF inline void muu_wbeu16(muByte* b, uint16_m n) {
-					b[1] = (uint8_m)(n >> 0);
-					b[0] = (uint8_m)(n >> 8);
+				MUDEF inline uint32_m muu_inner_atomic_fetch_add32(muAtomic32* p, uint32_m v, int o) {
+					(void)o;
+					#if defined(_MSC_VER)
+						return (uint32_m)_InterlockedExchangeAdd((volatile long*)p, (long)v);
+					#else
+						uint32_m old = *p;
+						*p = old + v;
+						return old;
+					#endif
 				}
-				#define MU_WBEU16 muu_wbeu16
-			#endif
 
-			// @DOCLINE * `MU_RBES16` - reads a signed 16-bit integer from big-endian byte data; overridable macro to `muu_rbes16`.
-			#ifndef MU_RBES16
-				MUDEF inline int16_m muu_rbes16(muByte* b) {
-					uint16_m u16 = muu_rbeu16(b);
-					return *(int16_m*)&u16;
+				MUDEF inline muBool muu_inner_atomic_cas64(muAtomic64* p, uint64_m* e, uint64_m d, int o) {
+					(void)o;
+					#if defined(_MSC_VER)
+						uint64_m old = (uint64_m)_InterlockedCompareExchange64((volatile __int64*)p, (__int64)d, (__int64)*e);
+					#else
+						uint64_m old = *p;
+						if (old == *e) {
+							*p = d;
+						}
+					#endif
+					if (old == *e) {
+						return MU_TRUE;
+					}
+					*e = old;
+					return MU_FALSE;
 				}
-				#define MU_RBES16 muu_rbes16
-			#endif
 
-			// @DOCLINE * `MU_WBES16` - writes a signed 16-bit integer to big-endian byte data; overridable macro to `muu_wbes16`.
-			#ifndef MU_WBES16
-				MUDEF inline void muu_wbes16(muByte* b, int16_m n) {
-					uint16_m un = *(uint16_m*)&n;
-					b[1] = (uint8_m)(un >> 0);
-					b[0] = (uint8_m)(un >> 8);
+				MUDEF inline uint64_m muu_inner_atomic_load64(muAtomic64* p, int o) {
+					#if defined(_MSC_VER) && defined(_M_IX86)
+						(void)o;
+						return (uint64_m)_InterlockedCompareExchange64((volatile __int64*)p, 0, 0);
+					#else
+						uint64_m v = *p;
+						if (o != MU_ATOMIC_RELAXED) {
+							MUU_ATOMIC_BARRIER();
+						}
+						return v;
+					#endif
 				}
-				#define MU_WBES16 muu_wbes16
-			#endif
 
-		// @DOCLINE ## 24-bit
+				MUDEF inline uint64_m muu_inner_atomic_exchange64(muAtomic64* p, uint64_m v, int o) {
+					#if defined(_MSC_VER) && !defined(_M_IX86)
+						(void)o;
+						return (uint64_m)_InterlockedExchange64((volatile __int64*)p, (__int64)v);
+					#else
+						uint64_m old = *p;
+						while (!muu_inner_atomic_cas64(p, &old, v, o)) {}
+						return old;
+					#endif
+				}
 
-			// @DOCLINE The following macros exist for byte manipulation regarding 24-bit integers:
+				MUDEF inline void muu_inner_atomic_store64(muAtomic64* p, uint64_m v, int o) {
+					#if defined(_MSC_VER) && defined(_M_IX86)
+						muu_inner_atomic_exchange64(p, v, o);
+					#else
+						#if defined(_MSC_VER)
+							if (o == MU_ATOMIC_SEQ_CST) {
+								muu_inner_atomic_exchange64(p, v, o);
+								return;
+							}
+						#endif
+						if (o != MU_ATOMIC_RELAXED) {
+							MUU_ATOMIC_BARRIER();
+						}
+						*p = v;
+					#endif
+				}
 
-			// @DOCLINE * `MU_RLEU24` - reads an unsigned 24-bit integer from little-endian byte data; overridable macro to `muu_rleu24`.
-			#ifndef MU_RLEU24
-				MUDEF inline uint32_m muu_rleu24(muByte* b) {
-					return (
-						((uint32_m)(b[0]) << 0) |
-						((uint32_m)(b[1]) << 8) |
-						((uint32_m)(b[2]) << 16)
-					);
+				MUDEF inline uint64_m muu_inner_atomic_fetch_add64(muAtomic64* p, uint64_m v, int o) {
+					#if defined(_MSC_VER) && !defined(_M_IX86)
+						(void)o;
+						return (uint64_m)_InterlockedExchangeAdd64((volatile __int64*)p, (__int64)v);
+					#else
+						uint64_m old = *p;
+						while (!muu_inner_atomic_cas64(p, &old, old + v, o)) {}
+						return old;
+					#endif
 				}
-				#define MU_RLEU24 muu_rleu24
-			#endif
 
-			// @DOCLINE * `MU_WLEU24` - writes an unsigned 24-bit integer to little-endian byte data; overridable macro to `muu_wleu24`.
-			#ifndef MU_WLEU24
-				MUDEF inline void muu_wleu24(muByte* b, uint32_m n) {
-					b[0] = (uint8_m)(n >> 0);
-					b[1] = (uint8_m)(n >> 8);
-					b[2] = (uint8_m)(n >> 16);
+				MUDEF inline void* muu_inner_atomic_load_ptr(muAtomicPtr* p, int o) {
+					void* v = *p;
+					if (o != MU_ATOMIC_RELAXED) {
+						MUU_ATOMIC_BARRIER();
+					}
+					return v;
 				}
-				#define MU_WLEU24 muu_wleu24
-			#endif
 
-			// @DOCLINE * `MU_RLES24` - reads a signed 24-bit integer from little-endian byte data; overridable macro to `muu_rles24`.
-			#ifndef MU_RLES24
-				MUDEF inline int32_m muu_rles24(muByte* b) {
-					uint32_m u24 = muu_rleu24(b);
-					return *(int32_m*)&u24;
+				MUDEF inline void* muu_inner_atomic_exchange_ptr(muAtomicPtr* p, void* v, int o) {
+					(void)o;
+					#if defined(_MSC_VER)
+						return _InterlockedExchangePointer((void* volatile*)p, v);
+					#else
+						void* old = *p;
+						*p = v;
+						return old;
+					#endif
 				}
-				#define MU_RLES24 muu_rles24
-			#endif
 
-			// @DOCLINE * `MU_WLES24` - writes a signed 24-bit integer to little-endian byte data; overridable macro to `muu_wles24`.
-			#ifndef MU_WLES24
-				MUDEF inline void muu_wles24(muByte* b, int32_m n) {
-					// Probably definitely doesn't work with signed integers; fix later
-					uint32_m un = *(uint32_m*)&n;
-					b[0] = (uint8_m)(un >> 0);
-					b[1] = (uint8_m)(un >> 8);
-					b[2] = (uint8_m)(un >> 16);
+				MUDEF inline void muu_inner_atomic_store_ptr(muAtomicPtr* p, void* v, int o) {
+					#if defined(_MSC_VER)
+						if (o == MU_ATOMIC_SEQ_CST) {
+							muu_inner_atomic_exchange_ptr(p, v, o);
+							return;
+						}
+					#endif
+					if (o != MU_ATOMIC_RELAXED) {
+						MUU_ATOMIC_BARRIER();
+					}
+					*p = v;
 				}
-				#define MU_WLES24 muu_wles24
-			#endif
 
-			// @DOCLINE * `MU_RBEU24` - reads an unsigned 24-bit integer from big-endian byte data; overridable macro to `muu_rbeu24`.
-			#ifndef MU_RBEU24
-				MUDEF inline uint32_m muu_rbeu24(muByte* b) {
-					return (
-						((uint32_m)(b[2]) << 0) |
-						((uint32_m)(b[1]) << 8) |
-						((uint32_m)(b[0]) << 16)
-					);
+				MUDEF inline muBool muu_inner_atomic_cas_ptr(muAtomicPtr* p, void** e, void* d, int o) {
+					(void)o;
+					#if defined(_MSC_VER)
+						void* old = _InterlockedCompareExchangePointer((void* volatile*)p, d, *e);
+					#else
+						void* old = *p;
+						if (old == *e) {
+							*p = d;
+						}
+					#endif
+					if (old == *e) {
+						return MU_TRUE;
+					}
+					*e = old;
+					return MU_FALSE;
 				}
-				#define MU_RBEU24 muu_rbeu24
-			#endif
 
-			// @DOCLINE * `MU_WBEU24` - writes an unsigned 24-bit integer to big-endian byte data; overridable macro to `muu_wbeu24`.
-			#ifndef MU_WBEU24
-				MUDEF inline void muu_wbeu24(muByte* b, uint32_m n) {
-					b[2] = (uint8_m)(n >> 0);
-					b[1] = (uint8_m)(n >> 8);
-					b[0] = (uint8_m)(n >> 16);
+				MUDEF inline void muu_inner_atomic_fence(int o) {
+					if (o == MU_ATOMIC_SEQ_CST) {
+						#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+							_mm_mfence();
+						#else
+							MUU_ATOMIC_BARRIER();
+						#endif
+					} else if (o != MU_ATOMIC_RELAXED) {
+						MUU_ATOMIC_BARRIER();
+					}
 				}
-				#define MU_WBEU24 muu_wbeu24
-			#endif
+
+				#ifndef mu_atomic_load32
+					#define mu_atomic_load32(p, order) muu_inner_atomic_load32(p, order)
+				#endif
+				#ifndef mu_atomic_store32
+					#define mu_atomic_store32(p, v, order) muu_inner_atomic_store32(p, v, order)
+				#endif
+				#ifndef mu_atomic_exchange32
+					#define mu_atomic_exchange32(p, v, order) muu_inner_atomic_exchange32(p, v, order)
+				#endif
+				#ifndef mu_atomic_cas32
+					#define mu_atomic_cas32(p, expected, desired, order) muu_inner_atomic_cas32(p, expected, desired, order)
+				#endif
+				#ifndef mu_atomic_fetch_add32
+					#define mu_atomic_fetch_add32(p, v, order) muu_inner_atomic_fetch_add32(p, v, order)
+				#endif
+				#ifndef mu_atomic_load64
+					#define mu_atomic_load64(p, order) muu_inner_atomic_load64(p, order)
+				#endif
+				#ifndef mu_atomic_store64
+					#define mu_atomic_store64(p, v, order) muu_inner_atomic_store64(p, v, order)
+				#endif
+				#ifndef mu_atomic_exchange64
+					#define mu_atomic_exchange64(p, v, order) muu_inner_atomic_exchange64(p, v, order)
+				#endif
+				#ifndef mu_atomic_cas64
+					#define mu_atomic_cas64(p, expected, desired, order) muu_inner_atomic_cas64(p, expected, desired, order)
+				#endif
+				#ifndef mu_atomic_fetch_add64
+					#define mu_atomic_fetch_add64(p, v, order) muu_inner_atomic_fetch_add64(p, v, order)
+				#endif
+				#ifndef mu_atomic_load_ptr
+					#define mu_atomic_load_ptr(p, order) muu_inner_atomic_load_ptr(p, order)
+				#endif
+				#ifndef mu_atomic_store_ptr
+					#define mu_atomic_store_ptr(p, v, order) muu_inner_atomic_store_ptr(p, v, order)
+				#endif
+				#ifndef mu_atomic_exchange_ptr
+					#define mu_atomic_exchange_ptr(p, v, order) muu_inner_atomic_exchange_ptr(p, v, order)
+				#endif
+				#ifndef mu_atomic_cas_ptr
+					#define mu_atomic_cas_ptr(p, expected, desired, order) muu_inner_atomic_cas_ptr(p, expected, desired, order)
+				#endif
+				#ifndef mu_atomic_fence
+					#define mu_atomic_fence(order) muu_inner_atomic_fence(order)
+				#endif
+
+				#ifndef mu_pause
+					#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+						#define mu_pause() _mm_pause()
+					#elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
+						#define mu_pause() __yield()
+					#else
+						#define mu_pause() ((void)0)
+					#endif
+				#endif
+
+			#endif
+
+			// The builtin backends share the same type-generic operations for every width
+			#ifdef MUU_ATOMIC_LOAD
+				#ifndef mu_atomic_load32
+					#define mu_atomic_load32(p, order) MUU_ATOMIC_LOAD(p, order)
+				#endif
+				#ifndef mu_atomic_store32
+					#define mu_atomic_store32(p, v, order) MUU_ATOMIC_STORE(p, v, order)
+				#endif
+				#ifndef mu_atomic_exchange32
+					#define mu_atomic_exchange32(p, v, order) MUU_ATOMIC_EXCHANGE(p, v, order)
+				#endif
+				#ifndef mu_atomic_cas32
+					#define mu_atomic_cas32(p, expected, desired, order) MUU_ATOMIC_CAS(p, expected, desired, order)
+				#endif
+				#ifndef mu_atomic_fetch_add32
+					#define mu_atomic_fetch_add32(p, v, order) MUU_ATOMIC_FETCH_ADD(p, v, order)
+				#endif
+				#ifndef mu_atomic_load64
+					#define mu_atomic_load64(p, order) MUU_ATOMIC_LOAD(p, order)
+				#endif
+				#ifndef mu_atomic_store64
+					#define mu_atomic_store64(p, v, order) MUU_ATOMIC_STORE(p, v, order)
+				#endif
+				#ifndef mu_atomic_exchange64
+					#define mu_atomic_exchange64(p, v, order) MUU_ATOMIC_EXCHANGE(p, v, order)
+				#endif
+				#ifndef mu_atomic_cas64
+					#define mu_atomic_cas64(p, expected, desired, order) MUU_ATOMIC_CAS(p, expected, desired, order)
+				#endif
+				#ifndef mu_atomic_fetch_add64
+					#define mu_atomic_fetch_add64(p, v, order) MUU_ATOMIC_FETCH_ADD(p, v, order)
+				#endif
+				#ifndef mu_atomic_load_ptr
+					#define mu_atomic_load_ptr(p, order) MUU_ATOMIC_LOAD(p, order)
+				#endif
+				#ifndef mu_atomic_store_ptr
+					#define mu_atomic_store_ptr(p, v, order) MUU_ATOMIC_STORE(p, v, order)
+				#endif
+				#ifndef mu_atomic_exchange_ptr
+					#define mu_atomic_exchange_ptr(p, v, order) MUU_ATOMIC_EXCHANGE(p, v, order)
+				#endif
+				#ifndef mu_atomic_cas_ptr
+					#define mu_atomic_cas_ptr(p, expected, desired, order) MUU_ATOMIC_CAS(p, expected, desired, order)
+				#endif
+			#endif
+
+		// @DOCLINE ## Spinlock
+
+			// @DOCLINE The struct `muSpinLock` is a lock that waits by spinning, with its only member being `muAtomic32 locked`, which is 0 if unlocked. A zero-initialized spinlock is unlocked.
+
+			struct muSpinLock {
+				muAtomic32 locked;
+			};
+			typedef struct muSpinLock muSpinLock;
+
+			// @DOCLINE A spinlock is meant for guarding very short critical sections under low contention, where sleeping in the operating system would cost more than waiting. It isn't fair: a thread may fail to acquire it for a long time if other threads keep acquiring it.
+
+			// @DOCLINE The function `muu_spin_lock_init` initializes a spinlock as unlocked, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_spin_lock_init(muSpinLock* l);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_spin_lock_init(muSpinLock* l) {
+				mu_atomic_store32(&l->locked, 0, MU_ATOMIC_RELAXED);
+			}
+
+			// @DOCLINE The function `muu_spin_lock` acquires a spinlock, waiting until it's unlocked if it isn't, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_spin_lock(muSpinLock* l);
+			```
+			@DOCEND */
+
+			#ifndef MU_SPIN_BACKOFF_MAX
+				#define MU_SPIN_BACKOFF_MAX 64
+			#endif
+
+			MUDEF inline void muu_spin_lock(muSpinLock* l) {
+				uint32_m backoff = 1;
+				while (mu_atomic_exchange32(&l->locked, 1, MU_ATOMIC_ACQUIRE)) {
+					// Wait with plain loads so that the cache line isn't written to while
+					// it's held, doubling the pause between attempts
+					do {
+						for (uint32_m i = 0; i < backoff; ++i) {
+							mu_pause();
+						}
+						if (backoff < MU_SPIN_BACKOFF_MAX) {
+							backoff <<= 1;
+						}
+					} while (mu_atomic_load32(&l->locked, MU_ATOMIC_RELAXED));
+				}
+			}
+
+			// @DOCLINE Between attempts, the waiting thread calls `mu_pause` a number of times that doubles after every attempt, up to `MU_SPIN_BACKOFF_MAX` (overridable, 64 by default).
+
+			// @DOCLINE The function `muu_spin_try_lock` attempts to acquire a spinlock without waiting, returning whether or not it was acquired, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_spin_try_lock(muSpinLock* l);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_spin_try_lock(muSpinLock* l) {
+				return !mu_atomic_load32(&l->locked, MU_ATOMIC_RELAXED) && !mu_atomic_exchange32(&l->locked, 1, MU_ATOMIC_ACQUIRE);
+			}
+
+			// @DOCLINE The function `muu_spin_unlock` releases a spinlock held by the calling thread, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_spin_unlock(muSpinLock* l);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_spin_unlock(muSpinLock* l) {
+				mu_atomic_store32(&l->locked, 0, MU_ATOMIC_RELEASE);
+			}
+
+		// @DOCLINE ## Ticket lock
+
+			// @DOCLINE The struct `muTicketLock` is a fair spinning lock, which is acquired by threads in the order that they began waiting on it. It has the following members:
+
+			struct muTicketLock {
+				// @DOCLINE * `muAtomic32 next` - the ticket given to the next thread to wait on the lock.
+				muAtomic32 next;
+				// @DOCLINE * `muAtomic32 serving` - the ticket of the thread currently holding the lock.
+				muAtomic32 serving;
+			};
+			typedef struct muTicketLock muTicketLock;
+
+			// @DOCLINE A zero-initialized ticket lock is unlocked. Since every waiting thread is given its turn in order, a ticket lock performs poorly if there are more waiting threads than cores, as the thread whose turn it is may not be running.
+
+			// @DOCLINE The function `muu_ticket_lock_init` initializes a ticket lock as unlocked, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_ticket_lock_init(muTicketLock* l);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_ticket_lock_init(muTicketLock* l) {
+				mu_atomic_store32(&l->next, 0, MU_ATOMIC_RELAXED);
+				mu_atomic_store32(&l->serving, 0, MU_ATOMIC_RELAXED);
+			}
+
+			// @DOCLINE The function `muu_ticket_lock` acquires a ticket lock, waiting for its turn, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_ticket_lock(muTicketLock* l);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_ticket_lock(muTicketLock* l) {
+				uint32_m ticket = mu_atomic_fetch_add32(&l->next, 1, MU_ATOMIC_RELAXED);
+				for (;;) {
+					uint32_m serving = mu_atomic_load32(&l->serving, MU_ATOMIC_ACQUIRE);
+					if (serving == ticket) {
+						return;
+					}
+					// Pause in proportion to the amount of threads ahead of this one
+					for (uint32_m i = (ticket - serving) * 8; i; --i) {
+						mu_pause();
+					}
+				}
+			}
+
+			// @DOCLINE The function `muu_ticket_try_lock` attempts to acquire a ticket lock without waiting, returning whether or not it was acquired, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_ticket_try_lock(muTicketLock* l);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_ticket_try_lock(muTicketLock* l) {
+				uint32_m serving = mu_atomic_load32(&l->serving, MU_ATOMIC_ACQUIRE);
+				uint32_m expected = serving;
+				// Only take a ticket if it would be served immediately
+				return mu_atomic_cas32(&l->next, &expected, serving + 1, MU_ATOMIC_ACQUIRE);
+			}
+
+			// @DOCLINE The function `muu_ticket_unlock` releases a ticket lock held by the calling thread, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_ticket_unlock(muTicketLock* l);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_ticket_unlock(muTicketLock* l) {
+				// Only the holder writes 'serving', so it doesn't need a read-modify-write
+				uint32_m serving = mu_atomic_load32(&l->serving, MU_ATOMIC_RELAXED);
+				mu_atomic_store32(&l->serving, serving + 1, MU_ATOMIC_RELEASE);
+			}
+
+	// @DOCLINE # CPU feature detection
+
+		// @DOCLINE The instruction set macros above only describe what the compiler is targeting. In order to allow a single binary to make use of newer instruction set extensions on machines that support them while still running on machines that don't, muUtility can also query the features of the CPU it's running on at runtime.
+
+		// @DOCLINE ## Feature flags
+
+			// @DOCLINE The following macros are flags representing CPU features, which can be bitwise-OR'd together:
+
+			// @DOCLINE * `MU_CPU_SSE2` - SSE2.
+			#define MU_CPU_SSE2 0x0001
+			// @DOCLINE * `MU_CPU_SSSE3` - SSSE3.
+			#define MU_CPU_SSSE3 0x0002
+			// @DOCLINE * `MU_CPU_SSE41` - SSE4.1.
+			#define MU_CPU_SSE41 0x0004
+			// @DOCLINE * `MU_CPU_SSE42` - SSE4.2.
+			#define MU_CPU_SSE42 0x0008
+			// @DOCLINE * `MU_CPU_POPCNT` - the `POPCNT` instruction.
+			#define MU_CPU_POPCNT 0x0010
+			// @DOCLINE * `MU_CPU_PCLMUL` - carry-less multiplication (`PCLMULQDQ`).
+			#define MU_CPU_PCLMUL 0x0020
+			// @DOCLINE * `MU_CPU_AVX` - AVX.
+			#define MU_CPU_AVX 0x0040
+			// @DOCLINE * `MU_CPU_AVX2` - AVX2.
+			#define MU_CPU_AVX2 0x0080
+			// @DOCLINE * `MU_CPU_FMA` - FMA3.
+			#define MU_CPU_FMA 0x0100
+			// @DOCLINE * `MU_CPU_F16C` - half-precision float conversion (F16C).
+			#define MU_CPU_F16C 0x0200
+			// @DOCLINE * `MU_CPU_BMI1` - BMI1.
+			#define MU_CPU_BMI1 0x0400
+			// @DOCLINE * `MU_CPU_BMI2` - BMI2.
+			#define MU_CPU_BMI2 0x0800
+			// @DOCLINE * `MU_CPU_AVX512F` - AVX-512 Foundation.
+			#define MU_CPU_AVX512F 0x1000
+			// @DOCLINE * `MU_CPU_AVX512BW` - AVX-512 byte and word instructions.
+			#define MU_CPU_AVX512BW 0x2000
+			// @DOCLINE * `MU_CPU_NEON` - ARM NEON (Advanced SIMD).
+			#define MU_CPU_NEON 0x4000
+
+			// @DOCLINE Features that rely on registers that the operating system has to save and restore (AVX, AVX2, FMA, F16C, and AVX-512) are only reported if the operating system has enabled them. On ARM, NEON is reported if it's available at compile time, which is always the case on AArch64.
+
+		// @DOCLINE ## Querying features
+
+			#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+				#define MUU_X86
+				#if defined(_MSC_VER) && !defined(__clang__)
+					#include <intrin.h>
+				#else
+					#include <cpuid.h>
+				#endif
+			#endif
+
+			// Bit of the cached features marking that detection has been performed
+			#define MUU_CPU_DETECTED 0x80000000u
+
+			#ifdef MUU_X86
+				MUDEF inline void muu_inner_cpuid(uint32_m leaf, uint32_m sub, uint32_m r[4]) {
+					#if defined(_MSC_VER) && !defined(__clang__)
+						int v[4];
+						__cpuidex(v, (int)leaf, (int)sub);
+						r[0] = (uint32_m)v[0]; r[1] = (uint32_m)v[1];
+						r[2] = (uint32_m)v[2]; r[3] = (uint32_m)v[3];
+					#else
+						unsigned int a, b, c, d;
+						__cpuid_count(leaf, sub, a, b, c, d);
+						r[0] = a; r[1] = b; r[2] = c; r[3] = d;
+					#endif
+				}
+
+				// Returns the register state enabled by the operating system (XCR0); only
+				// valid if OSXSAVE is reported
+				MUDEF inline uint64_m muu_inner_xgetbv(void) {
+					#if defined(_MSC_VER) && !defined(__clang__)
+						return (uint64_m)_xgetbv(0);
+					#else
+						uint32_m lo, hi;
+						__asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+						return ((uint64_m)hi << 32) | lo;
+					#endif
+				}
+			#endif
+
+			MUDEF inline uint32_m muu_inner_cpu_detect(void) {
+				uint32_m f = 0;
+				#ifdef MUU_X86
+					uint32_m r[4];
+					muu_inner_cpuid(0, 0, r);
+					uint32_m max = r[0];
+					if (max < 1) {
+						return 0;
+					}
+
+					muu_inner_cpuid(1, 0, r);
+					if (r[3] & (1u << 26)) f |= MU_CPU_SSE2;
+					if (r[2] & (1u <<  9)) f |= MU_CPU_SSSE3;
+					if (r[2] & (1u << 19)) f |= MU_CPU_SSE41;
+					if (r[2] & (1u << 20)) f |= MU_CPU_SSE42;
+					if (r[2] & (1u << 23)) f |= MU_CPU_POPCNT;
+					if (r[2] & (1u <<  1)) f |= MU_CPU_PCLMUL;
+
+					// YMM state (SSE and AVX bits of XCR0) and ZMM state (plus opmask and
+					// upper ZMM bits)
+					muBool ymm = MU_FALSE, zmm = MU_FALSE;
+					if ((r[2] & (1u << 27)) && (r[2] & (1u << 28))) {
+						uint64_m xcr0 = muu_inner_xgetbv();
+						ymm = (xcr0 & 0x06) == 0x06;
+						zmm = (xcr0 & 0xE6) == 0xE6;
+					}
+					if (ymm) {
+						f |= MU_CPU_AVX;
+						if (r[2] & (1u << 12)) f |= MU_CPU_FMA;
+						if (r[2] & (1u << 29)) f |= MU_CPU_F16C;
+					}
+
+					if (max >= 7) {
+						muu_inner_cpuid(7, 0, r);
+						if (r[1] & (1u << 3)) f |= MU_CPU_BMI1;
+						if (r[1] & (1u << 8)) f |= MU_CPU_BMI2;
+						if (ymm && (r[1] & (1u << 5))) f |= MU_CPU_AVX2;
+						if (zmm && (r[1] & (1u << 16))) {
+							f |= MU_CPU_AVX512F;
+							if (r[1] & (1u << 30)) f |= MU_CPU_AVX512BW;
+						}
+					}
+				#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+					f |= MU_CPU_NEON;
+				#endif
+				return f;
+			}
+
+			// Cached features; 0 until detection has been performed
+			MUDEF inline muAtomic32* muu_inner_cpu_cache(void) {
+				static muAtomic32 features;
+				return &features;
+			}
+
+			// @DOCLINE The function `muu_cpu_features` returns the features of the CPU, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint32_m muu_cpu_features(void);
+			```
+			@DOCEND */
+
+			MUDEF inline uint32_m muu_cpu_features(void) {
+				muAtomic32* c = muu_inner_cpu_cache();
+				uint32_m f = mu_atomic_load32(c, MU_ATOMIC_RELAXED);
+				if (!f) {
+					// Detection is idempotent, so threads racing here all store the same value
+					f = muu_inner_cpu_detect() | MUU_CPU_DETECTED;
+					mu_atomic_store32(c, f, MU_ATOMIC_RELAXED);
+				}
+				return f & ~MUU_CPU_DETECTED;
+			}
+
+			// @DOCLINE Detection is performed upon the first call, and its result is cached, making subsequent calls a single load.
+
+			// @DOCLINE The function `muu_cpu_has` checks if the CPU supports all of the given features, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_cpu_has(uint32_m features);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_cpu_has(uint32_m features) {
+				return (muu_cpu_features() & features) == features;
+			}
+
+			// @DOCLINE The function `muu_cpu_set_features` overrides the features reported by the functions above, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_cpu_set_features(uint32_m features);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_cpu_set_features(uint32_m features) {
+				mu_atomic_store32(muu_inner_cpu_cache(), features | MUU_CPU_DETECTED, MU_ATOMIC_RELAXED);
+			}
+
+			// @DOCLINE This is meant for testing and benchmarking fallback code paths (for example, `muu_cpu_set_features(muu_cpu_features() & ~MU_CPU_AVX2)` disables every AVX2 path chosen at runtime). Features enabled at compile time (see `MU_SSE2`, `MU_SSSE3`, and `MU_AVX2`) are always used regardless of this value; setting features that the CPU doesn't support leads to illegal instructions.
+
+		// @DOCLINE ## Runtime dispatch
+
+			/* @DOCBEGIN
+
+			The macro `MU_TARGET(isa)` is placed before a function's return type in order to compile that function for the given instruction set extension(s) (using `__attribute__((target(isa)))` on GCC and Clang), even if the rest of the code isn't, allowing it to use the respective intrinsics. MSVC allows intrinsics to be used anywhere, so the macro expands to nothing there. For example:
+
+			```c
+			MU_TARGET("avx2") void sum_avx2(const uint32_m* n, size_m len);
+			```
+
+			The macro `MU_CPU_DISPATCH` is defined (if `MU_NO_CPU_DISPATCH` isn't defined) when the compiler is targeting x86 with `MU_SSE2` defined but `MU_AVX2` not defined, and supports `MU_TARGET`. When it's defined, muUtility's SSSE3 and AVX2 code paths are compiled regardless of the instruction set macros, and are chosen at runtime with `muu_cpu_has` (which is a single cached load and branch per call of a bulk function). Their respective intrinsic headers are included as well.
+
+			The recommended way for mu libraries and users to dispatch their own bulk kernels is to compile each variant with `MU_TARGET`, and bind a function pointer to the best one once at startup:
+
+			```c
+			typedef void (*sum_func)(const uint32_m* n, size_m len);
+			sum_func sum = sum_scalar;
+
+			void init(void) {
+				if (muu_cpu_has(MU_CPU_AVX2)) {
+					sum = sum_avx2;
+				}
+			}
+			```
+
+			@DOCEND */
+
+			#ifndef MU_TARGET
+				#if defined(__GNUC__) || defined(__clang__)
+					#define MU_TARGET(isa) __attribute__((target(isa)))
+				#else
+					#define MU_TARGET(isa)
+				#endif
+			#endif
+
+			#if !defined(MU_NO_CPU_DISPATCH) && !defined(MU_CPU_DISPATCH) && defined(MUU_X86) && defined(MU_SSE2) && !defined(MU_AVX2)
+				#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+					#define MU_CPU_DISPATCH
+					#include <tmmintrin.h>
+					#include <immintrin.h>
+				#endif
+			#endif
+
+	// @DOCLINE # Endianness recognition
+
+		/* @DOCBEGIN
+
+		The macros `MU_LITTLE_ENDIAN` or `MU_BIG_ENDIAN` are defined (if neither were defined before) in order to allow mu libraries to check the byte order of the system they're running on.
+
+		`MU_LITTLE_ENDIAN` will be defined if `__BYTE_ORDER__` is defined as `__ORDER_LITTLE_ENDIAN__`, or if the compiler is targeting x86, x86-64, or ARM with MSVC, or if `__LITTLE_ENDIAN__` is defined.
+
+		`MU_BIG_ENDIAN` will be defined if `__BYTE_ORDER__` is defined as `__ORDER_BIG_ENDIAN__`, or if `__BIG_ENDIAN__` is defined.
+
+		If neither could be determined, neither is defined, and mu code that relies on the byte order of the system falls back to portable byte-by-byte implementations.
+
+		@DOCEND */
+
+		#if !defined(MU_LITTLE_ENDIAN) && !defined(MU_BIG_ENDIAN)
+			#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+				#define MU_LITTLE_ENDIAN
+			#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+				#define MU_BIG_ENDIAN
+			#elif defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM) || defined(_M_ARM64) || defined(__LITTLE_ENDIAN__)
+				#define MU_LITTLE_ENDIAN
+			#elif defined(__BIG_ENDIAN__)
+				#define MU_BIG_ENDIAN
+			#endif
+		#endif
+
+	// @DOCLINE # Byte manipulation
+
+		// @DOCLINE muUtility defines several inline functions that read a value from a given array of bytes. Internally, they're all defined with the prefix `muu_...`, and then a macro is defined for them as `MU_...` (with change in capitalization after the prefix as well). The macros for these functions can be overridden, and, in such case, the original function will go undefined. For example, the function `muu_rleu8` is primarily referenced via the macro `MU_RLEU8`, and if `MU_RLEU8` is overridden, `muu_rleu8` is never defined and is not referenceable.
+
+		// @DOCLINE All reading functions take in a pointer of bytes as their only parameter and have a return type of the fixed-width size of bits in question; for example, `muu_rleu8` is defined as:
+
+		/* @DOCBEGIN
+		```
+		MUDEF inline uint8_m muu_rleu8(muByte* b);
+		```
+		@DOCEND */
+
+		// @DOCLINE All writing functions take in a pointer of bytes as their first parameter, the number to be written as the second parameter, and have a return type of void; for example, `muu_wleu8` is defined as:
+
+		/* @DOCBEGIN
+		```
+		MUDEF inline void muu_wleu8(muByte* b, uint8_m n);
+		```
+		@DOCEND */
+
+		// @DOCLINE The exception to this is 24-bit, in which case, the fixed-width types are 32-bit (`uint32_m` / `int32_m`).
+
+		// @DOCLINE ## Byte type
+
+			// @DOCLINE muUtility defines the type `muByte` to refer to a byte. It is defined as `uint8_m`, and is overridable.
+			#ifndef muByte
+				#define muByte uint8_m
+			#endif
+
+		// @DOCLINE ## Byte swapping
+
+			// @DOCLINE muUtility defines several inline functions that reverse the byte order of a fixed-width integer, which map to the compiler's byte-swap intrinsic when available (`__builtin_bswap...` on GCC and Clang, `_byteswap_...` on MSVC), and fall back to shifts otherwise. They take in the integer as their only parameter and return the byte-swapped integer. The single-value byte manipulation functions use these, alongside `mu_memcpy` for unaligned loads and stores, when the byte order of the system is known (see `MU_LITTLE_ENDIAN` and `MU_BIG_ENDIAN`), so that a read of data whose byte order matches the system compiles to a single load, and a read of data whose byte order doesn't compiles to a load and a byte swap.
+
+			#if defined(_MSC_VER) && !defined(__clang__)
+				#include <stdlib.h>
+			#endif
+
+			// @DOCLINE * `MU_BSWAP16` - reverses the byte order of an unsigned 16-bit integer; overridable macro to `muu_bswap16`.
+			#ifndef MU_BSWAP16
+				MUDEF inline uint16_m muu_bswap16(uint16_m n) {
+					#if defined(__GNUC__) || defined(__clang__)
+						return __builtin_bswap16(n);
+					#elif defined(_MSC_VER)
+						return _byteswap_ushort(n);
+					#else
+						return (uint16_m)((n >> 8) | (n << 8));
+					#endif
+				}
+				#define MU_BSWAP16 muu_bswap16
+			#endif
+
+			// @DOCLINE * `MU_BSWAP32` - reverses the byte order of an unsigned 32-bit integer; overridable macro to `muu_bswap32`.
+			#ifndef MU_BSWAP32
+				MUDEF inline uint32_m muu_bswap32(uint32_m n) {
+					#if defined(__GNUC__) || defined(__clang__)
+						return __builtin_bswap32(n);
+					#elif defined(_MSC_VER)
+						return _byteswap_ulong(n);
+					#else
+						return (
+							((n & 0x000000FF) << 24) |
+							((n & 0x0000FF00) << 8)  |
+							((n & 0x00FF0000) >> 8)  |
+							((n & 0xFF000000) >> 24)
+						);
+					#endif
+				}
+				#define MU_BSWAP32 muu_bswap32
+			#endif
+
+			// @DOCLINE * `MU_BSWAP64` - reverses the byte order of an unsigned 64-bit integer; overridable macro to `muu_bswap64`.
+			#ifndef MU_BSWAP64
+				MUDEF inline uint64_m muu_bswap64(uint64_m n) {
+					#if defined(__GNUC__) || defined(__clang__)
+						return __builtin_bswap64(n);
+					#elif defined(_MSC_VER)
+						return _byteswap_uint64(n);
+					#else
+						return (
+							((uint64_m)MU_BSWAP32((uint32_m)(n)) << 32) |
+							((uint64_m)MU_BSWAP32((uint32_m)(n >> 32)))
+						);
+					#endif
+				}
+				#define MU_BSWAP64 muu_bswap64
+			#endif
+
+		// @DOCLINE ## 24-bit over-reading
+
+			// @DOCLINE 24-bit values have no matching load instruction, so by default, the 24-bit reading functions assemble the value from three separate bytes. If `MU_24BIT_OVERREAD` is defined before the inclusion of muUtility, and the byte order of the system is known, the 24-bit reading functions instead perform a single 32-bit load and mask out the extra byte; this means that they read one byte past the end of the 24-bit value, so this should only be defined if the caller guarantees that every 24-bit value read is followed by at least one more readable byte.
+
+		// @DOCLINE ## 8-bit
+
+			// @DOCLINE The following macros exist for byte manipulation regarding 8-bit integers:
+
+			// @DOCLINE * `MU_RLEU8` - reads an unsigned 8-bit integer from little-endian byte data; overridable macro to `muu_rleu8`.
+			#ifndef MU_RLEU8
+				MUDEF inline uint8_m muu_rleu8(muByte* b) {
+					return b[0];
+				}
+				#define MU_RLEU8 muu_rleu8
+			#endif
+
+			// @DOCLINE * `MU_WLEU8` - writes an unsigned 8-bit integer to little-endian byte data; overridable macro to `muu_wleu8`.
+			#ifndef MU_WLEU8
+				MUDEF inline void muu_wleu8(muByte* b, uint8_m n) {
+					b[0] = n;
+				}
+				#define MU_WLEU8 muu_wleu8
+			#endif
+
+			// @DOCLINE * `MU_RLES8` - reads a signed 8-bit integer from little-endian byte data; overridable macro to `muu_rles8`.
+			#ifndef MU_RLES8
+				MUDEF inline int8_m muu_rles8(muByte* b) {
+					// I'm PRETTY sure this is okay...
+					return *(int8_m*)b;
+				}
+				#define MU_RLES8 muu_rles8
+			#endif
+
+			// @DOCLINE * `MU_WLES8` - writes a signed 8-bit integer to little-endian byte data; overridable macro to `muu_wles8`.
+			#ifndef MU_WLES8
+				MUDEF inline void muu_wles8(muByte* b, int8_m n) {
+					((int8_m*)(b))[0] = n;
+				}
+				#define MU_WLES8 muu_wles8
+			#endif
+
+			// @DOCLINE * `MU_RBEU8` - reads an unsigned 8-bit integer from big-endian byte data; overridable macro to `muu_rbeu8`.
+			#ifndef MU_RBEU8
+				MUDEF inline uint8_m muu_rbeu8(muByte* b) {
+					return b[0];
+				}
+				#define MU_RBEU8 muu_rbeu8
+			#endif
+
+			// @DOCLINE * `MU_WBEU8` - writes an unsigned 8-bit integer to big-endian byte data; overridable macro to `muu_wbeu8`.
+			#ifndef MU_WBEU8
+				MUDEF inline void muu_wbeu8(muByte* b, uint8_m n) {
+					b[0] = n;
+				}
+				#define MU_WBEU8 muu_wbeu8
+			#endif
+
+			// @DOCLINE * `MU_RBES8` - reads a signed 8-bit integer from big-endian byte data; overridable macro to `muu_rbes8`.
+			#ifndef MU_RBES8
+				MUDEF inline int8_m muu_rbes8(muByte* b) {
+					return *(int8_m*)b;
+				}
+				#define MU_RBES8 muu_rbes8
+			#endif
+
+			// @DOCLINE * `MU_WBES8` - writes a signed 8-bit integer to big-endian byte data; overridable macro to `muu_wbes8`.
+			#ifndef MU_WBES8
+				MUDEF inline void muu_wbes8(muByte* b, int8_m n) {
+					((int8_m*)(b))[0] = n;
+				}
+				#define MU_WBES8 muu_wbes8
+			#endif
+
+		// @DOCLINE ## 16-bit
+
+			// @DOCLINE The following macros exist for byte manipulation regarding 16-bit integers:
+
+			// @DOCLINE * `MU_RLEU16` - reads an unsigned 16-bit integer from little-endian byte data; overridable macro to `muu_rleu16`.
+			#ifndef MU_RLEU16
+				MUDEF inline uint16_m muu_rleu16(muByte* b) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						uint16_m n;
+						mu_memcpy(&n, b, 2);
+						#ifdef MU_BIG_ENDIAN
+							n = MU_BSWAP16(n);
+						#endif
+						return n;
+					#else
+						return (
+							((uint16_m)(b[0]) << 0) |
+							((uint16_m)(b[1]) << 8)
+						);
+					#endif
+				}
+				#define MU_RLEU16 muu_rleu16
+			#endif
+
+			// @DOCLINE * `MU_WLEU16` - writes an unsigned 16-bit integer to little-endian byte data; overridable macro to `muu_wleu16`.
+			#ifndef MU_WLEU16
+				MUDEF inline void muu_wleu16(muByte* b, uint16_m n) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						#ifdef MU_BIG_ENDIAN
+							n = MU_BSWAP16(n);
+						#endif
+						mu_memcpy(b, &n, 2);
+					#else
+						b[0] = (uint8_m)(n >> 0);
+						b[1] = (uint8_m)(n >> 8);
+					#endif
+				}
+				#define MU_WLEU16 muu_wleu16
+			#endif
+
+			// @DOCLINE * `MU_RLES16` - reads a signed 16-bit integer from little-endian byte data; overridable macro to `muu_rles16`.
+			#ifndef MU_RLES16
+				MUDEF inline int16_m muu_rles16(muByte* b) {
+					uint16_m u16 = MU_RLEU16(b);
+					return *(int16_m*)&u16;
+				}
+				#define MU_RLES16 muu_rles16
+			#endif
+
+			// @DOCLINE * `MU_WLES16` - writes a signed 16-bit integer to little-endian byte data; overridable macro to `muu_wles16`.
+			#ifndef MU_WLES16
+				MUDEF inline void muu_wles16(muByte* b, int16_m n) {
+					MU_WLEU16(b, *(uint16_m*)&n);
+				}
+				#define MU_WLES16 muu_wles16
+			#endif
+
+			// @DOCLINE * `MU_RBEU16` - reads an unsigned 16-bit integer from big-endian byte data; overridable macro to `muu_rbeu16`.
+			#ifndef MU_RBEU16
+				MUDEF inline uint16_m muu_rbeu16(muByte* b) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						uint16_m n;
+						mu_memcpy(&n, b, 2);
+						#ifdef MU_LITTLE_ENDIAN
+							n = MU_BSWAP16(n);
+						#endif
+						return n;
+					#else
+						return (
+							((uint16_m)(b[1]) << 0) |
+							((uint16_m)(b[0]) << 8)
+						);
+					#endif
+				}
+				#define MU_RBEU16 muu_rbeu16
+			#endif
+
+			// @DOCLINE * `MU_WBEU16` - writes an unsigned 16-bit integer to big-endian byte data; overridable macro to `muu_wbeu16`.
+			#ifndef MU_WBEU16
+				MUDEF inline void muu_wbeu16(muByte* b, uint16_m n) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						#ifdef MU_LITTLE_ENDIAN
+							n = MU_BSWAP16(n);
+						#endif
+						mu_memcpy(b, &n, 2);
+					#else
+						b[1] = (uint8_m)(n >> 0);
+						b[0] = (uint8_m)(n >> 8);
+					#endif
+				}
+				#define MU_WBEU16 muu_wbeu16
+			#endif
+
+			// @DOCLINE * `MU_RBES16` - reads a signed 16-bit integer from big-endian byte data; overridable macro to `muu_rbes16`.
+			#ifndef MU_RBES16
+				MUDEF inline int16_m muu_rbes16(muByte* b) {
+					uint16_m u16 = MU_RBEU16(b);
+					return *(int16_m*)&u16;
+				}
+				#define MU_RBES16 muu_rbes16
+			#endif
+
+			// @DOCLINE * `MU_WBES16` - writes a signed 16-bit integer to big-endian byte data; overridable macro to `muu_wbes16`.
+			#ifndef MU_WBES16
+				MUDEF inline void muu_wbes16(muByte* b, int16_m n) {
+					MU_WBEU16(b, *(uint16_m*)&n);
+				}
+				#define MU_WBES16 muu_wbes16
+			#endif
+
+		// @DOCLINE ## 24-bit
+
+			// @DOCLINE The following macros exist for byte manipulation regarding 24-bit integers:
+
+			// @DOCLINE * `MU_RLEU24` - reads an unsigned 24-bit integer from little-endian byte data; overridable macro to `muu_rleu24`.
+			#ifndef MU_RLEU24
+				MUDEF inline uint32_m muu_rleu24(muByte* b) {
+					#if defined(MU_24BIT_OVERREAD) && (defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN))
+						uint32_m n;
+						mu_memcpy(&n, b, 4);
+						#ifdef MU_LITTLE_ENDIAN
+							return n & 0x00FFFFFF;
+						#else
+							return MU_BSWAP32(n) & 0x00FFFFFF;
+						#endif
+					#else
+						return (
+							((uint32_m)(b[0]) << 0) |
+							((uint32_m)(b[1]) << 8) |
+							((uint32_m)(b[2]) << 16)
+						);
+					#endif
+				}
+				#define MU_RLEU24 muu_rleu24
+			#endif
+
+			// @DOCLINE * `MU_WLEU24` - writes an unsigned 24-bit integer to little-endian byte data; overridable macro to `muu_wleu24`.
+			#ifndef MU_WLEU24
+				MUDEF inline void muu_wleu24(muByte* b, uint32_m n) {
+					b[0] = (uint8_m)(n >> 0);
+					b[1] = (uint8_m)(n >> 8);
+					b[2] = (uint8_m)(n >> 16);
+				}
+				#define MU_WLEU24 muu_wleu24
+			#endif
+
+			// @DOCLINE * `MU_RLES24` - reads a signed 24-bit integer from little-endian byte data; overridable macro to `muu_rles24`.
+			#ifndef MU_RLES24
+				MUDEF inline int32_m muu_rles24(muByte* b) {
+					// Sign-extend from bit 23
+					uint32_m u24 = (MU_RLEU24(b) ^ 0x00800000) - 0x00800000;
+					return *(int32_m*)&u24;
+				}
+				#define MU_RLES24 muu_rles24
+			#endif
+
+			// @DOCLINE * `MU_WLES24` - writes a signed 24-bit integer to little-endian byte data; overridable macro to `muu_wles24`.
+			#ifndef MU_WLES24
+				MUDEF inline void muu_wles24(muByte* b, int32_m n) {
+					// Two's complement keeps the lower 24 bits of a value in range correct
+					uint32_m un = *(uint32_m*)&n;
+					b[0] = (uint8_m)(un >> 0);
+					b[1] = (uint8_m)(un >> 8);
+					b[2] = (uint8_m)(un >> 16);
+				}
+				#define MU_WLES24 muu_wles24
+			#endif
+
+			// @DOCLINE * `MU_RBEU24` - reads an unsigned 24-bit integer from big-endian byte data; overridable macro to `muu_rbeu24`.
+			#ifndef MU_RBEU24
+				MUDEF inline uint32_m muu_rbeu24(muByte* b) {
+					#if defined(MU_24BIT_OVERREAD) && (defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN))
+						uint32_m n;
+						mu_memcpy(&n, b, 4);
+						#ifdef MU_LITTLE_ENDIAN
+							return MU_BSWAP32(n) >> 8;
+						#else
+							return n >> 8;
+						#endif
+					#else
+						return (
+							((uint32_m)(b[2]) << 0) |
+							((uint32_m)(b[1]) << 8) |
+							((uint32_m)(b[0]) << 16)
+						);
+					#endif
+				}
+				#define MU_RBEU24 muu_rbeu24
+			#endif
+
+			// @DOCLINE * `MU_WBEU24` - writes an unsigned 24-bit integer to big-endian byte data; overridable macro to `muu_wbeu24`.
+			#ifndef MU_WBEU24
+				MUDEF inline void muu_wbeu24(muByte* b, uint32_m n) {
+					b[2] = (uint8_m)(n >> 0);
+					b[1] = (uint8_m)(n >> 8);
+					b[0] = (uint8_m)(n >> 16);
+				}
+				#define MU_WBEU24 muu_wbeu24
+			#endif
 
 			// @DOCLINE * `MU_RBES24` - reads a signed 24-bit integer from big-endian byte data; overridable macro to `muu_rbes24`.
 			#ifndef MU_RBES24
 				MUDEF inline int32_m muu_rbes24(muByte* b) {
-					uint32_m u24 = muu_rbeu24(b);
+					// Sign-extend from bit 23
+					uint32_m u24 = (MU_RBEU24(b) ^ 0x00800000) - 0x00800000;
 					return *(int32_m*)&u24;
 				}
-				#define MU_RBES24 muu_rbes24
+				#define MU_RBES24 muu_rbes24
+			#endif
+
+			// @DOCLINE * `MU_WBES24` - writes a signed 24-bit integer to big-endian byte data; overridable macro to `muu_wbes24`.
+			#ifndef MU_WBES24
+				MUDEF inline void muu_wbes24(muByte* b, int32_m n) {
+					uint32_m un = *(uint32_m*)&n;
+					b[2] = (uint8_m)(un >> 0);
+					b[1] = (uint8_m)(un >> 8);
+					b[0] = (uint8_m)(un >> 16);
+				}
+				#define MU_WBES24 muu_wbes24
+			#endif
+
+		// @DOCLINE ## 32-bit
+
+			// @DOCLINE The following macros exist for byte manipulation regarding 32-bit integers:
+
+			// @DOCLINE * `MU_RLEU32` - reads an unsigned 32-bit integer from little-endian byte data; overridable macro to `muu_rleu32`.
+			#ifndef MU_RLEU32
+				MUDEF inline uint32_m muu_rleu32(muByte* b) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						uint32_m n;
+						mu_memcpy(&n, b, 4);
+						#ifdef MU_BIG_ENDIAN
+							n = MU_BSWAP32(n);
+						#endif
+						return n;
+					#else
+						return (
+							((uint32_m)(b[0]) << 0)  |
+							((uint32_m)(b[1]) << 8)  |
+							((uint32_m)(b[2]) << 16) |
+							((uint32_m)(b[3]) << 24)
+						);
+					#endif
+				}
+				#define MU_RLEU32 muu_rleu32
+			#endif
+
+			// @DOCLINE * `MU_WLEU32` - writes an unsigned 32-bit integer to little-endian byte data; overridable macro to `muu_wleu32`.
+			#ifndef MU_WLEU32
+				MUDEF inline void muu_wleu32(muByte* b, uint32_m n) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						#ifdef MU_BIG_ENDIAN
+							n = MU_BSWAP32(n);
+						#endif
+						mu_memcpy(b, &n, 4);
+					#else
+						b[0] = (uint8_m)(n >> 0);
+						b[1] = (uint8_m)(n >> 8);
+						b[2] = (uint8_m)(n >> 16);
+						b[3] = (uint8_m)(n >> 24);
+					#endif
+				}
+				#define MU_WLEU32 muu_wleu32
+			#endif
+
+			// @DOCLINE * `MU_RLES32` - reads a signed 32-bit integer from little-endian byte data; overridable macro to `muu_rles32`.
+			#ifndef MU_RLES32
+				MUDEF inline int32_m muu_rles32(muByte* b) {
+					uint32_m u32 = MU_RLEU32(b);
+					return *(int32_m*)&u32;
+				}
+				#define MU_RLES32 muu_rles32
+			#endif
+
+			// @DOCLINE * `MU_WLES32` - writes a signed 32-bit integer to little-endian byte data; overridable macro to `muu_wles32`.
+			#ifndef MU_WLES32
+				MUDEF inline void muu_wles32(muByte* b, int32_m n) {
+					MU_WLEU32(b, *(uint32_m*)&n);
+				}
+				#define MU_WLES32 muu_wles32
+			#endif
+
+			// @DOCLINE * `MU_RBEU32` - reads an unsigned 32-bit integer from big-endian byte data; overridable macro to `muu_rbeu32`.
+			#ifndef MU_RBEU32
+				MUDEF inline uint32_m muu_rbeu32(muByte* b) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						uint32_m n;
+						mu_memcpy(&n, b, 4);
+						#ifdef MU_LITTLE_ENDIAN
+							n = MU_BSWAP32(n);
+						#endif
+						return n;
+					#else
+						return (
+							((uint32_m)(b[3]) << 0)  |
+							((uint32_m)(b[2]) << 8)  |
+							((uint32_m)(b[1]) << 16) |
+							((uint32_m)(b[0]) << 24)
+						);
+					#endif
+				}
+				#define MU_RBEU32 muu_rbeu32
+			#endif
+
+			// @DOCLINE * `MU_WBEU32` - writes an unsigned 32-bit integer to big-endian byte data; overridable macro to `muu_wbeu32`.
+			#ifndef MU_WBEU32
+				MUDEF inline void muu_wbeu32(muByte* b, uint32_m n) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						#ifdef MU_LITTLE_ENDIAN
+							n = MU_BSWAP32(n);
+						#endif
+						mu_memcpy(b, &n, 4);
+					#else
+						b[3] = (uint8_m)(n >> 0);
+						b[2] = (uint8_m)(n >> 8);
+						b[1] = (uint8_m)(n >> 16);
+						b[0] = (uint8_m)(n >> 24);
+					#endif
+				}
+				#define MU_WBEU32 muu_wbeu32
+			#endif
+
+			// @DOCLINE * `MU_RBES32` - reads a signed 32-bit integer from big-endian byte data; overridable macro to `muu_rbes32`.
+			#ifndef MU_RBES32
+				MUDEF inline int32_m muu_rbes32(muByte* b) {
+					uint32_m u32 = MU_RBEU32(b);
+					return *(int32_m*)&u32;
+				}
+				#define MU_RBES32 muu_rbes32
+			#endif
+
+			// @DOCLINE * `MU_WBES32` - writes a signed 32-bit integer to big-endian byte data; overridable macro to `muu_wbes32`.
+			#ifndef MU_WBES32
+				MUDEF inline void muu_wbes32(muByte* b, int32_m n) {
+					MU_WBEU32(b, *(uint32_m*)&n);
+				}
+				#define MU_WBES32 muu_wbes32
+			#endif
+
+		// @DOCLINE ## 64-bit
+
+			// @DOCLINE The following macros exist for byte manipulation regarding 64-bit integers:
+
+			// @DOCLINE * `MU_RLEU64` - reads an unsigned 64-bit integer from little-endian byte data; overridable macro to `muu_rleu64`.
+			#ifndef MU_RLEU64
+				MUDEF inline uint64_m muu_rleu64(muByte* b) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						uint64_m n;
+						mu_memcpy(&n, b, 8);
+						#ifdef MU_BIG_ENDIAN
+							n = MU_BSWAP64(n);
+						#endif
+						return n;
+					#else
+						return (
+							((uint64_m)(b[0]) << 0)  |
+							((uint64_m)(b[1]) << 8)  |
+							((uint64_m)(b[2]) << 16) |
+							((uint64_m)(b[3]) << 24) |
+							((uint64_m)(b[4]) << 32) |
+							((uint64_m)(b[5]) << 40) |
+							((uint64_m)(b[6]) << 48) |
+							((uint64_m)(b[7]) << 56)
+						);
+					#endif
+				}
+				#define MU_RLEU64 muu_rleu64
+			#endif
+
+			// @DOCLINE * `MU_WLEU64` - writes an unsigned 64-bit integer to little-endian byte data; overridable macro to `muu_wleu64`.
+			#ifndef MU_WLEU64
+				MUDEF inline void muu_wleu64(muByte* b, uint64_m n) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						#ifdef MU_BIG_ENDIAN
+							n = MU_BSWAP64(n);
+						#endif
+						mu_memcpy(b, &n, 8);
+					#else
+						b[0] = (uint8_m)(n >> 0);
+						b[1] = (uint8_m)(n >> 8);
+						b[2] = (uint8_m)(n >> 16);
+						b[3] = (uint8_m)(n >> 24);
+						b[4] = (uint8_m)(n >> 32);
+						b[5] = (uint8_m)(n >> 40);
+						b[6] = (uint8_m)(n >> 48);
+						b[7] = (uint8_m)(n >> 56);
+					#endif
+				}
+				#define MU_WLEU64 muu_wleu64
+			#endif
+
+			// @DOCLINE * `MU_RLES64` - reads a signed 64-bit integer from little-endian byte data; overridable macro to `muu_rles64`.
+			#ifndef MU_RLES64
+				MUDEF inline int64_m muu_rles64(muByte* b) {
+					uint64_m u64 = MU_RLEU64(b);
+					return *(int64_m*)&u64;
+				}
+				#define MU_RLES64 muu_rles64
+			#endif
+
+			// @DOCLINE * `MU_WLES64` - writes a signed 64-bit integer to little-endian byte data; overridable macro to `muu_wles64`.
+			#ifndef MU_WLES64
+				MUDEF inline void muu_wles64(muByte* b, int64_m n) {
+					MU_WLEU64(b, *(uint64_m*)&n);
+				}
+				#define MU_WLES64 muu_wles64
+			#endif
+
+			// @DOCLINE * `MU_RBEU64` - reads an unsigned 64-bit integer from big-endian byte data; overridable macro to `muu_rbeu64`.
+			#ifndef MU_RBEU64
+				MUDEF inline uint64_m muu_rbeu64(muByte* b) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						uint64_m n;
+						mu_memcpy(&n, b, 8);
+						#ifdef MU_LITTLE_ENDIAN
+							n = MU_BSWAP64(n);
+						#endif
+						return n;
+					#else
+						return (
+							((uint64_m)(b[7]) << 0)  |
+							((uint64_m)(b[6]) << 8)  |
+							((uint64_m)(b[5]) << 16) |
+							((uint64_m)(b[4]) << 24) |
+							((uint64_m)(b[3]) << 32) |
+							((uint64_m)(b[2]) << 40) |
+							((uint64_m)(b[1]) << 48) |
+							((uint64_m)(b[0]) << 56)
+						);
+					#endif
+				}
+				#define MU_RBEU64 muu_rbeu64
+			#endif
+
+			// @DOCLINE * `MU_WBEU64` - writes an unsigned 64-bit integer to big-endian byte data; overridable macro to `muu_wbeu64`.
+			#ifndef MU_WBEU64
+				MUDEF inline void muu_wbeu64(muByte* b, uint64_m n) {
+					#if defined(MU_LITTLE_ENDIAN) || defined(MU_BIG_ENDIAN)
+						#ifdef MU_LITTLE_ENDIAN
+							n = MU_BSWAP64(n);
+						#endif
+						mu_memcpy(b, &n, 8);
+					#else
+						b[7] = (uint8_m)(n >> 0);
+						b[6] = (uint8_m)(n >> 8);
+						b[5] = (uint8_m)(n >> 16);
+						b[4] = (uint8_m)(n >> 24);
+						b[3] = (uint8_m)(n >> 32);
+						b[2] = (uint8_m)(n >> 40);
+						b[1] = (uint8_m)(n >> 48);
+						b[0] = (uint8_m)(n >> 56);
+					#endif
+				}
+				#define MU_WBEU64 muu_wbeu64
+			#endif
+
+			// @DOCLINE * `MU_RBES64` - reads a signed 64-bit integer from big-endian byte data; overridable macro to `muu_rbes64`.
+			#ifndef MU_RBES64
+				MUDEF inline int64_m muu_rbes64(muByte* b) {
+					uint64_m u64 = MU_RBEU64(b);
+					return *(int64_m*)&u64;
+				}
+				#define MU_RBES64 muu_rbes64
+			#endif
+
+			// @DOCLINE * `MU_WBES64` - writes a signed 64-bit integer to big-endian byte data; overridable macro to `muu_wbes64`.
+			#ifndef MU_WBES64
+				MUDEF inline void muu_wbes64(muByte* b, int64_m n) {
+					MU_WBEU64(b, *(uint64_m*)&n);
+				}
+				#define MU_WBES64 muu_wbes64
+			#endif
+
+		// @DOCLINE ## Floating-point
+
+			// @DOCLINE The following macros exist for byte manipulation regarding IEEE 754 single-precision (`float`) and double-precision (`double`) floating-point numbers, which are stored as the bits of the respective unsigned integer. The bits are moved between the integer and the float with `mu_memcpy`, which compilers turn into a register move, rather than by casting pointers, which breaks strict aliasing rules:
+
+			// @DOCLINE * `MU_RLEF32` - reads a float from little-endian byte data; overridable macro to `muu_rlef32`.
+			#ifndef MU_RLEF32
+				MUDEF inline float muu_rlef32(muByte* b) {
+					uint32_m u = MU_RLEU32(b);
+					float f;
+					mu_memcpy(&f, &u, 4);
+					return f;
+				}
+				#define MU_RLEF32 muu_rlef32
+			#endif
+
+			// @DOCLINE * `MU_WLEF32` - writes a float to little-endian byte data; overridable macro to `muu_wlef32`.
+			#ifndef MU_WLEF32
+				MUDEF inline void muu_wlef32(muByte* b, float f) {
+					uint32_m u;
+					mu_memcpy(&u, &f, 4);
+					MU_WLEU32(b, u);
+				}
+				#define MU_WLEF32 muu_wlef32
+			#endif
+
+			// @DOCLINE * `MU_RBEF32` - reads a float from big-endian byte data; overridable macro to `muu_rbef32`.
+			#ifndef MU_RBEF32
+				MUDEF inline float muu_rbef32(muByte* b) {
+					uint32_m u = MU_RBEU32(b);
+					float f;
+					mu_memcpy(&f, &u, 4);
+					return f;
+				}
+				#define MU_RBEF32 muu_rbef32
+			#endif
+
+			// @DOCLINE * `MU_WBEF32` - writes a float to big-endian byte data; overridable macro to `muu_wbef32`.
+			#ifndef MU_WBEF32
+				MUDEF inline void muu_wbef32(muByte* b, float f) {
+					uint32_m u;
+					mu_memcpy(&u, &f, 4);
+					MU_WBEU32(b, u);
+				}
+				#define MU_WBEF32 muu_wbef32
+			#endif
+
+			// @DOCLINE * `MU_RLEF64` - reads a double from little-endian byte data; overridable macro to `muu_rlef64`.
+			#ifndef MU_RLEF64
+				MUDEF inline double muu_rlef64(muByte* b) {
+					uint64_m u = MU_RLEU64(b);
+					double f;
+					mu_memcpy(&f, &u, 8);
+					return f;
+				}
+				#define MU_RLEF64 muu_rlef64
+			#endif
+
+			// @DOCLINE * `MU_WLEF64` - writes a double to little-endian byte data; overridable macro to `muu_wlef64`.
+			#ifndef MU_WLEF64
+				MUDEF inline void muu_wlef64(muByte* b, double f) {
+					uint64_m u;
+					mu_memcpy(&u, &f, 8);
+					MU_WLEU64(b, u);
+				}
+				#define MU_WLEF64 muu_wlef64
+			#endif
+
+			// @DOCLINE * `MU_RBEF64` - reads a double from big-endian byte data; overridable macro to `muu_rbef64`.
+			#ifndef MU_RBEF64
+				MUDEF inline double muu_rbef64(muByte* b) {
+					uint64_m u = MU_RBEU64(b);
+					double f;
+					mu_memcpy(&f, &u, 8);
+					return f;
+				}
+				#define MU_RBEF64 muu_rbef64
+			#endif
+
+			// @DOCLINE * `MU_WBEF64` - writes a double to big-endian byte data; overridable macro to `muu_wbef64`.
+			#ifndef MU_WBEF64
+				MUDEF inline void muu_wbef64(muByte* b, double f) {
+					uint64_m u;
+					mu_memcpy(&u, &f, 8);
+					MU_WBEU64(b, u);
+				}
+				#define MU_WBEF64 muu_wbef64
+			#endif
+
+		// @DOCLINE ## Half-precision floating-point
+
+			// @DOCLINE muUtility supports two 16-bit floating-point formats, which are read as and written from `float`:
+
+			// @DOCLINE * IEEE 754 half-precision ("f16"), with 1 sign bit, 5 exponent bits, and 10 mantissa bits, having a range of about ±65504 with 3 decimal digits of precision; commonly used for vertex attributes and textures.
+
+			// @DOCLINE * bfloat16 ("bf16"), with 1 sign bit, 8 exponent bits, and 7 mantissa bits, being the upper half of a `float`, and thus having the same range as a `float` with 2 decimal digits of precision; commonly used for machine learning tensors.
+
+			// @DOCLINE Converting to a 16-bit format rounds to the nearest representable value (ties to even), with values too large for f16 becoming infinity. NaN values stay NaN (and are made quiet), and f16 subnormal values are handled exactly.
+
+			// @DOCLINE The function `muu_f16_to_f32` converts the bits of an f16 value to a `float`, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline float muu_f16_to_f32(uint16_m h);
+			```
+			@DOCEND */
+
+			MUDEF inline float muu_f16_to_f32(uint16_m h) {
+				uint32_m sign = (uint32_m)(h & 0x8000) << 16;
+				uint32_m exp = (h >> 10) & 0x1F;
+				uint32_m mant = h & 0x3FF;
+				uint32_m u;
+				if (exp == 0x1F) {
+					// Infinity, or NaN made quiet, keeping its payload
+					u = sign | 0x7F800000 | (mant << 13) | (mant ? 0x400000 : 0);
+				} else if (exp) {
+					u = sign | ((exp + 112) << 23) | (mant << 13);
+				} else if (mant) {
+					// Subnormal; normalize it, as every f16 subnormal is a normal float
+					exp = 113;
+					while (!(mant & 0x400)) {
+						mant <<= 1;
+						--exp;
+					}
+					u = sign | (exp << 23) | ((mant & 0x3FF) << 13);
+				} else {
+					u = sign;
+				}
+				float f;
+				mu_memcpy(&f, &u, 4);
+				return f;
+			}
+
+			// @DOCLINE The function `muu_f32_to_f16` converts a `float` to the bits of an f16 value, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint16_m muu_f32_to_f16(float f);
+			```
+			@DOCEND */
+
+			MUDEF inline uint16_m muu_f32_to_f16(float f) {
+				uint32_m u;
+				mu_memcpy(&u, &f, 4);
+				uint32_m sign = (u >> 16) & 0x8000;
+				u &= 0x7FFFFFFF;
+
+				if (u >= 0x7F800000) {
+					// Infinity, or NaN made quiet
+					return (uint16_m)(sign | 0x7C00 | (u > 0x7F800000 ? 0x200 | ((u >> 13) & 0x3FF) : 0));
+				}
+				if (u >= 0x477FF000) {
+					// At least 65520, which rounds to infinity
+					return (uint16_m)(sign | 0x7C00);
+				}
+				if (u < 0x38800000) {
+					// Below 2^-14; f16 subnormal, whose unit is 2^-24
+					uint32_m e = u >> 23;
+					if (e < 102) {
+						return (uint16_m)sign;
+					}
+					uint32_m m = (u & 0x7FFFFF) | 0x800000;
+					uint32_m shift = 126 - e;
+					uint32_m r = m >> shift;
+					uint32_m rem = m & ((1u << shift) - 1);
+					uint32_m half = 1u << (shift - 1);
+					if (rem > half || (rem == half && (r & 1))) {
+						++r;
+					}
+					return (uint16_m)(sign | r);
+				}
+
+				// Normal; rebias the exponent and round the mantissa, which may carry into the
+				// exponent
+				u -= 0x38000000;
+				u += 0xFFF + ((u >> 13) & 1);
+				return (uint16_m)(sign | (u >> 13));
+			}
+
+			// @DOCLINE The function `muu_bf16_to_f32` converts the bits of a bf16 value to a `float`, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline float muu_bf16_to_f32(uint16_m h);
+			```
+			@DOCEND */
+
+			MUDEF inline float muu_bf16_to_f32(uint16_m h) {
+				uint32_m u = (uint32_m)h << 16;
+				float f;
+				mu_memcpy(&f, &u, 4);
+				return f;
+			}
+
+			// @DOCLINE The function `muu_f32_to_bf16` converts a `float` to the bits of a bf16 value, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint16_m muu_f32_to_bf16(float f);
+			```
+			@DOCEND */
+
+			MUDEF inline uint16_m muu_f32_to_bf16(float f) {
+				uint32_m u;
+				mu_memcpy(&u, &f, 4);
+				if ((u & 0x7FFFFFFF) > 0x7F800000) {
+					return (uint16_m)((u >> 16) | 0x40);
+				}
+				u += 0x7FFF + ((u >> 16) & 1);
+				return (uint16_m)(u >> 16);
+			}
+
+			// @DOCLINE The following macros exist for byte manipulation regarding 16-bit floating-point numbers:
+
+			// @DOCLINE * `MU_RLEF16` - reads an f16 value from little-endian byte data as a `float`; overridable macro to `muu_rlef16`.
+			#ifndef MU_RLEF16
+				MUDEF inline float muu_rlef16(muByte* b) {
+					return muu_f16_to_f32(MU_RLEU16(b));
+				}
+				#define MU_RLEF16 muu_rlef16
+			#endif
+
+			// @DOCLINE * `MU_WLEF16` - writes a `float` to little-endian byte data as an f16 value; overridable macro to `muu_wlef16`.
+			#ifndef MU_WLEF16
+				MUDEF inline void muu_wlef16(muByte* b, float f) {
+					MU_WLEU16(b, muu_f32_to_f16(f));
+				}
+				#define MU_WLEF16 muu_wlef16
+			#endif
+
+			// @DOCLINE * `MU_RBEF16` - reads an f16 value from big-endian byte data as a `float`; overridable macro to `muu_rbef16`.
+			#ifndef MU_RBEF16
+				MUDEF inline float muu_rbef16(muByte* b) {
+					return muu_f16_to_f32(MU_RBEU16(b));
+				}
+				#define MU_RBEF16 muu_rbef16
+			#endif
+
+			// @DOCLINE * `MU_WBEF16` - writes a `float` to big-endian byte data as an f16 value; overridable macro to `muu_wbef16`.
+			#ifndef MU_WBEF16
+				MUDEF inline void muu_wbef16(muByte* b, float f) {
+					MU_WBEU16(b, muu_f32_to_f16(f));
+				}
+				#define MU_WBEF16 muu_wbef16
+			#endif
+
+			// @DOCLINE * `MU_RLEBF16` - reads a bf16 value from little-endian byte data as a `float`; overridable macro to `muu_rlebf16`.
+			#ifndef MU_RLEBF16
+				MUDEF inline float muu_rlebf16(muByte* b) {
+					return muu_bf16_to_f32(MU_RLEU16(b));
+				}
+				#define MU_RLEBF16 muu_rlebf16
+			#endif
+
+			// @DOCLINE * `MU_WLEBF16` - writes a `float` to little-endian byte data as a bf16 value; overridable macro to `muu_wlebf16`.
+			#ifndef MU_WLEBF16
+				MUDEF inline void muu_wlebf16(muByte* b, float f) {
+					MU_WLEU16(b, muu_f32_to_bf16(f));
+				}
+				#define MU_WLEBF16 muu_wlebf16
+			#endif
+
+			// @DOCLINE * `MU_RBEBF16` - reads a bf16 value from big-endian byte data as a `float`; overridable macro to `muu_rbebf16`.
+			#ifndef MU_RBEBF16
+				MUDEF inline float muu_rbebf16(muByte* b) {
+					return muu_bf16_to_f32(MU_RBEU16(b));
+				}
+				#define MU_RBEBF16 muu_rbebf16
+			#endif
+
+			// @DOCLINE * `MU_WBEBF16` - writes a `float` to big-endian byte data as a bf16 value; overridable macro to `muu_wbebf16`.
+			#ifndef MU_WBEBF16
+				MUDEF inline void muu_wbebf16(muByte* b, float f) {
+					MU_WBEU16(b, muu_f32_to_bf16(f));
+				}
+				#define MU_WBEBF16 muu_wbebf16
+			#endif
+
+		// @DOCLINE ## Variable-length integers
+
+			// @DOCLINE muUtility defines several functions for reading and writing variable-length integers in the LEB128 format, in which each byte holds 7 bits of the integer, least significant group first, with the high bit of each byte set if more bytes follow. An encoded 64-bit integer takes up at most `MU_LEB128_MAX` bytes, which is defined as 10.
+
+			#define MU_LEB128_MAX 10
+
+			// @DOCLINE Variable-length reading functions take in a pointer of bytes as their first parameter, the amount of bytes available to be read as their second parameter, and a pointer to the integer to be filled as their third parameter, and return the amount of bytes read, or 0 if the data was truncated, or if the encoding is invalid by being longer than `MU_LEB128_MAX` bytes or by holding a value that overflows 64 bits. Variable-length writing functions take in a pointer of bytes, which needs to have at least `MU_LEB128_MAX` bytes available, as their first parameter, and the integer to be written as their second parameter, and return the amount of bytes written. For example, `muu_rleb128u` and `muu_wleb128u` are defined as:
+
+			/* @DOCBEGIN
+			```
+			MUDEF inline size_m muu_rleb128u(muByte* b, size_m len, uint64_m* n);
+			MUDEF inline size_m muu_wleb128u(muByte* b, uint64_m n);
+			```
+			@DOCEND */
+
+			// @DOCLINE The following macros exist for variable-length integers:
+
+			// @DOCLINE * `MU_RLEB128U` - reads an unsigned LEB128 integer; overridable macro to `muu_rleb128u`.
+			#ifndef MU_RLEB128U
+				MUDEF inline size_m muu_rleb128u(muByte* b, size_m len, uint64_m* n) {
+					uint64_m v = 0;
+					for (size_m i = 0; i < len && i < MU_LEB128_MAX; ++i) {
+						v |= (uint64_m)(b[i] & 0x7F) << (i*7);
+						if (!(b[i] & 0x80)) {
+							// The 10th byte only holds bit 63
+							if (i == MU_LEB128_MAX-1 && b[i] > 1) {
+								return 0;
+							}
+							*n = v;
+							return i+1;
+						}
+					}
+					return 0;
+				}
+				#define MU_RLEB128U muu_rleb128u
+			#endif
+
+			// @DOCLINE * `MU_WLEB128U` - writes an unsigned LEB128 integer; overridable macro to `muu_wleb128u`.
+			#ifndef MU_WLEB128U
+				MUDEF inline size_m muu_wleb128u(muByte* b, uint64_m n) {
+					size_m i = 0;
+					while (n >= 0x80) {
+						b[i++] = (muByte)(n | 0x80);
+						n >>= 7;
+					}
+					b[i++] = (muByte)n;
+					return i;
+				}
+				#define MU_WLEB128U muu_wleb128u
+			#endif
+
+			// @DOCLINE * `MU_RLEB128S` - reads a signed LEB128 integer, whose last byte is sign-extended; overridable macro to `muu_rleb128s`.
+			#ifndef MU_RLEB128S
+				MUDEF inline size_m muu_rleb128s(muByte* b, size_m len, int64_m* n) {
+					uint64_m v = 0;
+					for (size_m i = 0; i < len && i < MU_LEB128_MAX; ++i) {
+						v |= (uint64_m)(b[i] & 0x7F) << (i*7);
+						if (!(b[i] & 0x80)) {
+							// The 10th byte only holds bit 63, with the rest of its bits
+							// being copies of it
+							if (i == MU_LEB128_MAX-1 && b[i] != 0 && b[i] != 0x7F) {
+								return 0;
+							}
+							// Sign-extend from the highest bit read
+							if ((i+1)*7 < 64 && (b[i] & 0x40)) {
+								v |= ~(uint64_m)0 << ((i+1)*7);
+							}
+							*n = *(int64_m*)&v;
+							return i+1;
+						}
+					}
+					return 0;
+				}
+				#define MU_RLEB128S muu_rleb128s
+			#endif
+
+			// @DOCLINE * `MU_WLEB128S` - writes a signed LEB128 integer; overridable macro to `muu_wleb128s`.
+			#ifndef MU_WLEB128S
+				MUDEF inline size_m muu_wleb128s(muByte* b, int64_m n) {
+					size_m i = 0;
+					for (;;) {
+						muByte c = (muByte)(n & 0x7F);
+						// Arithmetic shift; done by hand since right-shifting negative
+						// values is implementation-defined
+						n = (n < 0) ? ~(~n >> 7) : (n >> 7);
+						if ((n == 0 && !(c & 0x40)) || (n == -1 && (c & 0x40))) {
+							b[i++] = c;
+							return i;
+						}
+						b[i++] = (muByte)(c | 0x80);
+					}
+				}
+				#define MU_WLEB128S muu_wleb128s
+			#endif
+
+			// @DOCLINE Signed integers can alternatively be stored as unsigned LEB128 integers using zigzag encoding, which maps signed integers of a small magnitude to unsigned integers of a small magnitude (0 to 0, -1 to 1, 1 to 2, -2 to 3, and so on):
+
+			// @DOCLINE * `MU_ZIGZAG_ENCODE` - converts a signed 64-bit integer to its zigzag-encoded unsigned 64-bit integer; overridable macro to `muu_zigzag_encode`.
+			#ifndef MU_ZIGZAG_ENCODE
+				MUDEF inline uint64_m muu_zigzag_encode(int64_m n) {
+					uint64_m un = *(uint64_m*)&n;
+					return (un << 1) ^ (0 - (un >> 63));
+				}
+				#define MU_ZIGZAG_ENCODE muu_zigzag_encode
+			#endif
+
+			// @DOCLINE * `MU_ZIGZAG_DECODE` - converts a zigzag-encoded unsigned 64-bit integer back to its signed 64-bit integer; overridable macro to `muu_zigzag_decode`.
+			#ifndef MU_ZIGZAG_DECODE
+				MUDEF inline int64_m muu_zigzag_decode(uint64_m n) {
+					uint64_m un = (n >> 1) ^ (0 - (n & 1));
+					return *(int64_m*)&un;
+				}
+				#define MU_ZIGZAG_DECODE muu_zigzag_decode
+			#endif
+
+			// @DOCLINE ### Stream VByte
+
+			// @DOCLINE For arrays of 32-bit integers, muUtility defines bulk encoding and decoding functions using the Stream VByte format, in which the integers are split into a stream of control bytes, each one describing the byte lengths (1 to 4) of 4 integers in 2 bits each (first integer in the lowest bits), followed by a stream of the integers' data bytes in little-endian order. Keeping the lengths apart from the data allows decoding 4 integers at a time with a single SSSE3 shuffle if the compiler is targeting SSSE3 (see `MU_SSSE3`) or if runtime dispatch is enabled (see `MU_CPU_DISPATCH`) and the CPU supports it, with a scalar fallback otherwise. The amount of integers is not stored, and needs to be known upon decoding.
+
+			// @DOCLINE The macro `MU_SVB_MAX_SIZE(len)` gives the maximum amount of bytes needed to encode `len` 32-bit integers.
+			#define MU_SVB_MAX_SIZE(len) ((((len)+3)/4) + ((len)*4))
+
+			// Shuffle masks for SSSE3 decoding; entry 'c' moves the data bytes described
+			// by control byte 'c' into four 32-bit lanes, zeroing the unused bytes.
+			#if defined(MU_SSSE3) || defined(MU_CPU_DISPATCH)
+				static const muByte muu_inner_svb_shuffle[256][16] = {
+					{0,128,128,128,1,128,128,128,2,128,128,128,3,128,128,128},
+					{0,1,128,128,2,128,128,128,3,128,128,128,4,128,128,128},
+					{0,1,2,128,3,128,128,128,4,128,128,128,5,128,128,128},
+					{0,1,2,3,4,128,128,128,5,128,128,128,6,128,128,128},
+					{0,128,128,128,1,2,128,128,3,128,128,128,4,128,128,128},
+					{0,1,128,128,2,3,128,128,4,128,128,128,5,128,128,128},
+					{0,1,2,128,3,4,128,128,5,128,128,128,6,128,128,128},
+					{0,1,2,3,4,5,128,128,6,128,128,128,7,128,128,128},
+					{0,128,128,128,1,2,3,128,4,128,128,128,5,128,128,128},
+					{0,1,128,128,2,3,4,128,5,128,128,128,6,128,128,128},
+					{0,1,2,128,3,4,5,128,6,128,128,128,7,128,128,128},
+					{0,1,2,3,4,5,6,128,7,128,128,128,8,128,128,128},
+					{0,128,128,128,1,2,3,4,5,128,128,128,6,128,128,128},
+					{0,1,128,128,2,3,4,5,6,128,128,128,7,128,128,128},
+					{0,1,2,128,3,4,5,6,7,128,128,128,8,128,128,128},
+					{0,1,2,3,4,5,6,7,8,128,128,128,9,128,128,128},
+					{0,128,128,128,1,128,128,128,2,3,128,128,4,128,128,128},
+					{0,1,128,128,2,128,128,128,3,4,128,128,5,128,128,128},
+					{0,1,2,128,3,128,128,128,4,5,128,128,6,128,128,128},
+					{0,1,2,3,4,128,128,128,5,6,128,128,7,128,128,128},
+					{0,128,128,128,1,2,128,128,3,4,128,128,5,128,128,128},
+					{0,1,128,128,2,3,128,128,4,5,128,128,6,128,128,128},
+					{0,1,2,128,3,4,128,128,5,6,128,128,7,128,128,128},
+					{0,1,2,3,4,5,128,128,6,7,128,128,8,128,128,128},
+					{0,128,128,128,1,2,3,128,4,5,128,128,6,128,128,128},
+					{0,1,128,128,2,3,4,128,5,6,128,128,7,128,128,128},
+					{0,1,2,128,3,4,5,128,6,7,128,128,8,128,128,128},
+					{0,1,2,3,4,5,6,128,7,8,128,128,9,128,128,128},
+					{0,128,128,128,1,2,3,4,5,6,128,128,7,128,128,128},
+					{0,1,128,128,2,3,4,5,6,7,128,128,8,128,128,128},
+					{0,1,2,128,3,4,5,6,7,8,128,128,9,128,128,128},
+					{0,1,2,3,4,5,6,7,8,9,128,128,10,128,128,128},
+					{0,128,128,128,1,128,128,128,2,3,4,128,5,128,128,128},
+					{0,1,128,128,2,128,128,128,3,4,5,128,6,128,128,128},
+					{0,1,2,128,3,128,128,128,4,5,6,128,7,128,128,128},
+					{0,1,2,3,4,128,128,128,5,6,7,128,8,128,128,128},
+					{0,128,128,128,1,2,128,128,3,4,5,128,6,128,128,128},
+					{0,1,128,128,2,3,128,128,4,5,6,128,7,128,128,128},
+					{0,1,2,128,3,4,128,128,5,6,7,128,8,128,128,128},
+					{0,1,2,3,4,5,128,128,6,7,8,128,9,128,128,128},
+					{0,128,128,128,1,2,3,128,4,5,6,128,7,128,128,128},
+					{0,1,128,128,2,3,4,128,5,6,7,128,8,128,128,128},
+					{0,1,2,128,3,4,5,128,6,7,8,128,9,128,128,128},
+					{0,1,2,3,4,5,6,128,7,8,9,128,10,128,128,128},
+					{0,128,128,128,1,2,3,4,5,6,7,128,8,128,128,128},
+					{0,1,128,128,2,3,4,5,6,7,8,128,9,128,128,128},
+					{0,1,2,128,3,4,5,6,7,8,9,128,10,128,128,128},
+					{0,1,2,3,4,5,6,7,8,9,10,128,11,128,128,128},
+					{0,128,128,128,1,128,128,128,2,3,4,5,6,128,128,128},
+					{0,1,128,128,2,128,128,128,3,4,5,6,7,128,128,128},
+					{0,1,2,128,3,128,128,128,4,5,6,7,8,128,128,128},
+					{0,1,2,3,4,128,128,128,5,6,7,8,9,128,128,128},
+					{0,128,128,128,1,2,128,128,3,4,5,6,7,128,128,128},
+					{0,1,128,128,2,3,128,128,4,5,6,7,8,128,128,128},
+					{0,1,2,128,3,4,128,128,5,6,7,8,9,128,128,128},
+					{0,1,2,3,4,5,128,128,6,7,8,9,10,128,128,128},
+					{0,128,128,128,1,2,3,128,4,5,6,7,8,128,128,128},
+					{0,1,128,128,2,3,4,128,5,6,7,8,9,128,128,128},
+					{0,1,2,128,3,4,5,128,6,7,8,9,10,128,128,128},
+					{0,1,2,3,4,5,6,128,7,8,9,10,11,128,128,128},
+					{0,128,128,128,1,2,3,4,5,6,7,8,9,128,128,128},
+					{0,1,128,128,2,3,4,5,6,7,8,9,10,128,128,128},
+					{0,1,2,128,3,4,5,6,7,8,9,10,11,128,128,128},
+					{0,1,2,3,4,5,6,7,8,9,10,11,12,128,128,128},
+					{0,128,128,128,1,128,128,128,2,128,128,128,3,4,128,128},
+					{0,1,128,128,2,128,128,128,3,128,128,128,4,5,128,128},
+					{0,1,2,128,3,128,128,128,4,128,128,128,5,6,128,128},
+					{0,1,2,3,4,128,128,128,5,128,128,128,6,7,128,128},
+					{0,128,128,128,1,2,128,128,3,128,128,128,4,5,128,128},
+					{0,1,128,128,2,3,128,128,4,128,128,128,5,6,128,128},
+					{0,1,2,128,3,4,128,128,5,128,128,128,6,7,128,128},
+					{0,1,2,3,4,5,128,128,6,128,128,128,7,8,128,128},
+					{0,128,128,128,1,2,3,128,4,128,128,128,5,6,128,128},
+					{0,1,128,128,2,3,4,128,5,128,128,128,6,7,128,128},
+					{0,1,2,128,3,4,5,128,6,128,128,128,7,8,128,128},
+					{0,1,2,3,4,5,6,128,7,128,128,128,8,9,128,128},
+					{0,128,128,128,1,2,3,4,5,128,128,128,6,7,128,128},
+					{0,1,128,128,2,3,4,5,6,128,128,128,7,8,128,128},
+					{0,1,2,128,3,4,5,6,7,128,128,128,8,9,128,128},
+					{0,1,2,3,4,5,6,7,8,128,128,128,9,10,128,128},
+					{0,128,128,128,1,128,128,128,2,3,128,128,4,5,128,128},
+					{0,1,128,128,2,128,128,128,3,4,128,128,5,6,128,128},
+					{0,1,2,128,3,128,128,128,4,5,128,128,6,7,128,128},
+					{0,1,2,3,4,128,128,128,5,6,128,128,7,8,128,128},
+					{0,128,128,128,1,2,128,128,3,4,128,128,5,6,128,128},
+					{0,1,128,128,2,3,128,128,4,5,128,128,6,7,128,128},
+					{0,1,2,128,3,4,128,128,5,6,128,128,7,8,128,128},
+					{0,1,2,3,4,5,128,128,6,7,128,128,8,9,128,128},
+					{0,128,128,128,1,2,3,128,4,5,128,128,6,7,128,128},
+					{0,1,128,128,2,3,4,128,5,6,128,128,7,8,128,128},
+					{0,1,2,128,3,4,5,128,6,7,128,128,8,9,128,128},
+					{0,1,2,3,4,5,6,128,7,8,128,128,9,10,128,128},
+					{0,128,128,128,1,2,3,4,5,6,128,128,7,8,128,128},
+					{0,1,128,128,2,3,4,5,6,7,128,128,8,9,128,128},
+					{0,1,2,128,3,4,5,6,7,8,128,128,9,10,128,128},
+					{0,1,2,3,4,5,6,7,8,9,128,128,10,11,128,128},
+					{0,128,128,128,1,128,128,128,2,3,4,128,5,6,128,128},
+					{0,1,128,128,2,128,128,128,3,4,5,128,6,7,128,128},
+					{0,1,2,128,3,128,128,128,4,5,6,128,7,8,128,128},
+					{0,1,2,3,4,128,128,128,5,6,7,128,8,9,128,128},
+					{0,128,128,128,1,2,128,128,3,4,5,128,6,7,128,128},
+					{0,1,128,128,2,3,128,128,4,5,6,128,7,8,128,128},
+					{0,1,2,128,3,4,128,128,5,6,7,128,8,9,128,128},
+					{0,1,2,3,4,5,128,128,6,7,8,128,9,10,128,128},
+					{0,128,128,128,1,2,3,128,4,5,6,128,7,8,128,128},
+					{0,1,128,128,2,3,4,128,5,6,7,128,8,9,128,128},
+					{0,1,2,128,3,4,5,128,6,7,8,128,9,10,128,128},
+					{0,1,2,3,4,5,6,128,7,8,9,128,10,11,128,128},
+					{0,128,128,128,1,2,3,4,5,6,7,128,8,9,128,128},
+					{0,1,128,128,2,3,4,5,6,7,8,128,9,10,128,128},
+					{0,1,2,128,3,4,5,6,7,8,9,128,10,11,128,128},
+					{0,1,2,3,4,5,6,7,8,9,10,128,11,12,128,128},
+					{0,128,128,128,1,128,128,128,2,3,4,5,6,7,128,128},
+					{0,1,128,128,2,128,128,128,3,4,5,6,7,8,128,128},
+					{0,1,2,128,3,128,128,128,4,5,6,7,8,9,128,128},
+					{0,1,2,3,4,128,128,128,5,6,7,8,9,10,128,128},
+					{0,128,128,128,1,2,128,128,3,4,5,6,7,8,128,128},
+					{0,1,128,128,2,3,128,128,4,5,6,7,8,9,128,128},
+					{0,1,2,128,3,4,128,128,5,6,7,8,9,10,128,128},
+					{0,1,2,3,4,5,128,128,6,7,8,9,10,11,128,128},
+					{0,128,128,128,1,2,3,128,4,5,6,7,8,9,128,128},
+					{0,1,128,128,2,3,4,128,5,6,7,8,9,10,128,128},
+					{0,1,2,128,3,4,5,128,6,7,8,9,10,11,128,128},
+					{0,1,2,3,4,5,6,128,7,8,9,10,11,12,128,128},
+					{0,128,128,128,1,2,3,4,5,6,7,8,9,10,128,128},
+					{0,1,128,128,2,3,4,5,6,7,8,9,10,11,128,128},
+					{0,1,2,128,3,4,5,6,7,8,9,10,11,12,128,128},
+					{0,1,2,3,4,5,6,7,8,9,10,11,12,13,128,128},
+					{0,128,128,128,1,128,128,128,2,128,128,128,3,4,5,128},
+					{0,1,128,128,2,128,128,128,3,128,128,128,4,5,6,128},
+					{0,1,2,128,3,128,128,128,4,128,128,128,5,6,7,128},
+					{0,1,2,3,4,128,128,128,5,128,128,128,6,7,8,128},
+					{0,128,128,128,1,2,128,128,3,128,128,128,4,5,6,128},
+					{0,1,128,128,2,3,128,128,4,128,128,128,5,6,7,128},
+					{0,1,2,128,3,4,128,128,5,128,128,128,6,7,8,128},
+					{0,1,2,3,4,5,128,128,6,128,128,128,7,8,9,128},
+					{0,128,128,128,1,2,3,128,4,128,128,128,5,6,7,128},
+					{0,1,128,128,2,3,4,128,5,128,128,128,6,7,8,128},
+					{0,1,2,128,3,4,5,128,6,128,128,128,7,8,9,128},
+					{0,1,2,3,4,5,6,128,7,128,128,128,8,9,10,128},
+					{0,128,128,128,1,2,3,4,5,128,128,128,6,7,8,128},
+					{0,1,128,128,2,3,4,5,6,128,128,128,7,8,9,128},
+					{0,1,2,128,3,4,5,6,7,128,128,128,8,9,10,128},
+					{0,1,2,3,4,5,6,7,8,128,128,128,9,10,11,128},
+					{0,128,128,128,1,128,128,128,2,3,128,128,4,5,6,128},
+					{0,1,128,128,2,128,128,128,3,4,128,128,5,6,7,128},
+					{0,1,2,128,3,128,128,128,4,5,128,128,6,7,8,128},
+					{0,1,2,3,4,128,128,128,5,6,128,128,7,8,9,128},
+					{0,128,128,128,1,2,128,128,3,4,128,128,5,6,7,128},
+					{0,1,128,128,2,3,128,128,4,5,128,128,6,7,8,128},
+					{0,1,2,128,3,4,128,128,5,6,128,128,7,8,9,128},
+					{0,1,2,3,4,5,128,128,6,7,128,128,8,9,10,128},
+					{0,128,128,128,1,2,3,128,4,5,128,128,6,7,8,128},
+					{0,1,128,128,2,3,4,128,5,6,128,128,7,8,9,128},
+					{0,1,2,128,3,4,5,128,6,7,128,128,8,9,10,128},
+					{0,1,2,3,4,5,6,128,7,8,128,128,9,10,11,128},
+					{0,128,128,128,1,2,3,4,5,6,128,128,7,8,9,128},
+					{0,1,128,128,2,3,4,5,6,7,128,128,8,9,10,128},
+					{0,1,2,128,3,4,5,6,7,8,128,128,9,10,11,128},
+					{0,1,2,3,4,5,6,7,8,9,128,128,10,11,12,128},
+					{0,128,128,128,1,128,128,128,2,3,4,128,5,6,7,128},
+					{0,1,128,128,2,128,128,128,3,4,5,128,6,7,8,128},
+					{0,1,2,128,3,128,128,128,4,5,6,128,7,8,9,128},
+					{0,1,2,3,4,128,128,128,5,6,7,128,8,9,10,128},
+					{0,128,128,128,1,2,128,128,3,4,5,128,6,7,8,128},
+					{0,1,128,128,2,3,128,128,4,5,6,128,7,8,9,128},
+					{0,1,2,128,3,4,128,128,5,6,7,128,8,9,10,128},
+					{0,1,2,3,4,5,128,128,6,7,8,128,9,10,11,128},
+					{0,128,128,128,1,2,3,128,4,5,6,128,7,8,9,128},
+					{0,1,128,128,2,3,4,128,5,6,7,128,8,9,10,128},
+					{0,1,2,128,3,4,5,128,6,7,8,128,9,10,11,128},
+					{0,1,2,3,4,5,6,128,7,8,9,128,10,11,12,128},
+					{0,128,128,128,1,2,3,4,5,6,7,128,8,9,10,128},
+					{0,1,128,128,2,3,4,5,6,7,8,128,9,10,11,128},
+					{0,1,2,128,3,4,5,6,7,8,9,128,10,11,12,128},
+					{0,1,2,3,4,5,6,7,8,9,10,128,11,12,13,128},
+					{0,128,128,128,1,128,128,128,2,3,4,5,6,7,8,128},
+					{0,1,128,128,2,128,128,128,3,4,5,6,7,8,9,128},
+					{0,1,2,128,3,128,128,128,4,5,6,7,8,9,10,128},
+					{0,1,2,3,4,128,128,128,5,6,7,8,9,10,11,128},
+					{0,128,128,128,1,2,128,128,3,4,5,6,7,8,9,128},
+					{0,1,128,128,2,3,128,128,4,5,6,7,8,9,10,128},
+					{0,1,2,128,3,4,128,128,5,6,7,8,9,10,11,128},
+					{0,1,2,3,4,5,128,128,6,7,8,9,10,11,12,128},
+					{0,128,128,128,1,2,3,128,4,5,6,7,8,9,10,128},
+					{0,1,128,128,2,3,4,128,5,6,7,8,9,10,11,128},
+					{0,1,2,128,3,4,5,128,6,7,8,9,10,11,12,128},
+					{0,1,2,3,4,5,6,128,7,8,9,10,11,12,13,128},
+					{0,128,128,128,1,2,3,4,5,6,7,8,9,10,11,128},
+					{0,1,128,128,2,3,4,5,6,7,8,9,10,11,12,128},
+					{0,1,2,128,3,4,5,6,7,8,9,10,11,12,13,128},
+					{0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,128},
+					{0,128,128,128,1,128,128,128,2,128,128,128,3,4,5,6},
+					{0,1,128,128,2,128,128,128,3,128,128,128,4,5,6,7},
+					{0,1,2,128,3,128,128,128,4,128,128,128,5,6,7,8},
+					{0,1,2,3,4,128,128,128,5,128,128,128,6,7,8,9},
+					{0,128,128,128,1,2,128,128,3,128,128,128,4,5,6,7},
+					{0,1,128,128,2,3,128,128,4,128,128,128,5,6,7,8},
+					{0,1,2,128,3,4,128,128,5,128,128,128,6,7,8,9},
+					{0,1,2,3,4,5,128,128,6,128,128,128,7,8,9,10},
+					{0,128,128,128,1,2,3,128,4,128,128,128,5,6,7,8},
+					{0,1,128,128,2,3,4,128,5,128,128,128,6,7,8,9},
+					{0,1,2,128,3,4,5,128,6,128,128,128,7,8,9,10},
+					{0,1,2,3,4,5,6,128,7,128,128,128,8,9,10,11},
+					{0,128,128,128,1,2,3,4,5,128,128,128,6,7,8,9},
+					{0,1,128,128,2,3,4,5,6,128,128,128,7,8,9,10},
+					{0,1,2,128,3,4,5,6,7,128,128,128,8,9,10,11},
+					{0,1,2,3,4,5,6,7,8,128,128,128,9,10,11,12},
+					{0,128,128,128,1,128,128,128,2,3,128,128,4,5,6,7},
+					{0,1,128,128,2,128,128,128,3,4,128,128,5,6,7,8},
+					{0,1,2,128,3,128,128,128,4,5,128,128,6,7,8,9},
+					{0,1,2,3,4,128,128,128,5,6,128,128,7,8,9,10},
+					{0,128,128,128,1,2,128,128,3,4,128,128,5,6,7,8},
+					{0,1,128,128,2,3,128,128,4,5,128,128,6,7,8,9},
+					{0,1,2,128,3,4,128,128,5,6,128,128,7,8,9,10},
+					{0,1,2,3,4,5,128,128,6,7,128,128,8,9,10,11},
+					{0,128,128,128,1,2,3,128,4,5,128,128,6,7,8,9},
+					{0,1,128,128,2,3,4,128,5,6,128,128,7,8,9,10},
+					{0,1,2,128,3,4,5,128,6,7,128,128,8,9,10,11},
+					{0,1,2,3,4,5,6,128,7,8,128,128,9,10,11,12},
+					{0,128,128,128,1,2,3,4,5,6,128,128,7,8,9,10},
+					{0,1,128,128,2,3,4,5,6,7,128,128,8,9,10,11},
+					{0,1,2,128,3,4,5,6,7,8,128,128,9,10,11,12},
+					{0,1,2,3,4,5,6,7,8,9,128,128,10,11,12,13},
+					{0,128,128,128,1,128,128,128,2,3,4,128,5,6,7,8},
+					{0,1,128,128,2,128,128,128,3,4,5,128,6,7,8,9},
+					{0,1,2,128,3,128,128,128,4,5,6,128,7,8,9,10},
+					{0,1,2,3,4,128,128,128,5,6,7,128,8,9,10,11},
+					{0,128,128,128,1,2,128,128,3,4,5,128,6,7,8,9},
+					{0,1,128,128,2,3,128,128,4,5,6,128,7,8,9,10},
+					{0,1,2,128,3,4,128,128,5,6,7,128,8,9,10,11},
+					{0,1,2,3,4,5,128,128,6,7,8,128,9,10,11,12},
+					{0,128,128,128,1,2,3,128,4,5,6,128,7,8,9,10},
+					{0,1,128,128,2,3,4,128,5,6,7,128,8,9,10,11},
+					{0,1,2,128,3,4,5,128,6,7,8,128,9,10,11,12},
+					{0,1,2,3,4,5,6,128,7,8,9,128,10,11,12,13},
+					{0,128,128,128,1,2,3,4,5,6,7,128,8,9,10,11},
+					{0,1,128,128,2,3,4,5,6,7,8,128,9,10,11,12},
+					{0,1,2,128,3,4,5,6,7,8,9,128,10,11,12,13},
+					{0,1,2,3,4,5,6,7,8,9,10,128,11,12,13,14},
+					{0,128,128,128,1,128,128,128,2,3,4,5,6,7,8,9},
+					{0,1,128,128,2,128,128,128,3,4,5,6,7,8,9,10},
+					{0,1,2,128,3,128,128,128,4,5,6,7,8,9,10,11},
+					{0,1,2,3,4,128,128,128,5,6,7,8,9,10,11,12},
+					{0,128,128,128,1,2,128,128,3,4,5,6,7,8,9,10},
+					{0,1,128,128,2,3,128,128,4,5,6,7,8,9,10,11},
+					{0,1,2,128,3,4,128,128,5,6,7,8,9,10,11,12},
+					{0,1,2,3,4,5,128,128,6,7,8,9,10,11,12,13},
+					{0,128,128,128,1,2,3,128,4,5,6,7,8,9,10,11},
+					{0,1,128,128,2,3,4,128,5,6,7,8,9,10,11,12},
+					{0,1,2,128,3,4,5,128,6,7,8,9,10,11,12,13},
+					{0,1,2,3,4,5,6,128,7,8,9,10,11,12,13,14},
+					{0,128,128,128,1,2,3,4,5,6,7,8,9,10,11,12},
+					{0,1,128,128,2,3,4,5,6,7,8,9,10,11,12,13},
+					{0,1,2,128,3,4,5,6,7,8,9,10,11,12,13,14},
+					{0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15},
+				};
+			#endif
+
+			// Returns the amount of data bytes described by a control byte
+			MUDEF inline size_m muu_inner_svb_ctrl_len(muByte c) {
+				return 4 + (c & 3) + ((c >> 2) & 3) + ((c >> 4) & 3) + (c >> 6);
+			}
+
+			// Internal SSSE3 decoding part; decodes groups of 4 integers while at least 16
+			// bytes of data are left (as 16 bytes are loaded per group regardless of its
+			// length), advancing 'data' and returning the amount of integers decoded
+			#if defined(MU_SSSE3) || defined(MU_CPU_DISPATCH)
+				MUDEF inline MU_TARGET("ssse3") size_m muu_inner_svb_decode_ssse3(muByte* ctrl, muByte** data, muByte* end, uint32_m* n, size_m len) {
+					muByte* d = *data;
+					size_m i = 0;
+					for (; i + 4 <= len && (size_m)(end - d) >= 16; i += 4) {
+						muByte c = ctrl[i/4];
+						__m128i v = _mm_loadu_si128((const __m128i*)d);
+						v = _mm_shuffle_epi8(v, _mm_loadu_si128((const __m128i*)muu_inner_svb_shuffle[c]));
+						_mm_storeu_si128((__m128i*)&n[i], v);
+						d += muu_inner_svb_ctrl_len(c);
+					}
+					*data = d;
+					return i;
+				}
+			#endif
+
+			// @DOCLINE The function `muu_svb_encode_u32` encodes an array of unsigned 32-bit integers, defined below:
+
+			/* @DOCBEGIN
+			```
+			MUDEF inline size_m muu_svb_encode_u32(muByte* b, uint32_m* n, size_m len);
+			```
+			@DOCEND */
+
+			MUDEF inline size_m muu_svb_encode_u32(muByte* b, uint32_m* n, size_m len) {
+				muByte* ctrl = b;
+				muByte* data = b + (len+3)/4;
+				size_m i = 0;
+
+				for (; i < len; ++i) {
+					uint32_m v = n[i];
+					muByte code = (v < (1u<<8)) ? 0 : (v < (1u<<16)) ? 1 : (v < (1u<<24)) ? 2 : 3;
+					if ((i & 3) == 0) {
+						ctrl[i/4] = 0;
+					}
+					ctrl[i/4] |= (muByte)(code << ((i & 3)*2));
+
+					data[0] = (muByte)(v);
+					if (code > 0) data[1] = (muByte)(v >> 8);
+					if (code > 1) data[2] = (muByte)(v >> 16);
+					if (code > 2) data[3] = (muByte)(v >> 24);
+					data += code+1;
+				}
+				return (size_m)(data - b);
+			}
+
+			// @DOCLINE `b` needs to have at least `MU_SVB_MAX_SIZE(len)` bytes available. The amount of bytes written is returned.
+
+			// @DOCLINE The function `muu_svb_decode_u32` decodes an array of unsigned 32-bit integers, defined below:
+
+			/* @DOCBEGIN
+			```
+			MUDEF inline size_m muu_svb_decode_u32(muByte* b, size_m blen, uint32_m* n, size_m len);
+			```
+			@DOCEND */
+
+			MUDEF inline size_m muu_svb_decode_u32(muByte* b, size_m blen, uint32_m* n, size_m len) {
+				size_m clen = (len+3)/4;
+				if (blen < clen) {
+					return 0;
+				}
+				muByte* ctrl = b;
+				muByte* data = b + clen;
+				muByte* end = b + blen;
+				size_m i = 0;
+
+				#if defined(MU_SSSE3)
+					i = muu_inner_svb_decode_ssse3(ctrl, &data, end, n, len);
+				#elif defined(MU_CPU_DISPATCH)
+					if (muu_cpu_has(MU_CPU_SSSE3)) {
+						i = muu_inner_svb_decode_ssse3(ctrl, &data, end, n, len);
+					}
+				#endif
+
+				for (; i < len; ++i) {
+					size_m l = ((ctrl[i/4] >> ((i & 3)*2)) & 3) + 1;
+					if ((size_m)(end - data) < l) {
+						return 0;
+					}
+					uint32_m v = data[0];
+					if (l > 1) v |= (uint32_m)data[1] << 8;
+					if (l > 2) v |= (uint32_m)data[2] << 16;
+					if (l > 3) v |= (uint32_m)data[3] << 24;
+					n[i] = v;
+					data += l;
+				}
+				return (size_m)(data - b);
+			}
+
+			// @DOCLINE `blen` is the amount of bytes available in `b`. The amount of bytes read is returned, or 0 if `blen` is too small to hold all `len` integers.
+
+			// @DOCLINE The functions `muu_svb_encode_s32` and `muu_svb_decode_s32` do the same for arrays of signed 32-bit integers, zigzag-encoding them so that integers of a small magnitude take up less bytes, defined below:
+
+			/* @DOCBEGIN
+			```
+			MUDEF inline size_m muu_svb_encode_s32(muByte* b, int32_m* n, size_m len);
+			MUDEF inline size_m muu_svb_decode_s32(muByte* b, size_m blen, int32_m* n, size_m len);
+			```
+			@DOCEND */
+
+			MUDEF inline size_m muu_svb_encode_s32(muByte* b, int32_m* n, size_m len) {
+				// Encode in blocks through a zigzag-encoded copy
+				uint32_m tmp[64];
+				size_m clen = (len+3)/4;
+				size_m dlen = 0;
+				for (size_m i = 0; i < len; i += 64) {
+					size_m cnt = (len - i < 64) ? len - i : 64;
+					for (size_m j = 0; j < cnt; ++j) {
+						uint32_m un = *(uint32_m*)&n[i+j];
+						tmp[j] = (un << 1) ^ (0 - (un >> 31));
+					}
+					// Encode the block into a scratch layout, then move its data bytes
+					// after the data of the previous blocks
+					muByte blk[MU_SVB_MAX_SIZE(64)];
+					size_m bsize = muu_svb_encode_u32(blk, tmp, cnt);
+					size_m bclen = (cnt+3)/4;
+					mu_memcpy(&b[i/4], blk, bclen);
+					mu_memcpy(&b[clen + dlen], &blk[bclen], bsize - bclen);
+					dlen += bsize - bclen;
+				}
+				return clen + dlen;
+			}
+
+			MUDEF inline size_m muu_svb_decode_s32(muByte* b, size_m blen, int32_m* n, size_m len) {
+				size_m r = muu_svb_decode_u32(b, blen, (uint32_m*)n, len);
+				if (r == 0) {
+					return 0;
+				}
+				for (size_m i = 0; i < len; ++i) {
+					uint32_m un = *(uint32_m*)&n[i];
+					un = (un >> 1) ^ (0 - (un & 1));
+					n[i] = *(int32_m*)&un;
+				}
+				return r;
+			}
+
+		// @DOCLINE ## Arrays
+
+			// @DOCLINE Every byte manipulation function also has an array version, which reads or writes `len` consecutive values at once. Array reading functions take in a pointer of bytes as their first parameter, a pointer to the array being filled as their second parameter, and the amount of values as their third parameter; for example, `muu_rbeu32_array` is defined as:
+
+			/* @DOCBEGIN
+			```
+			MUDEF inline void muu_rbeu32_array(muByte* b, uint32_m* n, size_m len);
+			```
+			@DOCEND */
+
+			// @DOCLINE Array writing functions follow the same format, with the second parameter being the array of values to be written. The byte data and the array are allowed to point to the same memory (except for 24-bit arrays, whose byte data and array sizes differ), but are otherwise not allowed to overlap.
+
+			// @DOCLINE When the byte order of the data matches the byte order of the host, the array functions are equivalent to a `mu_memcpy` call, which is skipped if the byte data and the array point to the same memory; otherwise, they are byte-swapped in bulk, using SSE2, SSSE3, or AVX2 (see `MU_SSE2`, `MU_SSSE3`, and `MU_AVX2`, as well as `MU_CPU_DISPATCH`) if available, and falling back to a scalar loop otherwise.
+
+			// @DOCLINE The macros for these functions follow the same naming convention as the single-value functions, with `_ARRAY` appended at the end; for example, the function `muu_rbeu32_array` is primarily referenced via the macro `MU_RBEU32_ARRAY`, and is overridable in the same way.
+
+			// Internal copy for arrays whose byte order matches the host; the byte data and the
+			// array may be the same memory, in which case there's nothing to do, and calling
+			// memcpy with identical pointers would be undefined
+			MUDEF inline void muu_inner_array_copy(void* d, void* s, size_m bytes) {
+				if (d != s) {
+					mu_memcpy(d, s, bytes);
+				}
+			}
+
+			// Internal SSSE3 and AVX2 byte-swapping parts; these reverse the byte order of each
+			// 'size'-byte element in the first 'bytes' bytes of 's', storing the result in 'd',
+			// for as many full vectors as fit, and return the amount of bytes processed. They're
+			// compiled if the instruction set is available at compile time or if runtime
+			// dispatch is enabled (see `MU_CPU_DISPATCH`).
+
+			#if defined(MU_SSSE3) || defined(MU_CPU_DISPATCH)
+				MUDEF inline MU_TARGET("ssse3") size_m muu_inner_bswap_ssse3(muByte* d, muByte* s, size_m bytes, size_m size) {
+					const __m128i mask =
+						(size == 2) ? _mm_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14) :
+						(size == 4) ? _mm_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12) :
+						              _mm_setr_epi8(7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8);
+					size_m i = 0;
+					for (; i + 16 <= bytes; i += 16) {
+						__m128i v = _mm_loadu_si128((const __m128i*)&s[i]);
+						_mm_storeu_si128((__m128i*)&d[i], _mm_shuffle_epi8(v, mask));
+					}
+					return i;
+				}
+			#endif
+
+			#if defined(MU_AVX2) || defined(MU_CPU_DISPATCH)
+				MUDEF inline MU_TARGET("avx2") size_m muu_inner_bswap_avx2(muByte* d, muByte* s, size_m bytes, size_m size) {
+					const __m256i mask = _mm256_broadcastsi128_si256(
+						(size == 2) ? _mm_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14) :
+						(size == 4) ? _mm_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12) :
+						              _mm_setr_epi8(7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8)
+					);
+					size_m i = 0;
+					for (; i + 32 <= bytes; i += 32) {
+						__m256i v = _mm256_loadu_si256((const __m256i*)&s[i]);
+						_mm256_storeu_si256((__m256i*)&d[i], _mm256_shuffle_epi8(v, mask));
+					}
+					return i;
+				}
+			#endif
+
+			// Runs the widest byte-swapping parts available, returning the amount of bytes
+			// processed
+			MUDEF inline size_m muu_inner_bswap_simd(muByte* d, muByte* s, size_m bytes, size_m size) {
+				size_m i = 0;
+				#if defined(MU_AVX2)
+					i = muu_inner_bswap_avx2(d, s, bytes, size);
+				#elif defined(MU_CPU_DISPATCH)
+					if (muu_cpu_has(MU_CPU_AVX2)) {
+						i = muu_inner_bswap_avx2(d, s, bytes, size);
+					}
+				#endif
+				#if defined(MU_SSSE3)
+					i += muu_inner_bswap_ssse3(d+i, s+i, bytes-i, size);
+				#elif defined(MU_CPU_DISPATCH)
+					if (muu_cpu_has(MU_CPU_SSSE3)) {
+						i += muu_inner_bswap_ssse3(d+i, s+i, bytes-i, size);
+					}
+				#else
+					(void)d; (void)s; (void)bytes; (void)size;
+				#endif
+				return i;
+			}
+
+			// Internal bulk byte-swapping kernels; these reverse the byte order of each element of
+			// 's' and store the result in 'd', with 'len' being the amount of elements. 'd' and 's'
+			// are allowed to be the same pointer. Whatever the SSSE3/AVX2 parts don't process is
+			// handled with SSE2 (which is all that's left if SSSE3 isn't available) and scalar
+			// code.
+
+			MUDEF inline void muu_inner_bswap16_array(muByte* d, muByte* s, size_m len) {
+				size_m i = muu_inner_bswap_simd(d, s, len*2, 2) / 2;
+				#if defined(MU_SSE2)
+					for (; i + 8 <= len; i += 8) {
+						__m128i v = _mm_loadu_si128((const __m128i*)&s[i*2]);
+						v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+						_mm_storeu_si128((__m128i*)&d[i*2], v);
+					}
+				#endif
+				for (; i < len; ++i) {
+					muByte b0 = s[i*2+0];
+					d[i*2+0] = s[i*2+1];
+					d[i*2+1] = b0;
+				}
+			}
+
+			MUDEF inline void muu_inner_bswap32_array(muByte* d, muByte* s, size_m len) {
+				size_m i = muu_inner_bswap_simd(d, s, len*4, 4) / 4;
+				#if defined(MU_SSE2)
+					for (; i + 4 <= len; i += 4) {
+						__m128i v = _mm_loadu_si128((const __m128i*)&s[i*4]);
+						// Swap bytes within each 16-bit pair, then swap the 16-bit pairs
+						v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+						v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2,3,0,1));
+						v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2,3,0,1));
+						_mm_storeu_si128((__m128i*)&d[i*4], v);
+					}
+				#endif
+				for (; i < len; ++i) {
+					muByte b0 = s[i*4+0], b1 = s[i*4+1];
+					d[i*4+0] = s[i*4+3];
+					d[i*4+1] = s[i*4+2];
+					d[i*4+2] = b1;
+					d[i*4+3] = b0;
+				}
+			}
+
+			MUDEF inline void muu_inner_bswap64_array(muByte* d, muByte* s, size_m len) {
+				size_m i = muu_inner_bswap_simd(d, s, len*8, 8) / 8;
+				#if defined(MU_SSE2)
+					for (; i + 2 <= len; i += 2) {
+						__m128i v = _mm_loadu_si128((const __m128i*)&s[i*8]);
+						// Swap bytes within each 16-bit pair, then reverse the 16-bit pairs
+						v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+						v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0,1,2,3));
+						v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0,1,2,3));
+						_mm_storeu_si128((__m128i*)&d[i*8], v);
+					}
+				#endif
+				for (; i < len; ++i) {
+					muByte t[8];
+					for (size_m j = 0; j < 8; ++j) {
+						t[j] = s[i*8+7-j];
+					}
+					for (size_m j = 0; j < 8; ++j) {
+						d[i*8+j] = t[j];
+					}
+				}
+			}
+
+			// Internal packed 24-bit kernels; these convert as many of the 'len' packed 24-bit
+			// values in 'b' from/to the 32-bit values in 'n' as they can with SIMD, and return
+			// the amount of values converted, leaving the rest to the scalar accessors. 'be'
+			// selects big-endian byte data, and 'sign' selects sign-extension when reading.
+			// Every 16-byte load and store stays within the packed data, which is why the last
+			// group of values is always left to the scalar accessors. Like the byte-swapping
+			// parts, the SSSE3 and AVX2 parts are chosen at runtime if dispatch is enabled.
+
+			#if defined(MU_SSSE3) || defined(MU_CPU_DISPATCH)
+				MUDEF inline MU_TARGET("ssse3") size_m muu_inner_r24_ssse3(muByte* b, uint32_m* n, size_m len, muBool be, muBool sign) {
+					// Places each value in the upper 3 bytes of its 32-bit lane, and then shifts
+					// it down, which either sign-extends or zero-extends it
+					const __m128i mask = be ?
+						_mm_setr_epi8(-1,2,1,0, -1,5,4,3, -1,8,7,6, -1,11,10,9) :
+						_mm_setr_epi8(-1,0,1,2, -1,3,4,5, -1,6,7,8, -1,9,10,11);
+					size_m i = 0;
+					for (; (i+4)*3 + 4 <= len*3; i += 4) {
+						__m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&b[i*3]), mask);
+						v = sign ? _mm_srai_epi32(v, 8) : _mm_srli_epi32(v, 8);
+						_mm_storeu_si128((__m128i*)&n[i], v);
+					}
+					return i;
+				}
+
+				MUDEF inline MU_TARGET("ssse3") size_m muu_inner_w24_ssse3(muByte* b, uint32_m* n, size_m len, muBool be) {
+					// Packs the lower 3 bytes of each 32-bit lane into the first 12 bytes; the
+					// last 4 bytes stored are zero, and get overwritten by the next group
+					const __m128i mask = be ?
+						_mm_setr_epi8(2,1,0, 6,5,4, 10,9,8, 14,13,12, -1,-1,-1,-1) :
+						_mm_setr_epi8(0,1,2, 4,5,6, 8,9,10, 12,13,14, -1,-1,-1,-1);
+					size_m i = 0;
+					for (; (i+4)*3 + 4 <= len*3; i += 4) {
+						__m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&n[i]), mask);
+						_mm_storeu_si128((__m128i*)&b[i*3], v);
+					}
+					return i;
+				}
+			#endif
+
+			#if defined(MU_AVX2) || defined(MU_CPU_DISPATCH)
+				MUDEF inline MU_TARGET("avx2") size_m muu_inner_r24_avx2(muByte* b, uint32_m* n, size_m len, muBool be, muBool sign) {
+					const __m256i mask = _mm256_broadcastsi128_si256(be ?
+						_mm_setr_epi8(-1,2,1,0, -1,5,4,3, -1,8,7,6, -1,11,10,9) :
+						_mm_setr_epi8(-1,0,1,2, -1,3,4,5, -1,6,7,8, -1,9,10,11)
+					);
+					size_m i = 0;
+					for (; (i+8)*3 + 4 <= len*3; i += 8) {
+						__m256i v = _mm256_inserti128_si256(
+							_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)&b[i*3])),
+							_mm_loadu_si128((const __m128i*)&b[i*3 + 12]), 1
+						);
+						v = _mm256_shuffle_epi8(v, mask);
+						v = sign ? _mm256_srai_epi32(v, 8) : _mm256_srli_epi32(v, 8);
+						_mm256_storeu_si256((__m256i*)&n[i], v);
+					}
+					return i;
+				}
+
+				MUDEF inline MU_TARGET("avx2") size_m muu_inner_w24_avx2(muByte* b, uint32_m* n, size_m len, muBool be) {
+					const __m256i mask = _mm256_broadcastsi128_si256(be ?
+						_mm_setr_epi8(2,1,0, 6,5,4, 10,9,8, 14,13,12, -1,-1,-1,-1) :
+						_mm_setr_epi8(0,1,2, 4,5,6, 8,9,10, 12,13,14, -1,-1,-1,-1)
+					);
+					size_m i = 0;
+					for (; (i+8)*3 + 4 <= len*3; i += 8) {
+						__m256i v = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)&n[i]), mask);
+						_mm_storeu_si128((__m128i*)&b[i*3], _mm256_castsi256_si128(v));
+						_mm_storeu_si128((__m128i*)&b[i*3 + 12], _mm256_extracti128_si256(v, 1));
+					}
+					return i;
+				}
+			#endif
+
+			MUDEF inline size_m muu_inner_r24_simd(muByte* b, uint32_m* n, size_m len, muBool be, muBool sign) {
+				size_m i = 0;
+				#if defined(MU_AVX2)
+					i = muu_inner_r24_avx2(b, n, len, be, sign);
+				#elif defined(MU_CPU_DISPATCH)
+					if (muu_cpu_has(MU_CPU_AVX2)) {
+						i = muu_inner_r24_avx2(b, n, len, be, sign);
+					}
+				#endif
+				#if defined(MU_SSSE3)
+					i += muu_inner_r24_ssse3(&b[i*3], &n[i], len-i, be, sign);
+				#elif defined(MU_CPU_DISPATCH)
+					if (muu_cpu_has(MU_CPU_SSSE3)) {
+						i += muu_inner_r24_ssse3(&b[i*3], &n[i], len-i, be, sign);
+					}
+				#else
+					(void)b; (void)n; (void)len; (void)be; (void)sign;
+				#endif
+				return i;
+			}
+
+			MUDEF inline size_m muu_inner_w24_simd(muByte* b, uint32_m* n, size_m len, muBool be) {
+				size_m i = 0;
+				#if defined(MU_AVX2)
+					i = muu_inner_w24_avx2(b, n, len, be);
+				#elif defined(MU_CPU_DISPATCH)
+					if (muu_cpu_has(MU_CPU_AVX2)) {
+						i = muu_inner_w24_avx2(b, n, len, be);
+					}
+				#endif
+				#if defined(MU_SSSE3)
+					i += muu_inner_w24_ssse3(&b[i*3], &n[i], len-i, be);
+				#elif defined(MU_CPU_DISPATCH)
+					if (muu_cpu_has(MU_CPU_SSSE3)) {
+						i += muu_inner_w24_ssse3(&b[i*3], &n[i], len-i, be);
+					}
+				#else
+					(void)b; (void)n; (void)len; (void)be;
+				#endif
+				return i;
+			}
+
+			// @DOCLINE ### 8-bit arrays
+
+				// @DOCLINE The following macros exist for byte manipulation regarding arrays of 8-bit integers:
+
+				// @DOCLINE * `MU_RLEU8_ARRAY` - reads an array of unsigned 8-bit integers from little-endian byte data; overridable macro to `muu_rleu8_array`.
+				#ifndef MU_RLEU8_ARRAY
+					MUDEF inline void muu_rleu8_array(muByte* b, uint8_m* n, size_m len) {
+						muu_inner_array_copy(n, b, len);
+					}
+					#define MU_RLEU8_ARRAY muu_rleu8_array
+				#endif
+
+				// @DOCLINE * `MU_RLES8_ARRAY` - reads an array of signed 8-bit integers from little-endian byte data; overridable macro to `muu_rles8_array`.
+				#ifndef MU_RLES8_ARRAY
+					MUDEF inline void muu_rles8_array(muByte* b, int8_m* n, size_m len) {
+						muu_inner_array_copy(n, b, len);
+					}
+					#define MU_RLES8_ARRAY muu_rles8_array
+				#endif
+
+				// @DOCLINE * `MU_WLEU8_ARRAY` - writes an array of unsigned 8-bit integers to little-endian byte data; overridable macro to `muu_wleu8_array`.
+				#ifndef MU_WLEU8_ARRAY
+					MUDEF inline void muu_wleu8_array(muByte* b, uint8_m* n, size_m len) {
+						muu_inner_array_copy(b, n, len);
+					}
+					#define MU_WLEU8_ARRAY muu_wleu8_array
+				#endif
+
+				// @DOCLINE * `MU_WLES8_ARRAY` - writes an array of signed 8-bit integers to little-endian byte data; overridable macro to `muu_wles8_array`.
+				#ifndef MU_WLES8_ARRAY
+					MUDEF inline void muu_wles8_array(muByte* b, int8_m* n, size_m len) {
+						muu_inner_array_copy(b, n, len);
+					}
+					#define MU_WLES8_ARRAY muu_wles8_array
+				#endif
+
+				// @DOCLINE * `MU_RBEU8_ARRAY` - reads an array of unsigned 8-bit integers from big-endian byte data; overridable macro to `muu_rbeu8_array`.
+				#ifndef MU_RBEU8_ARRAY
+					MUDEF inline void muu_rbeu8_array(muByte* b, uint8_m* n, size_m len) {
+						muu_inner_array_copy(n, b, len);
+					}
+					#define MU_RBEU8_ARRAY muu_rbeu8_array
+				#endif
+
+				// @DOCLINE * `MU_RBES8_ARRAY` - reads an array of signed 8-bit integers from big-endian byte data; overridable macro to `muu_rbes8_array`.
+				#ifndef MU_RBES8_ARRAY
+					MUDEF inline void muu_rbes8_array(muByte* b, int8_m* n, size_m len) {
+						muu_inner_array_copy(n, b, len);
+					}
+					#define MU_RBES8_ARRAY muu_rbes8_array
+				#endif
+
+				// @DOCLINE * `MU_WBEU8_ARRAY` - writes an array of unsigned 8-bit integers to big-endian byte data; overridable macro to `muu_wbeu8_array`.
+				#ifndef MU_WBEU8_ARRAY
+					MUDEF inline void muu_wbeu8_array(muByte* b, uint8_m* n, size_m len) {
+						muu_inner_array_copy(b, n, len);
+					}
+					#define MU_WBEU8_ARRAY muu_wbeu8_array
+				#endif
+
+				// @DOCLINE * `MU_WBES8_ARRAY` - writes an array of signed 8-bit integers to big-endian byte data; overridable macro to `muu_wbes8_array`.
+				#ifndef MU_WBES8_ARRAY
+					MUDEF inline void muu_wbes8_array(muByte* b, int8_m* n, size_m len) {
+						muu_inner_array_copy(b, n, len);
+					}
+					#define MU_WBES8_ARRAY muu_wbes8_array
+				#endif
+
+			// @DOCLINE ### 16-bit arrays
+
+				// @DOCLINE The following macros exist for byte manipulation regarding arrays of 16-bit integers:
+
+				// @DOCLINE * `MU_RLEU16_ARRAY` - reads an array of unsigned 16-bit integers from little-endian byte data; overridable macro to `muu_rleu16_array`.
+				#ifndef MU_RLEU16_ARRAY
+					MUDEF inline void muu_rleu16_array(muByte* b, uint16_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(n, b, len*2);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap16_array((muByte*)n, b, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RLEU16(&b[i*2]);
+							}
+						#endif
+					}
+					#define MU_RLEU16_ARRAY muu_rleu16_array
+				#endif
+
+				// @DOCLINE * `MU_RLES16_ARRAY` - reads an array of signed 16-bit integers from little-endian byte data; overridable macro to `muu_rles16_array`.
+				#ifndef MU_RLES16_ARRAY
+					MUDEF inline void muu_rles16_array(muByte* b, int16_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(n, b, len*2);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap16_array((muByte*)n, b, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RLES16(&b[i*2]);
+							}
+						#endif
+					}
+					#define MU_RLES16_ARRAY muu_rles16_array
+				#endif
+
+				// @DOCLINE * `MU_WLEU16_ARRAY` - writes an array of unsigned 16-bit integers to little-endian byte data; overridable macro to `muu_wleu16_array`.
+				#ifndef MU_WLEU16_ARRAY
+					MUDEF inline void muu_wleu16_array(muByte* b, uint16_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(b, n, len*2);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap16_array(b, (muByte*)n, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WLEU16(&b[i*2], n[i]);
+							}
+						#endif
+					}
+					#define MU_WLEU16_ARRAY muu_wleu16_array
+				#endif
+
+				// @DOCLINE * `MU_WLES16_ARRAY` - writes an array of signed 16-bit integers to little-endian byte data; overridable macro to `muu_wles16_array`.
+				#ifndef MU_WLES16_ARRAY
+					MUDEF inline void muu_wles16_array(muByte* b, int16_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(b, n, len*2);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap16_array(b, (muByte*)n, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WLES16(&b[i*2], n[i]);
+							}
+						#endif
+					}
+					#define MU_WLES16_ARRAY muu_wles16_array
+				#endif
+
+				// @DOCLINE * `MU_RBEU16_ARRAY` - reads an array of unsigned 16-bit integers from big-endian byte data; overridable macro to `muu_rbeu16_array`.
+				#ifndef MU_RBEU16_ARRAY
+					MUDEF inline void muu_rbeu16_array(muByte* b, uint16_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap16_array((muByte*)n, b, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(n, b, len*2);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RBEU16(&b[i*2]);
+							}
+						#endif
+					}
+					#define MU_RBEU16_ARRAY muu_rbeu16_array
+				#endif
+
+				// @DOCLINE * `MU_RBES16_ARRAY` - reads an array of signed 16-bit integers from big-endian byte data; overridable macro to `muu_rbes16_array`.
+				#ifndef MU_RBES16_ARRAY
+					MUDEF inline void muu_rbes16_array(muByte* b, int16_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap16_array((muByte*)n, b, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(n, b, len*2);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RBES16(&b[i*2]);
+							}
+						#endif
+					}
+					#define MU_RBES16_ARRAY muu_rbes16_array
+				#endif
+
+				// @DOCLINE * `MU_WBEU16_ARRAY` - writes an array of unsigned 16-bit integers to big-endian byte data; overridable macro to `muu_wbeu16_array`.
+				#ifndef MU_WBEU16_ARRAY
+					MUDEF inline void muu_wbeu16_array(muByte* b, uint16_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap16_array(b, (muByte*)n, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(b, n, len*2);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WBEU16(&b[i*2], n[i]);
+							}
+						#endif
+					}
+					#define MU_WBEU16_ARRAY muu_wbeu16_array
+				#endif
+
+				// @DOCLINE * `MU_WBES16_ARRAY` - writes an array of signed 16-bit integers to big-endian byte data; overridable macro to `muu_wbes16_array`.
+				#ifndef MU_WBES16_ARRAY
+					MUDEF inline void muu_wbes16_array(muByte* b, int16_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap16_array(b, (muByte*)n, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(b, n, len*2);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WBES16(&b[i*2], n[i]);
+							}
+						#endif
+					}
+					#define MU_WBES16_ARRAY muu_wbes16_array
+				#endif
+
+			// @DOCLINE ### 24-bit arrays
+
+				// @DOCLINE The following macros exist for byte manipulation regarding arrays of 24-bit integers:
+
+				// @DOCLINE * `MU_RLEU24_ARRAY` - reads an array of unsigned 24-bit integers from little-endian byte data; overridable macro to `muu_rleu24_array`.
+				#ifndef MU_RLEU24_ARRAY
+					MUDEF inline void muu_rleu24_array(muByte* b, uint32_m* n, size_m len) {
+						for (size_m i = muu_inner_r24_simd(b, n, len, MU_FALSE, MU_FALSE); i < len; ++i) {
+							n[i] = MU_RLEU24(&b[i*3]);
+						}
+					}
+					#define MU_RLEU24_ARRAY muu_rleu24_array
+				#endif
+
+				// @DOCLINE * `MU_RLES24_ARRAY` - reads an array of signed 24-bit integers from little-endian byte data; overridable macro to `muu_rles24_array`.
+				#ifndef MU_RLES24_ARRAY
+					MUDEF inline void muu_rles24_array(muByte* b, int32_m* n, size_m len) {
+						for (size_m i = muu_inner_r24_simd(b, (uint32_m*)n, len, MU_FALSE, MU_TRUE); i < len; ++i) {
+							n[i] = MU_RLES24(&b[i*3]);
+						}
+					}
+					#define MU_RLES24_ARRAY muu_rles24_array
+				#endif
+
+				// @DOCLINE * `MU_WLEU24_ARRAY` - writes an array of unsigned 24-bit integers to little-endian byte data; overridable macro to `muu_wleu24_array`.
+				#ifndef MU_WLEU24_ARRAY
+					MUDEF inline void muu_wleu24_array(muByte* b, uint32_m* n, size_m len) {
+						for (size_m i = muu_inner_w24_simd(b, n, len, MU_FALSE); i < len; ++i) {
+							MU_WLEU24(&b[i*3], n[i]);
+						}
+					}
+					#define MU_WLEU24_ARRAY muu_wleu24_array
+				#endif
+
+				// @DOCLINE * `MU_WLES24_ARRAY` - writes an array of signed 24-bit integers to little-endian byte data; overridable macro to `muu_wles24_array`.
+				#ifndef MU_WLES24_ARRAY
+					MUDEF inline void muu_wles24_array(muByte* b, int32_m* n, size_m len) {
+						for (size_m i = muu_inner_w24_simd(b, (uint32_m*)n, len, MU_FALSE); i < len; ++i) {
+							MU_WLES24(&b[i*3], n[i]);
+						}
+					}
+					#define MU_WLES24_ARRAY muu_wles24_array
+				#endif
+
+				// @DOCLINE * `MU_RBEU24_ARRAY` - reads an array of unsigned 24-bit integers from big-endian byte data; overridable macro to `muu_rbeu24_array`.
+				#ifndef MU_RBEU24_ARRAY
+					MUDEF inline void muu_rbeu24_array(muByte* b, uint32_m* n, size_m len) {
+						for (size_m i = muu_inner_r24_simd(b, n, len, MU_TRUE, MU_FALSE); i < len; ++i) {
+							n[i] = MU_RBEU24(&b[i*3]);
+						}
+					}
+					#define MU_RBEU24_ARRAY muu_rbeu24_array
+				#endif
+
+				// @DOCLINE * `MU_RBES24_ARRAY` - reads an array of signed 24-bit integers from big-endian byte data; overridable macro to `muu_rbes24_array`.
+				#ifndef MU_RBES24_ARRAY
+					MUDEF inline void muu_rbes24_array(muByte* b, int32_m* n, size_m len) {
+						for (size_m i = muu_inner_r24_simd(b, (uint32_m*)n, len, MU_TRUE, MU_TRUE); i < len; ++i) {
+							n[i] = MU_RBES24(&b[i*3]);
+						}
+					}
+					#define MU_RBES24_ARRAY muu_rbes24_array
+				#endif
+
+				// @DOCLINE * `MU_WBEU24_ARRAY` - writes an array of unsigned 24-bit integers to big-endian byte data; overridable macro to `muu_wbeu24_array`.
+				#ifndef MU_WBEU24_ARRAY
+					MUDEF inline void muu_wbeu24_array(muByte* b, uint32_m* n, size_m len) {
+						for (size_m i = muu_inner_w24_simd(b, n, len, MU_TRUE); i < len; ++i) {
+							MU_WBEU24(&b[i*3], n[i]);
+						}
+					}
+					#define MU_WBEU24_ARRAY muu_wbeu24_array
+				#endif
+
+				// @DOCLINE * `MU_WBES24_ARRAY` - writes an array of signed 24-bit integers to big-endian byte data; overridable macro to `muu_wbes24_array`.
+				#ifndef MU_WBES24_ARRAY
+					MUDEF inline void muu_wbes24_array(muByte* b, int32_m* n, size_m len) {
+						for (size_m i = muu_inner_w24_simd(b, (uint32_m*)n, len, MU_TRUE); i < len; ++i) {
+							MU_WBES24(&b[i*3], n[i]);
+						}
+					}
+					#define MU_WBES24_ARRAY muu_wbes24_array
+				#endif
+
+			// @DOCLINE ### 24-bit sample arrays
+
+				// @DOCLINE 24-bit integers are most commonly used for packed audio samples, so muUtility also defines array functions that convert between signed 24-bit integers and normalized 32-bit floats, in which the range of a signed 24-bit integer (-8388608 to 8388607) maps to the range -1.0 to 1.0 (more precisely, a value is divided by 8388608 upon reading, and multiplied by 8388608 upon writing). Upon writing, values outside of this range are clamped, NaN values are written as 0, and values are rounded to the nearest integer, with ties rounded to even (regardless of whether SIMD is used). The conversion between integers and floats uses SSE2 (see `MU_SSE2`), and the packing and unpacking of the 24-bit integers uses SSSE3 or AVX2 like the 24-bit integer arrays (see `MU_SSSE3`, `MU_AVX2`, and `MU_CPU_DISPATCH`), each falling back to a scalar loop if unavailable; for example, `muu_rles24_f32_array` is defined as:
+
+				/* @DOCBEGIN
+				```
+				MUDEF inline void muu_rles24_f32_array(muByte* b, float* n, size_m len);
+				```
+				@DOCEND */
+
+				// Internal conversion kernels between 32-bit integers and floats
+
+				MUDEF inline void muu_inner_s32_to_f32(int32_m* s, float* d, size_m len, float scale) {
+					size_m i = 0;
+					#ifdef MU_SSE2
+						const __m128 vscale = _mm_set1_ps(scale);
+						for (; i + 4 <= len; i += 4) {
+							__m128 v = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)&s[i]));
+							_mm_storeu_ps(&d[i], _mm_mul_ps(v, vscale));
+						}
+					#endif
+					for (; i < len; ++i) {
+						d[i] = (float)s[i] * scale;
+					}
+				}
+
+				MUDEF inline void muu_inner_f32_to_s32(float* s, int32_m* d, size_m len, float scale, float lo, float hi) {
+					size_m i = 0;
+					#ifdef MU_SSE2
+						const __m128 vscale = _mm_set1_ps(scale), vlo = _mm_set1_ps(lo), vhi = _mm_set1_ps(hi);
+						for (; i + 4 <= len; i += 4) {
+							// max_ps returns its second operand for NaN, so NaN clamps to 'lo'; it
+							// is then zeroed by the comparison mask
+							__m128 x = _mm_loadu_ps(&s[i]);
+							__m128 v = _mm_mul_ps(x, vscale);
+							v = _mm_min_ps(_mm_max_ps(v, vlo), vhi);
+							v = _mm_and_ps(v, _mm_cmpeq_ps(x, x));
+							_mm_storeu_si128((__m128i*)&d[i], _mm_cvtps_epi32(v));
+						}
+					#endif
+					for (; i < len; ++i) {
+						// NaN is detected by its bits, as -ffast-math may assume v == v
+						uint32_m u;
+						mu_memcpy(&u, &s[i], 4);
+						if ((u & 0x7FFFFFFF) > 0x7F800000) {
+							d[i] = 0;
+							continue;
+						}
+						float v = s[i] * scale;
+						if (v < lo) {
+							v = lo;
+						}
+						if (v > hi) {
+							v = hi;
+						}
+						// Rounds to nearest-even like cvtps does, by truncating and then adjusting
+						// by the fractional part, which is exact since v is clamped to 24 bits
+						int32_m t = (int32_m)v;
+						float f = v - (float)t;
+						if (f > 0.5f || (f == 0.5f && (t & 1))) {
+							++t;
+						} else if (f < -0.5f || (f == -0.5f && (t & 1))) {
+							--t;
+						}
+						d[i] = t;
+					}
+				}
+
+				// @DOCLINE The following macros exist for converting arrays of 24-bit samples:
+
+				// @DOCLINE * `MU_RLES24_F32_ARRAY` - reads an array of signed 24-bit integers from little-endian byte data as normalized floats; overridable macro to `muu_rles24_f32_array`.
+				#ifndef MU_RLES24_F32_ARRAY
+					MUDEF inline void muu_rles24_f32_array(muByte* b, float* n, size_m len) {
+						int32_m tmp[256];
+						for (size_m i = 0; i < len; i += 256) {
+							size_m cnt = (len - i < 256) ? len - i : 256;
+							MU_RLES24_ARRAY(&b[i*3], tmp, cnt);
+							muu_inner_s32_to_f32(tmp, &n[i], cnt, 1.f / 8388608.f);
+						}
+					}
+					#define MU_RLES24_F32_ARRAY muu_rles24_f32_array
+				#endif
+
+				// @DOCLINE * `MU_WLES24_F32_ARRAY` - writes an array of normalized floats to little-endian byte data as signed 24-bit integers; overridable macro to `muu_wles24_f32_array`.
+				#ifndef MU_WLES24_F32_ARRAY
+					MUDEF inline void muu_wles24_f32_array(muByte* b, float* n, size_m len) {
+						int32_m tmp[256];
+						for (size_m i = 0; i < len; i += 256) {
+							size_m cnt = (len - i < 256) ? len - i : 256;
+							muu_inner_f32_to_s32(&n[i], tmp, cnt, 8388608.f, -8388608.f, 8388607.f);
+							MU_WLES24_ARRAY(&b[i*3], tmp, cnt);
+						}
+					}
+					#define MU_WLES24_F32_ARRAY muu_wles24_f32_array
+				#endif
+
+				// @DOCLINE * `MU_RBES24_F32_ARRAY` - reads an array of signed 24-bit integers from big-endian byte data as normalized floats; overridable macro to `muu_rbes24_f32_array`.
+				#ifndef MU_RBES24_F32_ARRAY
+					MUDEF inline void muu_rbes24_f32_array(muByte* b, float* n, size_m len) {
+						int32_m tmp[256];
+						for (size_m i = 0; i < len; i += 256) {
+							size_m cnt = (len - i < 256) ? len - i : 256;
+							MU_RBES24_ARRAY(&b[i*3], tmp, cnt);
+							muu_inner_s32_to_f32(tmp, &n[i], cnt, 1.f / 8388608.f);
+						}
+					}
+					#define MU_RBES24_F32_ARRAY muu_rbes24_f32_array
+				#endif
+
+				// @DOCLINE * `MU_WBES24_F32_ARRAY` - writes an array of normalized floats to big-endian byte data as signed 24-bit integers; overridable macro to `muu_wbes24_f32_array`.
+				#ifndef MU_WBES24_F32_ARRAY
+					MUDEF inline void muu_wbes24_f32_array(muByte* b, float* n, size_m len) {
+						int32_m tmp[256];
+						for (size_m i = 0; i < len; i += 256) {
+							size_m cnt = (len - i < 256) ? len - i : 256;
+							muu_inner_f32_to_s32(&n[i], tmp, cnt, 8388608.f, -8388608.f, 8388607.f);
+							MU_WBES24_ARRAY(&b[i*3], tmp, cnt);
+						}
+					}
+					#define MU_WBES24_F32_ARRAY muu_wbes24_f32_array
+				#endif
+
+			// @DOCLINE ### 32-bit arrays
+
+				// @DOCLINE The following macros exist for byte manipulation regarding arrays of 32-bit integers:
+
+				// @DOCLINE * `MU_RLEU32_ARRAY` - reads an array of unsigned 32-bit integers from little-endian byte data; overridable macro to `muu_rleu32_array`.
+				#ifndef MU_RLEU32_ARRAY
+					MUDEF inline void muu_rleu32_array(muByte* b, uint32_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(n, b, len*4);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap32_array((muByte*)n, b, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RLEU32(&b[i*4]);
+							}
+						#endif
+					}
+					#define MU_RLEU32_ARRAY muu_rleu32_array
+				#endif
+
+				// @DOCLINE * `MU_RLES32_ARRAY` - reads an array of signed 32-bit integers from little-endian byte data; overridable macro to `muu_rles32_array`.
+				#ifndef MU_RLES32_ARRAY
+					MUDEF inline void muu_rles32_array(muByte* b, int32_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(n, b, len*4);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap32_array((muByte*)n, b, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RLES32(&b[i*4]);
+							}
+						#endif
+					}
+					#define MU_RLES32_ARRAY muu_rles32_array
+				#endif
+
+				// @DOCLINE * `MU_WLEU32_ARRAY` - writes an array of unsigned 32-bit integers to little-endian byte data; overridable macro to `muu_wleu32_array`.
+				#ifndef MU_WLEU32_ARRAY
+					MUDEF inline void muu_wleu32_array(muByte* b, uint32_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(b, n, len*4);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap32_array(b, (muByte*)n, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WLEU32(&b[i*4], n[i]);
+							}
+						#endif
+					}
+					#define MU_WLEU32_ARRAY muu_wleu32_array
+				#endif
+
+				// @DOCLINE * `MU_WLES32_ARRAY` - writes an array of signed 32-bit integers to little-endian byte data; overridable macro to `muu_wles32_array`.
+				#ifndef MU_WLES32_ARRAY
+					MUDEF inline void muu_wles32_array(muByte* b, int32_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(b, n, len*4);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap32_array(b, (muByte*)n, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WLES32(&b[i*4], n[i]);
+							}
+						#endif
+					}
+					#define MU_WLES32_ARRAY muu_wles32_array
+				#endif
+
+				// @DOCLINE * `MU_RBEU32_ARRAY` - reads an array of unsigned 32-bit integers from big-endian byte data; overridable macro to `muu_rbeu32_array`.
+				#ifndef MU_RBEU32_ARRAY
+					MUDEF inline void muu_rbeu32_array(muByte* b, uint32_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap32_array((muByte*)n, b, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(n, b, len*4);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RBEU32(&b[i*4]);
+							}
+						#endif
+					}
+					#define MU_RBEU32_ARRAY muu_rbeu32_array
+				#endif
+
+				// @DOCLINE * `MU_RBES32_ARRAY` - reads an array of signed 32-bit integers from big-endian byte data; overridable macro to `muu_rbes32_array`.
+				#ifndef MU_RBES32_ARRAY
+					MUDEF inline void muu_rbes32_array(muByte* b, int32_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap32_array((muByte*)n, b, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(n, b, len*4);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RBES32(&b[i*4]);
+							}
+						#endif
+					}
+					#define MU_RBES32_ARRAY muu_rbes32_array
+				#endif
+
+				// @DOCLINE * `MU_WBEU32_ARRAY` - writes an array of unsigned 32-bit integers to big-endian byte data; overridable macro to `muu_wbeu32_array`.
+				#ifndef MU_WBEU32_ARRAY
+					MUDEF inline void muu_wbeu32_array(muByte* b, uint32_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap32_array(b, (muByte*)n, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(b, n, len*4);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WBEU32(&b[i*4], n[i]);
+							}
+						#endif
+					}
+					#define MU_WBEU32_ARRAY muu_wbeu32_array
+				#endif
+
+				// @DOCLINE * `MU_WBES32_ARRAY` - writes an array of signed 32-bit integers to big-endian byte data; overridable macro to `muu_wbes32_array`.
+				#ifndef MU_WBES32_ARRAY
+					MUDEF inline void muu_wbes32_array(muByte* b, int32_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap32_array(b, (muByte*)n, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(b, n, len*4);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WBES32(&b[i*4], n[i]);
+							}
+						#endif
+					}
+					#define MU_WBES32_ARRAY muu_wbes32_array
+				#endif
+
+			// @DOCLINE ### 64-bit arrays
+
+				// @DOCLINE The following macros exist for byte manipulation regarding arrays of 64-bit integers:
+
+				// @DOCLINE * `MU_RLEU64_ARRAY` - reads an array of unsigned 64-bit integers from little-endian byte data; overridable macro to `muu_rleu64_array`.
+				#ifndef MU_RLEU64_ARRAY
+					MUDEF inline void muu_rleu64_array(muByte* b, uint64_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(n, b, len*8);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap64_array((muByte*)n, b, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RLEU64(&b[i*8]);
+							}
+						#endif
+					}
+					#define MU_RLEU64_ARRAY muu_rleu64_array
+				#endif
+
+				// @DOCLINE * `MU_RLES64_ARRAY` - reads an array of signed 64-bit integers from little-endian byte data; overridable macro to `muu_rles64_array`.
+				#ifndef MU_RLES64_ARRAY
+					MUDEF inline void muu_rles64_array(muByte* b, int64_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(n, b, len*8);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap64_array((muByte*)n, b, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RLES64(&b[i*8]);
+							}
+						#endif
+					}
+					#define MU_RLES64_ARRAY muu_rles64_array
+				#endif
+
+				// @DOCLINE * `MU_WLEU64_ARRAY` - writes an array of unsigned 64-bit integers to little-endian byte data; overridable macro to `muu_wleu64_array`.
+				#ifndef MU_WLEU64_ARRAY
+					MUDEF inline void muu_wleu64_array(muByte* b, uint64_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(b, n, len*8);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap64_array(b, (muByte*)n, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WLEU64(&b[i*8], n[i]);
+							}
+						#endif
+					}
+					#define MU_WLEU64_ARRAY muu_wleu64_array
+				#endif
+
+				// @DOCLINE * `MU_WLES64_ARRAY` - writes an array of signed 64-bit integers to little-endian byte data; overridable macro to `muu_wles64_array`.
+				#ifndef MU_WLES64_ARRAY
+					MUDEF inline void muu_wles64_array(muByte* b, int64_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(b, n, len*8);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap64_array(b, (muByte*)n, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WLES64(&b[i*8], n[i]);
+							}
+						#endif
+					}
+					#define MU_WLES64_ARRAY muu_wles64_array
+				#endif
+
+				// @DOCLINE * `MU_RBEU64_ARRAY` - reads an array of unsigned 64-bit integers from big-endian byte data; overridable macro to `muu_rbeu64_array`.
+				#ifndef MU_RBEU64_ARRAY
+					MUDEF inline void muu_rbeu64_array(muByte* b, uint64_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap64_array((muByte*)n, b, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(n, b, len*8);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RBEU64(&b[i*8]);
+							}
+						#endif
+					}
+					#define MU_RBEU64_ARRAY muu_rbeu64_array
+				#endif
+
+				// @DOCLINE * `MU_RBES64_ARRAY` - reads an array of signed 64-bit integers from big-endian byte data; overridable macro to `muu_rbes64_array`.
+				#ifndef MU_RBES64_ARRAY
+					MUDEF inline void muu_rbes64_array(muByte* b, int64_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap64_array((muByte*)n, b, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(n, b, len*8);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RBES64(&b[i*8]);
+							}
+						#endif
+					}
+					#define MU_RBES64_ARRAY muu_rbes64_array
+				#endif
+
+				// @DOCLINE * `MU_WBEU64_ARRAY` - writes an array of unsigned 64-bit integers to big-endian byte data; overridable macro to `muu_wbeu64_array`.
+				#ifndef MU_WBEU64_ARRAY
+					MUDEF inline void muu_wbeu64_array(muByte* b, uint64_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap64_array(b, (muByte*)n, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(b, n, len*8);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WBEU64(&b[i*8], n[i]);
+							}
+						#endif
+					}
+					#define MU_WBEU64_ARRAY muu_wbeu64_array
+				#endif
+
+				// @DOCLINE * `MU_WBES64_ARRAY` - writes an array of signed 64-bit integers to big-endian byte data; overridable macro to `muu_wbes64_array`.
+				#ifndef MU_WBES64_ARRAY
+					MUDEF inline void muu_wbes64_array(muByte* b, int64_m* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap64_array(b, (muByte*)n, len);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(b, n, len*8);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WBES64(&b[i*8], n[i]);
+							}
+						#endif
+					}
+					#define MU_WBES64_ARRAY muu_wbes64_array
+				#endif
+
+			// @DOCLINE ### Floating-point arrays
+
+				// @DOCLINE The following macros exist for byte manipulation regarding arrays of `float` and `double` values, which work the same way as the integer arrays of the same size:
+
+				// @DOCLINE * `MU_RLEF32_ARRAY` - reads an array of floats from little-endian byte data; overridable macro to `muu_rlef32_array`.
+				#ifndef MU_RLEF32_ARRAY
+					MUDEF inline void muu_rlef32_array(muByte* b, float* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(n, b, len*4);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap32_array((muByte*)n, b, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RLEF32(&b[i*4]);
+							}
+						#endif
+					}
+					#define MU_RLEF32_ARRAY muu_rlef32_array
+				#endif
+
+				// @DOCLINE * `MU_WLEF32_ARRAY` - writes an array of floats to little-endian byte data; overridable macro to `muu_wlef32_array`.
+				#ifndef MU_WLEF32_ARRAY
+					MUDEF inline void muu_wlef32_array(muByte* b, float* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(b, n, len*4);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap32_array(b, (muByte*)n, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WLEF32(&b[i*4], n[i]);
+							}
+						#endif
+					}
+					#define MU_WLEF32_ARRAY muu_wlef32_array
+				#endif
+
+				// @DOCLINE * `MU_RBEF32_ARRAY` - reads an array of floats from big-endian byte data; overridable macro to `muu_rbef32_array`.
+				#ifndef MU_RBEF32_ARRAY
+					MUDEF inline void muu_rbef32_array(muByte* b, float* n, size_m len) {
+						#if defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(n, b, len*4);
+						#elif defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap32_array((muByte*)n, b, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RBEF32(&b[i*4]);
+							}
+						#endif
+					}
+					#define MU_RBEF32_ARRAY muu_rbef32_array
+				#endif
+
+				// @DOCLINE * `MU_WBEF32_ARRAY` - writes an array of floats to big-endian byte data; overridable macro to `muu_wbef32_array`.
+				#ifndef MU_WBEF32_ARRAY
+					MUDEF inline void muu_wbef32_array(muByte* b, float* n, size_m len) {
+						#if defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(b, n, len*4);
+						#elif defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap32_array(b, (muByte*)n, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WBEF32(&b[i*4], n[i]);
+							}
+						#endif
+					}
+					#define MU_WBEF32_ARRAY muu_wbef32_array
+				#endif
+
+				// @DOCLINE * `MU_RLEF64_ARRAY` - reads an array of doubles from little-endian byte data; overridable macro to `muu_rlef64_array`.
+				#ifndef MU_RLEF64_ARRAY
+					MUDEF inline void muu_rlef64_array(muByte* b, double* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(n, b, len*8);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap64_array((muByte*)n, b, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RLEF64(&b[i*8]);
+							}
+						#endif
+					}
+					#define MU_RLEF64_ARRAY muu_rlef64_array
+				#endif
+
+				// @DOCLINE * `MU_WLEF64_ARRAY` - writes an array of doubles to little-endian byte data; overridable macro to `muu_wlef64_array`.
+				#ifndef MU_WLEF64_ARRAY
+					MUDEF inline void muu_wlef64_array(muByte* b, double* n, size_m len) {
+						#if defined(MU_LITTLE_ENDIAN)
+							muu_inner_array_copy(b, n, len*8);
+						#elif defined(MU_BIG_ENDIAN)
+							muu_inner_bswap64_array(b, (muByte*)n, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WLEF64(&b[i*8], n[i]);
+							}
+						#endif
+					}
+					#define MU_WLEF64_ARRAY muu_wlef64_array
+				#endif
+
+				// @DOCLINE * `MU_RBEF64_ARRAY` - reads an array of doubles from big-endian byte data; overridable macro to `muu_rbef64_array`.
+				#ifndef MU_RBEF64_ARRAY
+					MUDEF inline void muu_rbef64_array(muByte* b, double* n, size_m len) {
+						#if defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(n, b, len*8);
+						#elif defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap64_array((muByte*)n, b, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								n[i] = MU_RBEF64(&b[i*8]);
+							}
+						#endif
+					}
+					#define MU_RBEF64_ARRAY muu_rbef64_array
+				#endif
+
+				// @DOCLINE * `MU_WBEF64_ARRAY` - writes an array of doubles to big-endian byte data; overridable macro to `muu_wbef64_array`.
+				#ifndef MU_WBEF64_ARRAY
+					MUDEF inline void muu_wbef64_array(muByte* b, double* n, size_m len) {
+						#if defined(MU_BIG_ENDIAN)
+							muu_inner_array_copy(b, n, len*8);
+						#elif defined(MU_LITTLE_ENDIAN)
+							muu_inner_bswap64_array(b, (muByte*)n, len);
+						#else
+							for (size_m i = 0; i < len; ++i) {
+								MU_WBEF64(&b[i*8], n[i]);
+							}
+						#endif
+					}
+					#define MU_WBEF64_ARRAY muu_wbef64_array
+				#endif
+
+			// @DOCLINE ### Half-precision arrays
+
+				// @DOCLINE The following macros exist for converting arrays of f16 and bf16 values in byte data from and to arrays of `float` values, with the same rounding as the single-value functions. Reading f16 values uses the F16C instructions `VCVTPH2PS` and `VCVTPS2PH` (8 values per instruction) if the compiler is targeting F16C (`__F16C__`, such as with `-mf16c` or `-march=haswell`) or if runtime dispatch is enabled (see `MU_CPU_DISPATCH`) and the CPU supports it. bf16 values are converted with SSE2 (see `MU_SSE2`) if available. Anything else falls back to a scalar loop. Unlike the integer arrays, the byte data and the array can't overlap, as their element sizes differ.
+
+				#if defined(MU_SSE2) && defined(__F16C__)
+					#define MUU_F16C
+					#include <immintrin.h>
+				#endif
+
+				// Internal F16C kernels; these convert as many of the 'len' f16 values in 'b'
+				// from/to the floats in 'n' as they can 8 at a time, and return the amount of
+				// values converted. 'swap' selects byte-swapping the 16-bit values, which is
+				// the case for big-endian data, as F16C implies a little-endian x86 host.
+
+				#if defined(MUU_F16C) || defined(MU_CPU_DISPATCH)
+					MUDEF inline MU_TARGET("avx,f16c") size_m muu_inner_rf16_f16c(muByte* b, float* n, size_m len, muBool swap) {
+						const __m128i mask = _mm_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14);
+						size_m i = 0;
+						for (; i + 8 <= len; i += 8) {
+							__m128i v = _mm_loadu_si128((const __m128i*)&b[i*2]);
+							if (swap) {
+								v = _mm_shuffle_epi8(v, mask);
+							}
+							_mm256_storeu_ps(&n[i], _mm256_cvtph_ps(v));
+						}
+						return i;
+					}
+
+					MUDEF inline MU_TARGET("avx,f16c") size_m muu_inner_wf16_f16c(muByte* b, float* n, size_m len, muBool swap) {
+						const __m128i mask = _mm_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14);
+						size_m i = 0;
+						for (; i + 8 <= len; i += 8) {
+							__m128i v = _mm256_cvtps_ph(_mm256_loadu_ps(&n[i]), _MM_FROUND_TO_NEAREST_INT);
+							if (swap) {
+								v = _mm_shuffle_epi8(v, mask);
+							}
+							_mm_storeu_si128((__m128i*)&b[i*2], v);
+						}
+						return i;
+					}
+				#endif
+
+				// Internal conversion loops; 'be' selects big-endian byte data
+
+				MUDEF inline void muu_inner_rf16_array(muByte* b, float* n, size_m len, muBool be) {
+					size_m i = 0;
+					#if defined(MUU_F16C)
+						i = muu_inner_rf16_f16c(b, n, len, be);
+					#elif defined(MU_CPU_DISPATCH)
+						if (muu_cpu_has(MU_CPU_F16C)) {
+							i = muu_inner_rf16_f16c(b, n, len, be);
+						}
+					#endif
+					for (; i < len; ++i) {
+						n[i] = be ? MU_RBEF16(&b[i*2]) : MU_RLEF16(&b[i*2]);
+					}
+				}
+
+				MUDEF inline void muu_inner_wf16_array(muByte* b, float* n, size_m len, muBool be) {
+					size_m i = 0;
+					#if defined(MUU_F16C)
+						i = muu_inner_wf16_f16c(b, n, len, be);
+					#elif defined(MU_CPU_DISPATCH)
+						if (muu_cpu_has(MU_CPU_F16C)) {
+							i = muu_inner_wf16_f16c(b, n, len, be);
+						}
+					#endif
+					for (; i < len; ++i) {
+						if (be) {
+							MU_WBEF16(&b[i*2], n[i]);
+						} else {
+							MU_WLEF16(&b[i*2], n[i]);
+						}
+					}
+				}
+
+				MUDEF inline void muu_inner_rbf16_array(muByte* b, float* n, size_m len, muBool be) {
+					size_m i = 0;
+					#if defined(MU_SSE2)
+						// Interleaving zeroes below each value places it in the upper half of
+						// its 32-bit lane
+						const __m128i zero = _mm_setzero_si128();
+						for (; i + 8 <= len; i += 8) {
+							__m128i v = _mm_loadu_si128((const __m128i*)&b[i*2]);
+							if (be) {
+								v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+							}
+							_mm_storeu_si128((__m128i*)&n[i], _mm_unpacklo_epi16(zero, v));
+							_mm_storeu_si128((__m128i*)&n[i+4], _mm_unpackhi_epi16(zero, v));
+						}
+					#endif
+					for (; i < len; ++i) {
+						n[i] = be ? MU_RBEBF16(&b[i*2]) : MU_RLEBF16(&b[i*2]);
+					}
+				}
+
+				#if defined(MU_SSE2)
+					// Rounds 4 floats to bf16, returning each one sign-extended in its 32-bit
+					// lane so that signed saturating packing keeps it intact
+					MUDEF inline __m128i muu_inner_bf16_round_sse2(__m128i u) {
+						__m128i lsb = _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(1));
+						__m128i r = _mm_srai_epi32(_mm_add_epi32(u, _mm_add_epi32(lsb, _mm_set1_epi32(0x7FFF))), 16);
+						__m128i nan = _mm_cmpgt_epi32(_mm_and_si128(u, _mm_set1_epi32(0x7FFFFFFF)), _mm_set1_epi32(0x7F800000));
+						__m128i q = _mm_or_si128(_mm_srai_epi32(u, 16), _mm_set1_epi32(0x40));
+						return _mm_or_si128(_mm_and_si128(nan, q), _mm_andnot_si128(nan, r));
+					}
+				#endif
+
+				MUDEF inline void muu_inner_wbf16_array(muByte* b, float* n, size_m len, muBool be) {
+					size_m i = 0;
+					#if defined(MU_SSE2)
+						for (; i + 8 <= len; i += 8) {
+							__m128i lo = muu_inner_bf16_round_sse2(_mm_loadu_si128((const __m128i*)&n[i]));
+							__m128i hi = muu_inner_bf16_round_sse2(_mm_loadu_si128((const __m128i*)&n[i+4]));
+							__m128i v = _mm_packs_epi32(lo, hi);
+							if (be) {
+								v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+							}
+							_mm_storeu_si128((__m128i*)&b[i*2], v);
+						}
+					#endif
+					for (; i < len; ++i) {
+						if (be) {
+							MU_WBEBF16(&b[i*2], n[i]);
+						} else {
+							MU_WLEBF16(&b[i*2], n[i]);
+						}
+					}
+				}
+
+				// @DOCLINE * `MU_RLEF16_ARRAY` - reads an array of f16 values from little-endian byte data as floats; overridable macro to `muu_rlef16_array`.
+				#ifndef MU_RLEF16_ARRAY
+					MUDEF inline void muu_rlef16_array(muByte* b, float* n, size_m len) {
+						muu_inner_rf16_array(b, n, len, MU_FALSE);
+					}
+					#define MU_RLEF16_ARRAY muu_rlef16_array
+				#endif
+
+				// @DOCLINE * `MU_WLEF16_ARRAY` - writes an array of floats to little-endian byte data as f16 values; overridable macro to `muu_wlef16_array`.
+				#ifndef MU_WLEF16_ARRAY
+					MUDEF inline void muu_wlef16_array(muByte* b, float* n, size_m len) {
+						muu_inner_wf16_array(b, n, len, MU_FALSE);
+					}
+					#define MU_WLEF16_ARRAY muu_wlef16_array
+				#endif
+
+				// @DOCLINE * `MU_RBEF16_ARRAY` - reads an array of f16 values from big-endian byte data as floats; overridable macro to `muu_rbef16_array`.
+				#ifndef MU_RBEF16_ARRAY
+					MUDEF inline void muu_rbef16_array(muByte* b, float* n, size_m len) {
+						muu_inner_rf16_array(b, n, len, MU_TRUE);
+					}
+					#define MU_RBEF16_ARRAY muu_rbef16_array
+				#endif
+
+				// @DOCLINE * `MU_WBEF16_ARRAY` - writes an array of floats to big-endian byte data as f16 values; overridable macro to `muu_wbef16_array`.
+				#ifndef MU_WBEF16_ARRAY
+					MUDEF inline void muu_wbef16_array(muByte* b, float* n, size_m len) {
+						muu_inner_wf16_array(b, n, len, MU_TRUE);
+					}
+					#define MU_WBEF16_ARRAY muu_wbef16_array
+				#endif
+
+				// @DOCLINE * `MU_RLEBF16_ARRAY` - reads an array of bf16 values from little-endian byte data as floats; overridable macro to `muu_rlebf16_array`.
+				#ifndef MU_RLEBF16_ARRAY
+					MUDEF inline void muu_rlebf16_array(muByte* b, float* n, size_m len) {
+						muu_inner_rbf16_array(b, n, len, MU_FALSE);
+					}
+					#define MU_RLEBF16_ARRAY muu_rlebf16_array
+				#endif
+
+				// @DOCLINE * `MU_WLEBF16_ARRAY` - writes an array of floats to little-endian byte data as bf16 values; overridable macro to `muu_wlebf16_array`.
+				#ifndef MU_WLEBF16_ARRAY
+					MUDEF inline void muu_wlebf16_array(muByte* b, float* n, size_m len) {
+						muu_inner_wbf16_array(b, n, len, MU_FALSE);
+					}
+					#define MU_WLEBF16_ARRAY muu_wlebf16_array
+				#endif
+
+				// @DOCLINE * `MU_RBEBF16_ARRAY` - reads an array of bf16 values from big-endian byte data as floats; overridable macro to `muu_rbebf16_array`.
+				#ifndef MU_RBEBF16_ARRAY
+					MUDEF inline void muu_rbebf16_array(muByte* b, float* n, size_m len) {
+						muu_inner_rbf16_array(b, n, len, MU_TRUE);
+					}
+					#define MU_RBEBF16_ARRAY muu_rbebf16_array
+				#endif
+
+				// @DOCLINE * `MU_WBEBF16_ARRAY` - writes an array of floats to big-endian byte data as bf16 values; overridable macro to `muu_wbebf16_array`.
+				#ifndef MU_WBEBF16_ARRAY
+					MUDEF inline void muu_wbebf16_array(muByte* b, float* n, size_m len) {
+						muu_inner_wbf16_array(b, n, len, MU_TRUE);
+					}
+					#define MU_WBEBF16_ARRAY muu_wbebf16_array
+				#endif
+
+	// @DOCLINE # Checksums
+
+		// @DOCLINE muUtility provides the CRC-32 (as used by zlib, gzip, and PNG) and Adler-32 (as used by zlib) checksums over byte data. Both are incremental, meaning that a checksum can be computed over data arriving in pieces by passing the value returned for the previous piece as the starting value for the next one.
+
+		// @DOCLINE ## CRC-32
+
+			// @DOCLINE The macro `MU_CRC32_INIT` is the starting value of a CRC-32 checksum, being 0.
+
+			#define MU_CRC32_INIT 0
+
+			// Slicing-by-8 tables for the reflected CRC-32 polynomial 0xEDB88320; table k maps a
+			// byte to its CRC after being followed by k zero bytes
+			static const uint32_m muu_inner_crc32_table[8][256] = {
+				{
+					0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+					0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+					0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+					0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+					0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+					0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+					0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+					0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+					0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+					0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+					0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+					0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+					0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+					0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+					0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+					0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+					0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+					0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+					0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+					0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+					0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+					0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+					0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+					0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+					0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+					0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+					0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+					0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+					0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+					0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+					0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+					0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+				},
+				{
+					0x00000000, 0x191B3141, 0x32366282, 0x2B2D53C3, 0x646CC504, 0x7D77F445, 0x565AA786, 0x4F4196C7,
+					0xC8D98A08, 0xD1C2BB49, 0xFAEFE88A, 0xE3F4D9CB, 0xACB54F0C, 0xB5AE7E4D, 0x9E832D8E, 0x87981CCF,
+					0x4AC21251, 0x53D92310, 0x78F470D3, 0x61EF4192, 0x2EAED755, 0x37B5E614, 0x1C98B5D7, 0x05838496,
+					0x821B9859, 0x9B00A918, 0xB02DFADB, 0xA936CB9A, 0xE6775D5D, 0xFF6C6C1C, 0xD4413FDF, 0xCD5A0E9E,
+					0x958424A2, 0x8C9F15E3, 0xA7B24620, 0xBEA97761, 0xF1E8E1A6, 0xE8F3D0E7, 0xC3DE8324, 0xDAC5B265,
+					0x5D5DAEAA, 0x44469FEB, 0x6F6BCC28, 0x7670FD69, 0x39316BAE, 0x202A5AEF, 0x0B07092C, 0x121C386D,
+					0xDF4636F3, 0xC65D07B2, 0xED705471, 0xF46B6530, 0xBB2AF3F7, 0xA231C2B6, 0x891C9175, 0x9007A034,
+					0x179FBCFB, 0x0E848DBA, 0x25A9DE79, 0x3CB2EF38, 0x73F379FF, 0x6AE848BE, 0x41C51B7D, 0x58DE2A3C,
+					0xF0794F05, 0xE9627E44, 0xC24F2D87, 0xDB541CC6, 0x94158A01, 0x8D0EBB40, 0xA623E883, 0xBF38D9C2,
+					0x38A0C50D, 0x21BBF44C, 0x0A96A78F, 0x138D96CE, 0x5CCC0009, 0x45D73148, 0x6EFA628B, 0x77E153CA,
+					0xBABB5D54, 0xA3A06C15, 0x888D3FD6, 0x91960E97, 0xDED79850, 0xC7CCA911, 0xECE1FAD2, 0xF5FACB93,
+					0x7262D75C, 0x6B79E61D, 0x4054B5DE, 0x594F849F, 0x160E1258, 0x0F152319, 0x243870DA, 0x3D23419B,
+					0x65FD6BA7, 0x7CE65AE6, 0x57CB0925, 0x4ED03864, 0x0191AEA3, 0x188A9FE2, 0x33A7CC21, 0x2ABCFD60,
+					0xAD24E1AF, 0xB43FD0EE, 0x9F12832D, 0x8609B26C, 0xC94824AB, 0xD05315EA, 0xFB7E4629, 0xE2657768,
+					0x2F3F79F6, 0x362448B7, 0x1D091B74, 0x04122A35, 0x4B53BCF2, 0x52488DB3, 0x7965DE70, 0x607EEF31,
+					0xE7E6F3FE, 0xFEFDC2BF, 0xD5D0917C, 0xCCCBA03D, 0x838A36FA, 0x9A9107BB, 0xB1BC5478, 0xA8A76539,
+					0x3B83984B, 0x2298A90A, 0x09B5FAC9, 0x10AECB88, 0x5FEF5D4F, 0x46F46C0E, 0x6DD93FCD, 0x74C20E8C,
+					0xF35A1243, 0xEA412302, 0xC16C70C1, 0xD8774180, 0x9736D747, 0x8E2DE606, 0xA500B5C5, 0xBC1B8484,
+					0x71418A1A, 0x685ABB5B, 0x4377E898, 0x5A6CD9D9, 0x152D4F1E, 0x0C367E5F, 0x271B2D9C, 0x3E001CDD,
+					0xB9980012, 0xA0833153, 0x8BAE6290, 0x92B553D1, 0xDDF4C516, 0xC4EFF457, 0xEFC2A794, 0xF6D996D5,
+					0xAE07BCE9, 0xB71C8DA8, 0x9C31DE6B, 0x852AEF2A, 0xCA6B79ED, 0xD37048AC, 0xF85D1B6F, 0xE1462A2E,
+					0x66DE36E1, 0x7FC507A0, 0x54E85463, 0x4DF36522, 0x02B2F3E5, 0x1BA9C2A4, 0x30849167, 0x299FA026,
+					0xE4C5AEB8, 0xFDDE9FF9, 0xD6F3CC3A, 0xCFE8FD7B, 0x80A96BBC, 0x99B25AFD, 0xB29F093E, 0xAB84387F,
+					0x2C1C24B0, 0x350715F1, 0x1E2A4632, 0x07317773, 0x4870E1B4, 0x516BD0F5, 0x7A468336, 0x635DB277,
+					0xCBFAD74E, 0xD2E1E60F, 0xF9CCB5CC, 0xE0D7848D, 0xAF96124A, 0xB68D230B, 0x9DA070C8, 0x84BB4189,
+					0x03235D46, 0x1A386C07, 0x31153FC4, 0x280E0E85, 0x674F9842, 0x7E54A903, 0x5579FAC0, 0x4C62CB81,
+					0x8138C51F, 0x9823F45E, 0xB30EA79D, 0xAA1596DC, 0xE554001B, 0xFC4F315A, 0xD7626299, 0xCE7953D8,
+					0x49E14F17, 0x50FA7E56, 0x7BD72D95, 0x62CC1CD4, 0x2D8D8A13, 0x3496BB52, 0x1FBBE891, 0x06A0D9D0,
+					0x5E7EF3EC, 0x4765C2AD, 0x6C48916E, 0x7553A02F, 0x3A1236E8, 0x230907A9, 0x0824546A, 0x113F652B,
+					0x96A779E4, 0x8FBC48A5, 0xA4911B66, 0xBD8A2A27, 0xF2CBBCE0, 0xEBD08DA1, 0xC0FDDE62, 0xD9E6EF23,
+					0x14BCE1BD, 0x0DA7D0FC, 0x268A833F, 0x3F91B27E, 0x70D024B9, 0x69CB15F8, 0x42E6463B, 0x5BFD777A,
+					0xDC656BB5, 0xC57E5AF4, 0xEE530937, 0xF7483876, 0xB809AEB1, 0xA1129FF0, 0x8A3FCC33, 0x9324FD72
+				},
+				{
+					0x00000000, 0x01C26A37, 0x0384D46E, 0x0246BE59, 0x0709A8DC, 0x06CBC2EB, 0x048D7CB2, 0x054F1685,
+					0x0E1351B8, 0x0FD13B8F, 0x0D9785D6, 0x0C55EFE1, 0x091AF964, 0x08D89353, 0x0A9E2D0A, 0x0B5C473D,
+					0x1C26A370, 0x1DE4C947, 0x1FA2771E, 0x1E601D29, 0x1B2F0BAC, 0x1AED619B, 0x18ABDFC2, 0x1969B5F5,
+					0x1235F2C8, 0x13F798FF, 0x11B126A6, 0x10734C91, 0x153C5A14, 0x14FE3023, 0x16B88E7A, 0x177AE44D,
+					0x384D46E0, 0x398F2CD7, 0x3BC9928E, 0x3A0BF8B9, 0x3F44EE3C, 0x3E86840B, 0x3CC03A52, 0x3D025065,
+					0x365E1758, 0x379C7D6F, 0x35DAC336, 0x3418A901, 0x3157BF84, 0x3095D5B3, 0x32D36BEA, 0x331101DD,
+					0x246BE590, 0x25A98FA7, 0x27EF31FE, 0x262D5BC9, 0x23624D4C, 0x22A0277B, 0x20E69922, 0x2124F315,
+					0x2A78B428, 0x2BBADE1F, 0x29FC6046, 0x283E0A71, 0x2D711CF4, 0x2CB376C3, 0x2EF5C89A, 0x2F37A2AD,
+					0x709A8DC0, 0x7158E7F7, 0x731E59AE, 0x72DC3399, 0x7793251C, 0x76514F2B, 0x7417F172, 0x75D59B45,
+					0x7E89DC78, 0x7F4BB64F, 0x7D0D0816, 0x7CCF6221, 0x798074A4, 0x78421E93, 0x7A04A0CA, 0x7BC6CAFD,
+					0x6CBC2EB0, 0x6D7E4487, 0x6F38FADE, 0x6EFA90E9, 0x6BB5866C, 0x6A77EC5B, 0x68315202, 0x69F33835,
+					0x62AF7F08, 0x636D153F, 0x612BAB66, 0x60E9C151, 0x65A6D7D4, 0x6464BDE3, 0x662203BA, 0x67E0698D,
+					0x48D7CB20, 0x4915A117, 0x4B531F4E, 0x4A917579, 0x4FDE63FC, 0x4E1C09CB, 0x4C5AB792, 0x4D98DDA5,
+					0x46C49A98, 0x4706F0AF, 0x45404EF6, 0x448224C1, 0x41CD3244, 0x400F5873, 0x4249E62A, 0x438B8C1D,
+					0x54F16850, 0x55330267, 0x5775BC3E, 0x56B7D609, 0x53F8C08C, 0x523AAABB, 0x507C14E2, 0x51BE7ED5,
+					0x5AE239E8, 0x5B2053DF, 0x5966ED86, 0x58A487B1, 0x5DEB9134, 0x5C29FB03, 0x5E6F455A, 0x5FAD2F6D,
+					0xE1351B80, 0xE0F771B7, 0xE2B1CFEE, 0xE373A5D9, 0xE63CB35C, 0xE7FED96B, 0xE5B86732, 0xE47A0D05,
+					0xEF264A38, 0xEEE4200F, 0xECA29E56, 0xED60F461, 0xE82FE2E4, 0xE9ED88D3, 0xEBAB368A, 0xEA695CBD,
+					0xFD13B8F0, 0xFCD1D2C7, 0xFE976C9E, 0xFF5506A9, 0xFA1A102C, 0xFBD87A1B, 0xF99EC442, 0xF85CAE75,
+					0xF300E948, 0xF2C2837F, 0xF0843D26, 0xF1465711, 0xF4094194, 0xF5CB2BA3, 0xF78D95FA, 0xF64FFFCD,
+					0xD9785D60, 0xD8BA3757, 0xDAFC890E, 0xDB3EE339, 0xDE71F5BC, 0xDFB39F8B, 0xDDF521D2, 0xDC374BE5,
+					0xD76B0CD8, 0xD6A966EF, 0xD4EFD8B6, 0xD52DB281, 0xD062A404, 0xD1A0CE33, 0xD3E6706A, 0xD2241A5D,
+					0xC55EFE10, 0xC49C9427, 0xC6DA2A7E, 0xC7184049, 0xC25756CC, 0xC3953CFB, 0xC1D382A2, 0xC011E895,
+					0xCB4DAFA8, 0xCA8FC59F, 0xC8C97BC6, 0xC90B11F1, 0xCC440774, 0xCD866D43, 0xCFC0D31A, 0xCE02B92D,
+					0x91AF9640, 0x906DFC77, 0x922B422E, 0x93E92819, 0x96A63E9C, 0x976454AB, 0x9522EAF2, 0x94E080C5,
+					0x9FBCC7F8, 0x9E7EADCF, 0x9C381396, 0x9DFA79A1, 0x98B56F24, 0x99770513, 0x9B31BB4A, 0x9AF3D17D,
+					0x8D893530, 0x8C4B5F07, 0x8E0DE15E, 0x8FCF8B69, 0x8A809DEC, 0x8B42F7DB, 0x89044982, 0x88C623B5,
+					0x839A6488, 0x82580EBF, 0x801EB0E6, 0x81DCDAD1, 0x8493CC54, 0x8551A663, 0x8717183A, 0x86D5720D,
+					0xA9E2D0A0, 0xA820BA97, 0xAA6604CE, 0xABA46EF9, 0xAEEB787C, 0xAF29124B, 0xAD6FAC12, 0xACADC625,
+					0xA7F18118, 0xA633EB2F, 0xA4755576, 0xA5B73F41, 0xA0F829C4, 0xA13A43F3, 0xA37CFDAA, 0xA2BE979D,
+					0xB5C473D0, 0xB40619E7, 0xB640A7BE, 0xB782CD89, 0xB2CDDB0C, 0xB30FB13B, 0xB1490F62, 0xB08B6555,
+					0xBBD72268, 0xBA15485F, 0xB853F606, 0xB9919C31, 0xBCDE8AB4, 0xBD1CE083, 0xBF5A5EDA, 0xBE9834ED
+				},
+				{
+					0x00000000, 0xB8BC6765, 0xAA09C88B, 0x12B5AFEE, 0x8F629757, 0x37DEF032, 0x256B5FDC, 0x9DD738B9,
+					0xC5B428EF, 0x7D084F8A, 0x6FBDE064, 0xD7018701, 0x4AD6BFB8, 0xF26AD8DD, 0xE0DF7733, 0x58631056,
+					0x5019579F, 0xE8A530FA, 0xFA109F14, 0x42ACF871, 0xDF7BC0C8, 0x67C7A7AD, 0x75720843, 0xCDCE6F26,
+					0x95AD7F70, 0x2D111815, 0x3FA4B7FB, 0x8718D09E, 0x1ACFE827, 0xA2738F42, 0xB0C620AC, 0x087A47C9,
+					0xA032AF3E, 0x188EC85B, 0x0A3B67B5, 0xB28700D0, 0x2F503869, 0x97EC5F0C, 0x8559F0E2, 0x3DE59787,
+					0x658687D1, 0xDD3AE0B4, 0xCF8F4F5A, 0x7733283F, 0xEAE41086, 0x525877E3, 0x40EDD80D, 0xF851BF68,
+					0xF02BF8A1, 0x48979FC4, 0x5A22302A, 0xE29E574F, 0x7F496FF6, 0xC7F50893, 0xD540A77D, 0x6DFCC018,
+					0x359FD04E, 0x8D23B72B, 0x9F9618C5, 0x272A7FA0, 0xBAFD4719, 0x0241207C, 0x10F48F92, 0xA848E8F7,
+					0x9B14583D, 0x23A83F58, 0x311D90B6, 0x89A1F7D3, 0x1476CF6A, 0xACCAA80F, 0xBE7F07E1, 0x06C36084,
+					0x5EA070D2, 0xE61C17B7, 0xF4A9B859, 0x4C15DF3C, 0xD1C2E785, 0x697E80E0, 0x7BCB2F0E, 0xC377486B,
+					0xCB0D0FA2, 0x73B168C7, 0x6104C729, 0xD9B8A04C, 0x446F98F5, 0xFCD3FF90, 0xEE66507E, 0x56DA371B,
+					0x0EB9274D, 0xB6054028, 0xA4B0EFC6, 0x1C0C88A3, 0x81DBB01A, 0x3967D77F, 0x2BD27891, 0x936E1FF4,
+					0x3B26F703, 0x839A9066, 0x912F3F88, 0x299358ED, 0xB4446054, 0x0CF80731, 0x1E4DA8DF, 0xA6F1CFBA,
+					0xFE92DFEC, 0x462EB889, 0x549B1767, 0xEC277002, 0x71F048BB, 0xC94C2FDE, 0xDBF98030, 0x6345E755,
+					0x6B3FA09C, 0xD383C7F9, 0xC1366817, 0x798A0F72, 0xE45D37CB, 0x5CE150AE, 0x4E54FF40, 0xF6E89825,
+					0xAE8B8873, 0x1637EF16, 0x048240F8, 0xBC3E279D, 0x21E91F24, 0x99557841, 0x8BE0D7AF, 0x335CB0CA,
+					0xED59B63B, 0x55E5D15E, 0x47507EB0, 0xFFEC19D5, 0x623B216C, 0xDA874609, 0xC832E9E7, 0x708E8E82,
+					0x28ED9ED4, 0x9051F9B1, 0x82E4565F, 0x3A58313A, 0xA78F0983, 0x1F336EE6, 0x0D86C108, 0xB53AA66D,
+					0xBD40E1A4, 0x05FC86C1, 0x1749292F, 0xAFF54E4A, 0x322276F3, 0x8A9E1196, 0x982BBE78, 0x2097D91D,
+					0x78F4C94B, 0xC048AE2E, 0xD2FD01C0, 0x6A4166A5, 0xF7965E1C, 0x4F2A3979, 0x5D9F9697, 0xE523F1F2,
+					0x4D6B1905, 0xF5D77E60, 0xE762D18E, 0x5FDEB6EB, 0xC2098E52, 0x7AB5E937, 0x680046D9, 0xD0BC21BC,
+					0x88DF31EA, 0x3063568F, 0x22D6F961, 0x9A6A9E04, 0x07BDA6BD, 0xBF01C1D8, 0xADB46E36, 0x15080953,
+					0x1D724E9A, 0xA5CE29FF, 0xB77B8611, 0x0FC7E174, 0x9210D9CD, 0x2AACBEA8, 0x38191146, 0x80A57623,
+					0xD8C66675, 0x607A0110, 0x72CFAEFE, 0xCA73C99B, 0x57A4F122, 0xEF189647, 0xFDAD39A9, 0x45115ECC,
+					0x764DEE06, 0xCEF18963, 0xDC44268D, 0x64F841E8, 0xF92F7951, 0x41931E34, 0x5326B1DA, 0xEB9AD6BF,
+					0xB3F9C6E9, 0x0B45A18C, 0x19F00E62, 0xA14C6907, 0x3C9B51BE, 0x842736DB, 0x96929935, 0x2E2EFE50,
+					0x2654B999, 0x9EE8DEFC, 0x8C5D7112, 0x34E11677, 0xA9362ECE, 0x118A49AB, 0x033FE645, 0xBB838120,
+					0xE3E09176, 0x5B5CF613, 0x49E959FD, 0xF1553E98, 0x6C820621, 0xD43E6144, 0xC68BCEAA, 0x7E37A9CF,
+					0xD67F4138, 0x6EC3265D, 0x7C7689B3, 0xC4CAEED6, 0x591DD66F, 0xE1A1B10A, 0xF3141EE4, 0x4BA87981,
+					0x13CB69D7, 0xAB770EB2, 0xB9C2A15C, 0x017EC639, 0x9CA9FE80, 0x241599E5, 0x36A0360B, 0x8E1C516E,
+					0x866616A7, 0x3EDA71C2, 0x2C6FDE2C, 0x94D3B949, 0x090481F0, 0xB1B8E695, 0xA30D497B, 0x1BB12E1E,
+					0x43D23E48, 0xFB6E592D, 0xE9DBF6C3, 0x516791A6, 0xCCB0A91F, 0x740CCE7A, 0x66B96194, 0xDE0506F1
+				},
+				{
+					0x00000000, 0x3D6029B0, 0x7AC05360, 0x47A07AD0, 0xF580A6C0, 0xC8E08F70, 0x8F40F5A0, 0xB220DC10,
+					0x30704BC1, 0x0D106271, 0x4AB018A1, 0x77D03111, 0xC5F0ED01, 0xF890C4B1, 0xBF30BE61, 0x825097D1,
+					0x60E09782, 0x5D80BE32, 0x1A20C4E2, 0x2740ED52, 0x95603142, 0xA80018F2, 0xEFA06222, 0xD2C04B92,
+					0x5090DC43, 0x6DF0F5F3, 0x2A508F23, 0x1730A693, 0xA5107A83, 0x98705333, 0xDFD029E3, 0xE2B00053,
+					0xC1C12F04, 0xFCA106B4, 0xBB017C64, 0x866155D4, 0x344189C4, 0x0921A074, 0x4E81DAA4, 0x73E1F314,
+					0xF1B164C5, 0xCCD14D75, 0x8B7137A5, 0xB6111E15, 0x0431C205, 0x3951EBB5, 0x7EF19165, 0x4391B8D5,
+					0xA121B886, 0x9C419136, 0xDBE1EBE6, 0xE681C256, 0x54A11E46, 0x69C137F6, 0x2E614D26, 0x13016496,
+					0x9151F347, 0xAC31DAF7, 0xEB91A027, 0xD6F18997, 0x64D15587, 0x59B17C37, 0x1E1106E7, 0x23712F57,
+					0x58F35849, 0x659371F9, 0x22330B29, 0x1F532299, 0xAD73FE89, 0x9013D739, 0xD7B3ADE9, 0xEAD38459,
+					0x68831388, 0x55E33A38, 0x124340E8, 0x2F236958, 0x9D03B548, 0xA0639CF8, 0xE7C3E628, 0xDAA3CF98,
+					0x3813CFCB, 0x0573E67B, 0x42D39CAB, 0x7FB3B51B, 0xCD93690B, 0xF0F340BB, 0xB7533A6B, 0x8A3313DB,
+					0x0863840A, 0x3503ADBA, 0x72A3D76A, 0x4FC3FEDA, 0xFDE322CA, 0xC0830B7A, 0x872371AA, 0xBA43581A,
+					0x9932774D, 0xA4525EFD, 0xE3F2242D, 0xDE920D9D, 0x6CB2D18D, 0x51D2F83D, 0x167282ED, 0x2B12AB5D,
+					0xA9423C8C, 0x9422153C, 0xD3826FEC, 0xEEE2465C, 0x5CC29A4C, 0x61A2B3FC, 0x2602C92C, 0x1B62E09C,
+					0xF9D2E0CF, 0xC4B2C97F, 0x8312B3AF, 0xBE729A1F, 0x0C52460F, 0x31326FBF, 0x7692156F, 0x4BF23CDF,
+					0xC9A2AB0E, 0xF4C282BE, 0xB362F86E, 0x8E02D1DE, 0x3C220DCE, 0x0142247E, 0x46E25EAE, 0x7B82771E,
+					0xB1E6B092, 0x8C869922, 0xCB26E3F2, 0xF646CA42, 0x44661652, 0x79063FE2, 0x3EA64532, 0x03C66C82,
+					0x8196FB53, 0xBCF6D2E3, 0xFB56A833, 0xC6368183, 0x74165D93, 0x49767423, 0x0ED60EF3, 0x33B62743,
+					0xD1062710, 0xEC660EA0, 0xABC67470, 0x96A65DC0, 0x248681D0, 0x19E6A860, 0x5E46D2B0, 0x6326FB00,
+					0xE1766CD1, 0xDC164561, 0x9BB63FB1, 0xA6D61601, 0x14F6CA11, 0x2996E3A1, 0x6E369971, 0x5356B0C1,
+					0x70279F96, 0x4D47B626, 0x0AE7CCF6, 0x3787E546, 0x85A73956, 0xB8C710E6, 0xFF676A36, 0xC2074386,
+					0x4057D457, 0x7D37FDE7, 0x3A978737, 0x07F7AE87, 0xB5D77297, 0x88B75B27, 0xCF1721F7, 0xF2770847,
+					0x10C70814, 0x2DA721A4, 0x6A075B74, 0x576772C4, 0xE547AED4, 0xD8278764, 0x9F87FDB4, 0xA2E7D404,
+					0x20B743D5, 0x1DD76A65, 0x5A7710B5, 0x67173905, 0xD537E515, 0xE857CCA5, 0xAFF7B675, 0x92979FC5,
+					0xE915E8DB, 0xD475C16B, 0x93D5BBBB, 0xAEB5920B, 0x1C954E1B, 0x21F567AB, 0x66551D7B, 0x5B3534CB,
+					0xD965A31A, 0xE4058AAA, 0xA3A5F07A, 0x9EC5D9CA, 0x2CE505DA, 0x11852C6A, 0x562556BA, 0x6B457F0A,
+					0x89F57F59, 0xB49556E9, 0xF3352C39, 0xCE550589, 0x7C75D999, 0x4115F029, 0x06B58AF9, 0x3BD5A349,
+					0xB9853498, 0x84E51D28, 0xC34567F8, 0xFE254E48, 0x4C059258, 0x7165BBE8, 0x36C5C138, 0x0BA5E888,
+					0x28D4C7DF, 0x15B4EE6F, 0x521494BF, 0x6F74BD0F, 0xDD54611F, 0xE03448AF, 0xA794327F, 0x9AF41BCF,
+					0x18A48C1E, 0x25C4A5AE, 0x6264DF7E, 0x5F04F6CE, 0xED242ADE, 0xD044036E, 0x97E479BE, 0xAA84500E,
+					0x4834505D, 0x755479ED, 0x32F4033D, 0x0F942A8D, 0xBDB4F69D, 0x80D4DF2D, 0xC774A5FD, 0xFA148C4D,
+					0x78441B9C, 0x4524322C, 0x028448FC, 0x3FE4614C, 0x8DC4BD5C, 0xB0A494EC, 0xF704EE3C, 0xCA64C78C
+				},
+				{
+					0x00000000, 0xCB5CD3A5, 0x4DC8A10B, 0x869472AE, 0x9B914216, 0x50CD91B3, 0xD659E31D, 0x1D0530B8,
+					0xEC53826D, 0x270F51C8, 0xA19B2366, 0x6AC7F0C3, 0x77C2C07B, 0xBC9E13DE, 0x3A0A6170, 0xF156B2D5,
+					0x03D6029B, 0xC88AD13E, 0x4E1EA390, 0x85427035, 0x9847408D, 0x531B9328, 0xD58FE186, 0x1ED33223,
+					0xEF8580F6, 0x24D95353, 0xA24D21FD, 0x6911F258, 0x7414C2E0, 0xBF481145, 0x39DC63EB, 0xF280B04E,
+					0x07AC0536, 0xCCF0D693, 0x4A64A43D, 0x81387798, 0x9C3D4720, 0x57619485, 0xD1F5E62B, 0x1AA9358E,
+					0xEBFF875B, 0x20A354FE, 0xA6372650, 0x6D6BF5F5, 0x706EC54D, 0xBB3216E8, 0x3DA66446, 0xF6FAB7E3,
+					0x047A07AD, 0xCF26D408, 0x49B2A6A6, 0x82EE7503, 0x9FEB45BB, 0x54B7961E, 0xD223E4B0, 0x197F3715,
+					0xE82985C0, 0x23755665, 0xA5E124CB, 0x6EBDF76E, 0x73B8C7D6, 0xB8E41473, 0x3E7066DD, 0xF52CB578,
+					0x0F580A6C, 0xC404D9C9, 0x4290AB67, 0x89CC78C2, 0x94C9487A, 0x5F959BDF, 0xD901E971, 0x125D3AD4,
+					0xE30B8801, 0x28575BA4, 0xAEC3290A, 0x659FFAAF, 0x789ACA17, 0xB3C619B2, 0x35526B1C, 0xFE0EB8B9,
+					0x0C8E08F7, 0xC7D2DB52, 0x4146A9FC, 0x8A1A7A59, 0x971F4AE1, 0x5C439944, 0xDAD7EBEA, 0x118B384F,
+					0xE0DD8A9A, 0x2B81593F, 0xAD152B91, 0x6649F834, 0x7B4CC88C, 0xB0101B29, 0x36846987, 0xFDD8BA22,
+					0x08F40F5A, 0xC3A8DCFF, 0x453CAE51, 0x8E607DF4, 0x93654D4C, 0x58399EE9, 0xDEADEC47, 0x15F13FE2,
+					0xE4A78D37, 0x2FFB5E92, 0xA96F2C3C, 0x6233FF99, 0x7F36CF21, 0xB46A1C84, 0x32FE6E2A, 0xF9A2BD8F,
+					0x0B220DC1, 0xC07EDE64, 0x46EAACCA, 0x8DB67F6F, 0x90B34FD7, 0x5BEF9C72, 0xDD7BEEDC, 0x16273D79,
+					0xE7718FAC, 0x2C2D5C09, 0xAAB92EA7, 0x61E5FD02, 0x7CE0CDBA, 0xB7BC1E1F, 0x31286CB1, 0xFA74BF14,
+					0x1EB014D8, 0xD5ECC77D, 0x5378B5D3, 0x98246676, 0x852156CE, 0x4E7D856B, 0xC8E9F7C5, 0x03B52460,
+					0xF2E396B5, 0x39BF4510, 0xBF2B37BE, 0x7477E41B, 0x6972D4A3, 0xA22E0706, 0x24BA75A8, 0xEFE6A60D,
+					0x1D661643, 0xD63AC5E6, 0x50AEB748, 0x9BF264ED, 0x86F75455, 0x4DAB87F0, 0xCB3FF55E, 0x006326FB,
+					0xF135942E, 0x3A69478B, 0xBCFD3525, 0x77A1E680, 0x6AA4D638, 0xA1F8059D, 0x276C7733, 0xEC30A496,
+					0x191C11EE, 0xD240C24B, 0x54D4B0E5, 0x9F886340, 0x828D53F8, 0x49D1805D, 0xCF45F2F3, 0x04192156,
+					0xF54F9383, 0x3E134026, 0xB8873288, 0x73DBE12D, 0x6EDED195, 0xA5820230, 0x2316709E, 0xE84AA33B,
+					0x1ACA1375, 0xD196C0D0, 0x5702B27E, 0x9C5E61DB, 0x815B5163, 0x4A0782C6, 0xCC93F068, 0x07CF23CD,
+					0xF6999118, 0x3DC542BD, 0xBB513013, 0x700DE3B6, 0x6D08D30E, 0xA65400AB, 0x20C07205, 0xEB9CA1A0,
+					0x11E81EB4, 0xDAB4CD11, 0x5C20BFBF, 0x977C6C1A, 0x8A795CA2, 0x41258F07, 0xC7B1FDA9, 0x0CED2E0C,
+					0xFDBB9CD9, 0x36E74F7C, 0xB0733DD2, 0x7B2FEE77, 0x662ADECF, 0xAD760D6A, 0x2BE27FC4, 0xE0BEAC61,
+					0x123E1C2F, 0xD962CF8A, 0x5FF6BD24, 0x94AA6E81, 0x89AF5E39, 0x42F38D9C, 0xC467FF32, 0x0F3B2C97,
+					0xFE6D9E42, 0x35314DE7, 0xB3A53F49, 0x78F9ECEC, 0x65FCDC54, 0xAEA00FF1, 0x28347D5F, 0xE368AEFA,
+					0x16441B82, 0xDD18C827, 0x5B8CBA89, 0x90D0692C, 0x8DD55994, 0x46898A31, 0xC01DF89F, 0x0B412B3A,
+					0xFA1799EF, 0x314B4A4A, 0xB7DF38E4, 0x7C83EB41, 0x6186DBF9, 0xAADA085C, 0x2C4E7AF2, 0xE712A957,
+					0x15921919, 0xDECECABC, 0x585AB812, 0x93066BB7, 0x8E035B0F, 0x455F88AA, 0xC3CBFA04, 0x089729A1,
+					0xF9C19B74, 0x329D48D1, 0xB4093A7F, 0x7F55E9DA, 0x6250D962, 0xA90C0AC7, 0x2F987869, 0xE4C4ABCC
+				},
+				{
+					0x00000000, 0xA6770BB4, 0x979F1129, 0x31E81A9D, 0xF44F2413, 0x52382FA7, 0x63D0353A, 0xC5A73E8E,
+					0x33EF4E67, 0x959845D3, 0xA4705F4E, 0x020754FA, 0xC7A06A74, 0x61D761C0, 0x503F7B5D, 0xF64870E9,
+					0x67DE9CCE, 0xC1A9977A, 0xF0418DE7, 0x56368653, 0x9391B8DD, 0x35E6B369, 0x040EA9F4, 0xA279A240,
+					0x5431D2A9, 0xF246D91D, 0xC3AEC380, 0x65D9C834, 0xA07EF6BA, 0x0609FD0E, 0x37E1E793, 0x9196EC27,
+					0xCFBD399C, 0x69CA3228, 0x582228B5, 0xFE552301, 0x3BF21D8F, 0x9D85163B, 0xAC6D0CA6, 0x0A1A0712,
+					0xFC5277FB, 0x5A257C4F, 0x6BCD66D2, 0xCDBA6D66, 0x081D53E8, 0xAE6A585C, 0x9F8242C1, 0x39F54975,
+					0xA863A552, 0x0E14AEE6, 0x3FFCB47B, 0x998BBFCF, 0x5C2C8141, 0xFA5B8AF5, 0xCBB39068, 0x6DC49BDC,
+					0x9B8CEB35, 0x3DFBE081, 0x0C13FA1C, 0xAA64F1A8, 0x6FC3CF26, 0xC9B4C492, 0xF85CDE0F, 0x5E2BD5BB,
+					0x440B7579, 0xE27C7ECD, 0xD3946450, 0x75E36FE4, 0xB044516A, 0x16335ADE, 0x27DB4043, 0x81AC4BF7,
+					0x77E43B1E, 0xD19330AA, 0xE07B2A37, 0x460C2183, 0x83AB1F0D, 0x25DC14B9, 0x14340E24, 0xB2430590,
+					0x23D5E9B7, 0x85A2E203, 0xB44AF89E, 0x123DF32A, 0xD79ACDA4, 0x71EDC610, 0x4005DC8D, 0xE672D739,
+					0x103AA7D0, 0xB64DAC64, 0x87A5B6F9, 0x21D2BD4D, 0xE47583C3, 0x42028877, 0x73EA92EA, 0xD59D995E,
+					0x8BB64CE5, 0x2DC14751, 0x1C295DCC, 0xBA5E5678, 0x7FF968F6, 0xD98E6342, 0xE86679DF, 0x4E11726B,
+					0xB8590282, 0x1E2E0936, 0x2FC613AB, 0x89B1181F, 0x4C162691, 0xEA612D25, 0xDB8937B8, 0x7DFE3C0C,
+					0xEC68D02B, 0x4A1FDB9F, 0x7BF7C102, 0xDD80CAB6, 0x1827F438, 0xBE50FF8C, 0x8FB8E511, 0x29CFEEA5,
+					0xDF879E4C, 0x79F095F8, 0x48188F65, 0xEE6F84D1, 0x2BC8BA5F, 0x8DBFB1EB, 0xBC57AB76, 0x1A20A0C2,
+					0x8816EAF2, 0x2E61E146, 0x1F89FBDB, 0xB9FEF06F, 0x7C59CEE1, 0xDA2EC555, 0xEBC6DFC8, 0x4DB1D47C,
+					0xBBF9A495, 0x1D8EAF21, 0x2C66B5BC, 0x8A11BE08, 0x4FB68086, 0xE9C18B32, 0xD82991AF, 0x7E5E9A1B,
+					0xEFC8763C, 0x49BF7D88, 0x78576715, 0xDE206CA1, 0x1B87522F, 0xBDF0599B, 0x8C184306, 0x2A6F48B2,
+					0xDC27385B, 0x7A5033EF, 0x4BB82972, 0xEDCF22C6, 0x28681C48, 0x8E1F17FC, 0xBFF70D61, 0x198006D5,
+					0x47ABD36E, 0xE1DCD8DA, 0xD034C247, 0x7643C9F3, 0xB3E4F77D, 0x1593FCC9, 0x247BE654, 0x820CEDE0,
+					0x74449D09, 0xD23396BD, 0xE3DB8C20, 0x45AC8794, 0x800BB91A, 0x267CB2AE, 0x1794A833, 0xB1E3A387,
+					0x20754FA0, 0x86024414, 0xB7EA5E89, 0x119D553D, 0xD43A6BB3, 0x724D6007, 0x43A57A9A, 0xE5D2712E,
+					0x139A01C7, 0xB5ED0A73, 0x840510EE, 0x22721B5A, 0xE7D525D4, 0x41A22E60, 0x704A34FD, 0xD63D3F49,
+					0xCC1D9F8B, 0x6A6A943F, 0x5B828EA2, 0xFDF58516, 0x3852BB98, 0x9E25B02C, 0xAFCDAAB1, 0x09BAA105,
+					0xFFF2D1EC, 0x5985DA58, 0x686DC0C5, 0xCE1ACB71, 0x0BBDF5FF, 0xADCAFE4B, 0x9C22E4D6, 0x3A55EF62,
+					0xABC30345, 0x0DB408F1, 0x3C5C126C, 0x9A2B19D8, 0x5F8C2756, 0xF9FB2CE2, 0xC813367F, 0x6E643DCB,
+					0x982C4D22, 0x3E5B4696, 0x0FB35C0B, 0xA9C457BF, 0x6C636931, 0xCA146285, 0xFBFC7818, 0x5D8B73AC,
+					0x03A0A617, 0xA5D7ADA3, 0x943FB73E, 0x3248BC8A, 0xF7EF8204, 0x519889B0, 0x6070932D, 0xC6079899,
+					0x304FE870, 0x9638E3C4, 0xA7D0F959, 0x01A7F2ED, 0xC400CC63, 0x6277C7D7, 0x539FDD4A, 0xF5E8D6FE,
+					0x647E3AD9, 0xC209316D, 0xF3E12BF0, 0x55962044, 0x90311ECA, 0x3646157E, 0x07AE0FE3, 0xA1D90457,
+					0x579174BE, 0xF1E67F0A, 0xC00E6597, 0x66796E23, 0xA3DE50AD, 0x05A95B19, 0x34414184, 0x92364A30
+				},
+				{
+					0x00000000, 0xCCAA009E, 0x4225077D, 0x8E8F07E3, 0x844A0EFA, 0x48E00E64, 0xC66F0987, 0x0AC50919,
+					0xD3E51BB5, 0x1F4F1B2B, 0x91C01CC8, 0x5D6A1C56, 0x57AF154F, 0x9B0515D1, 0x158A1232, 0xD92012AC,
+					0x7CBB312B, 0xB01131B5, 0x3E9E3656, 0xF23436C8, 0xF8F13FD1, 0x345B3F4F, 0xBAD438AC, 0x767E3832,
+					0xAF5E2A9E, 0x63F42A00, 0xED7B2DE3, 0x21D12D7D, 0x2B142464, 0xE7BE24FA, 0x69312319, 0xA59B2387,
+					0xF9766256, 0x35DC62C8, 0xBB53652B, 0x77F965B5, 0x7D3C6CAC, 0xB1966C32, 0x3F196BD1, 0xF3B36B4F,
+					0x2A9379E3, 0xE639797D, 0x68B67E9E, 0xA41C7E00, 0xAED97719, 0x62737787, 0xECFC7064, 0x205670FA,
+					0x85CD537D, 0x496753E3, 0xC7E85400, 0x0B42549E, 0x01875D87, 0xCD2D5D19, 0x43A25AFA, 0x8F085A64,
+					0x562848C8, 0x9A824856, 0x140D4FB5, 0xD8A74F2B, 0xD2624632, 0x1EC846AC, 0x9047414F, 0x5CED41D1,
+					0x299DC2ED, 0xE537C273, 0x6BB8C590, 0xA712C50E, 0xADD7CC17, 0x617DCC89, 0xEFF2CB6A, 0x2358CBF4,
+					0xFA78D958, 0x36D2D9C6, 0xB85DDE25, 0x74F7DEBB, 0x7E32D7A2, 0xB298D73C, 0x3C17D0DF, 0xF0BDD041,
+					0x5526F3C6, 0x998CF358, 0x1703F4BB, 0xDBA9F425, 0xD16CFD3C, 0x1DC6FDA2, 0x9349FA41, 0x5FE3FADF,
+					0x86C3E873, 0x4A69E8ED, 0xC4E6EF0E, 0x084CEF90, 0x0289E689, 0xCE23E617, 0x40ACE1F4, 0x8C06E16A,
+					0xD0EBA0BB, 0x1C41A025, 0x92CEA7C6, 0x5E64A758, 0x54A1AE41, 0x980BAEDF, 0x1684A93C, 0xDA2EA9A2,
+					0x030EBB0E, 0xCFA4BB90, 0x412BBC73, 0x8D81BCED, 0x8744B5F4, 0x4BEEB56A, 0xC561B289, 0x09CBB217,
+					0xAC509190, 0x60FA910E, 0xEE7596ED, 0x22DF9673, 0x281A9F6A, 0xE4B09FF4, 0x6A3F9817, 0xA6959889,
+					0x7FB58A25, 0xB31F8ABB, 0x3D908D58, 0xF13A8DC6, 0xFBFF84DF, 0x37558441, 0xB9DA83A2, 0x7570833C,
+					0x533B85DA, 0x9F918544, 0x111E82A7, 0xDDB48239, 0xD7718B20, 0x1BDB8BBE, 0x95548C5D, 0x59FE8CC3,
+					0x80DE9E6F, 0x4C749EF1, 0xC2FB9912, 0x0E51998C, 0x04949095, 0xC83E900B, 0x46B197E8, 0x8A1B9776,
+					0x2F80B4F1, 0xE32AB46F, 0x6DA5B38C, 0xA10FB312, 0xABCABA0B, 0x6760BA95, 0xE9EFBD76, 0x2545BDE8,
+					0xFC65AF44, 0x30CFAFDA, 0xBE40A839, 0x72EAA8A7, 0x782FA1BE, 0xB485A120, 0x3A0AA6C3, 0xF6A0A65D,
+					0xAA4DE78C, 0x66E7E712, 0xE868E0F1, 0x24C2E06F, 0x2E07E976, 0xE2ADE9E8, 0x6C22EE0B, 0xA088EE95,
+					0x79A8FC39, 0xB502FCA7, 0x3B8DFB44, 0xF727FBDA, 0xFDE2F2C3, 0x3148F25D, 0xBFC7F5BE, 0x736DF520,
+					0xD6F6D6A7, 0x1A5CD639, 0x94D3D1DA, 0x5879D144, 0x52BCD85D, 0x9E16D8C3, 0x1099DF20, 0xDC33DFBE,
+					0x0513CD12, 0xC9B9CD8C, 0x4736CA6F, 0x8B9CCAF1, 0x8159C3E8, 0x4DF3C376, 0xC37CC495, 0x0FD6C40B,
+					0x7AA64737, 0xB60C47A9, 0x3883404A, 0xF42940D4, 0xFEEC49CD, 0x32464953, 0xBCC94EB0, 0x70634E2E,
+					0xA9435C82, 0x65E95C1C, 0xEB665BFF, 0x27CC5B61, 0x2D095278, 0xE1A352E6, 0x6F2C5505, 0xA386559B,
+					0x061D761C, 0xCAB77682, 0x44387161, 0x889271FF, 0x825778E6, 0x4EFD7878, 0xC0727F9B, 0x0CD87F05,
+					0xD5F86DA9, 0x19526D37, 0x97DD6AD4, 0x5B776A4A, 0x51B26353, 0x9D1863CD, 0x1397642E, 0xDF3D64B0,
+					0x83D02561, 0x4F7A25FF, 0xC1F5221C, 0x0D5F2282, 0x079A2B9B, 0xCB302B05, 0x45BF2CE6, 0x89152C78,
+					0x50353ED4, 0x9C9F3E4A, 0x121039A9, 0xDEBA3937, 0xD47F302E, 0x18D530B0, 0x965A3753, 0x5AF037CD,
+					0xFF6B144A, 0x33C114D4, 0xBD4E1337, 0x71E413A9, 0x7B211AB0, 0xB78B1A2E, 0x39041DCD, 0xF5AE1D53,
+					0x2C8E0FFF, 0xE0240F61, 0x6EAB0882, 0xA201081C, 0xA8C40105, 0x646E019B, 0xEAE10678, 0x264B06E6
+				}
+			};
+
+			// Internal PCLMULQDQ folding, as described in Intel's "Fast CRC Computation for
+			// Generic Polynomials Using PCLMULQDQ Instruction", with the constants for the
+			// reflected polynomial. 'len' must be at least 64 and a multiple of 16, and 'crc'
+			// is the inverted CRC (as used internally by the scalar path).
+
+			#if defined(MU_SSE2) && (defined(__PCLMUL__) || defined(MU_CPU_DISPATCH) || defined(MU_AVX2))
+				#define MUU_CRC32_PCLMUL
+				#include <wmmintrin.h>
+
+				MUDEF inline MU_TARGET("sse2,pclmul") uint32_m muu_inner_crc32_pclmul(muByte* b, size_m len, uint32_m crc) {
+					const __m128i k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+					const __m128i k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+					const __m128i k5k0 = _mm_set_epi64x(0, 0x0163CD6124);
+					const __m128i poly = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+					const __m128i mask = _mm_setr_epi32(-1, 0, -1, 0);
+
+					__m128i x1 = _mm_loadu_si128((const __m128i*)&b[0]);
+					__m128i x2 = _mm_loadu_si128((const __m128i*)&b[16]);
+					__m128i x3 = _mm_loadu_si128((const __m128i*)&b[32]);
+					__m128i x4 = _mm_loadu_si128((const __m128i*)&b[48]);
+					x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+					b += 64;
+					len -= 64;
+
+					// Fold 4 blocks of 128 bits at a time
+					while (len >= 64) {
+						__m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+						__m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+						__m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+						__m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+						x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+						x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+						x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+						x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+						x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i*)&b[0]));
+						x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i*)&b[16]));
+						x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i*)&b[32]));
+						x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i*)&b[48]));
+						b += 64;
+						len -= 64;
+					}
+
+					// Fold the 4 blocks into 1
+					__m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+					x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+					x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+					x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+					x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+					x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+					x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+					x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+					x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+					// Fold the remaining blocks of 128 bits one at a time
+					while (len >= 16) {
+						x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+						x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+						x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i*)b)), x5);
+						b += 16;
+						len -= 16;
+					}
+
+					// Fold 128 bits into 64 bits
+					x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+					x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+					x2 = _mm_srli_si128(x1, 4);
+					x1 = _mm_and_si128(x1, mask);
+					x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+					x1 = _mm_xor_si128(x1, x2);
+
+					// Barrett-reduce into 32 bits
+					x2 = _mm_and_si128(x1, mask);
+					x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+					x2 = _mm_and_si128(x2, mask);
+					x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+					x1 = _mm_xor_si128(x1, x2);
+					return (uint32_m)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+				}
+			#endif
+
+			// @DOCLINE The function `muu_crc32` updates a CRC-32 checksum with `len` bytes of data, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint32_m muu_crc32(uint32_m crc, muByte* b, size_m len);
+			```
+			@DOCEND */
+
+			MUDEF inline uint32_m muu_crc32(uint32_m crc, muByte* b, size_m len) {
+				crc = ~crc;
+
+				#ifdef MUU_CRC32_PCLMUL
+					#ifndef __PCLMUL__
+					if (len >= 64 && muu_cpu_has(MU_CPU_PCLMUL))
+					#else
+					if (len >= 64)
+					#endif
+					{
+						size_m chunk = len & ~(size_m)15;
+						crc = muu_inner_crc32_pclmul(b, chunk, crc);
+						b += chunk;
+						len -= chunk;
+					}
+				#endif
+
+				const uint32_m (*t)[256] = muu_inner_crc32_table;
+				for (; len >= 8; b += 8, len -= 8) {
+					uint32_m lo = MU_RLEU32(b) ^ crc;
+					uint32_m hi = MU_RLEU32(&b[4]);
+					crc =
+						t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+						t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24]
+					;
+				}
+				for (; len; ++b, --len) {
+					crc = t[0][(crc ^ *b) & 0xFF] ^ (crc >> 8);
+				}
+				return ~crc;
+			}
+
+			// @DOCLINE The checksum of a whole buffer is computed with `muu_crc32(MU_CRC32_INIT, b, len)`. Data is processed 8 bytes at a time using slicing-by-8 tables, or, for runs of at least 64 bytes on x86 CPUs supporting `PCLMULQDQ` (see `MU_CPU_PCLMUL`), 64 bytes at a time using carry-less multiplication.
+
+		// @DOCLINE ## Adler-32
+
+			// @DOCLINE The macro `MU_ADLER32_INIT` is the starting value of an Adler-32 checksum, being 1.
+
+			#define MU_ADLER32_INIT 1
+
+			// Modulus of Adler-32, and the largest amount of bytes that can be summed before the
+			// sums have to be reduced without overflowing 32 bits
+			#define MUU_ADLER32_BASE 65521
+			#define MUU_ADLER32_NMAX 5552
+
+			// Internal SSSE3 part; processes as many blocks of 32 bytes as it can, returning the
+			// amount of bytes processed and updating the sums (which it leaves reduced)
+			#if defined(MU_SSSE3) || defined(MU_CPU_DISPATCH)
+				MUDEF inline MU_TARGET("ssse3") size_m muu_inner_adler32_ssse3(muByte* b, size_m len, uint32_m* s1p, uint32_m* s2p) {
+					const __m128i tap1 = _mm_setr_epi8(32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17);
+					const __m128i tap2 = _mm_setr_epi8(16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1);
+					const __m128i zero = _mm_setzero_si128();
+					const __m128i ones = _mm_set1_epi16(1);
+					uint32_m s1 = *s1p, s2 = *s2p;
+					size_m blocks = len / 32;
+					size_m done = blocks * 32;
+
+					while (blocks) {
+						size_m n = MUU_ADLER32_NMAX / 32;
+						if (n > blocks) {
+							n = blocks;
+						}
+						blocks -= n;
+
+						// 'ps' accumulates s1 as of the start of each block, to be multiplied by
+						// the block size at the end; its initial value accounts for the incoming s1
+						__m128i ps = _mm_cvtsi32_si128((int)(s1 * (uint32_m)n));
+						__m128i v2 = _mm_cvtsi32_si128((int)s2);
+						__m128i v1 = zero;
+						for (; n; --n, b += 32) {
+							__m128i x1 = _mm_loadu_si128((const __m128i*)&b[0]);
+							__m128i x2 = _mm_loadu_si128((const __m128i*)&b[16]);
+							ps = _mm_add_epi32(ps, v1);
+							v1 = _mm_add_epi32(v1, _mm_sad_epu8(x1, zero));
+							v2 = _mm_add_epi32(v2, _mm_madd_epi16(_mm_maddubs_epi16(x1, tap1), ones));
+							v1 = _mm_add_epi32(v1, _mm_sad_epu8(x2, zero));
+							v2 = _mm_add_epi32(v2, _mm_madd_epi16(_mm_maddubs_epi16(x2, tap2), ones));
+						}
+						v2 = _mm_add_epi32(v2, _mm_slli_epi32(ps, 5));
+
+						// Horizontal sums
+						v1 = _mm_add_epi32(v1, _mm_shuffle_epi32(v1, _MM_SHUFFLE(2,3,0,1)));
+						v1 = _mm_add_epi32(v1, _mm_shuffle_epi32(v1, _MM_SHUFFLE(1,0,3,2)));
+						v2 = _mm_add_epi32(v2, _mm_shuffle_epi32(v2, _MM_SHUFFLE(2,3,0,1)));
+						v2 = _mm_add_epi32(v2, _mm_shuffle_epi32(v2, _MM_SHUFFLE(1,0,3,2)));
+						s1 = (s1 + (uint32_m)_mm_cvtsi128_si32(v1)) % MUU_ADLER32_BASE;
+						s2 = (uint32_m)_mm_cvtsi128_si32(v2) % MUU_ADLER32_BASE;
+					}
+
+					*s1p = s1;
+					*s2p = s2;
+					return done;
+				}
+			#endif
+
+			// @DOCLINE The function `muu_adler32` updates an Adler-32 checksum with `len` bytes of data, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint32_m muu_adler32(uint32_m adler, muByte* b, size_m len);
+			```
+			@DOCEND */
+
+			MUDEF inline uint32_m muu_adler32(uint32_m adler, muByte* b, size_m len) {
+				uint32_m s1 = adler & 0xFFFF;
+				uint32_m s2 = adler >> 16;
+
+				#if defined(MU_SSSE3)
+					size_m done = muu_inner_adler32_ssse3(b, len, &s1, &s2);
+					b += done;
+					len -= done;
+				#elif defined(MU_CPU_DISPATCH)
+					if (muu_cpu_has(MU_CPU_SSSE3)) {
+						size_m done = muu_inner_adler32_ssse3(b, len, &s1, &s2);
+						b += done;
+						len -= done;
+					}
+				#endif
+
+				while (len) {
+					size_m n = (len < MUU_ADLER32_NMAX) ? len : MUU_ADLER32_NMAX;
+					len -= n;
+					for (; n >= 4; n -= 4, b += 4) {
+						s1 += b[0]; s2 += s1;
+						s1 += b[1]; s2 += s1;
+						s1 += b[2]; s2 += s1;
+						s1 += b[3]; s2 += s1;
+					}
+					for (; n; --n, ++b) {
+						s1 += *b; s2 += s1;
+					}
+					s1 %= MUU_ADLER32_BASE;
+					s2 %= MUU_ADLER32_BASE;
+				}
+				return (s2 << 16) | s1;
+			}
+
+			// @DOCLINE The checksum of a whole buffer is computed with `muu_adler32(MU_ADLER32_INIT, b, len)`. On x86 CPUs supporting SSSE3 (see `MU_CPU_SSSE3`), data is processed 32 bytes at a time.
+
+	// @DOCLINE # Hashing
+
+		// @DOCLINE muUtility provides a fast, seedable, non-cryptographic 64-bit hash function, meant for hash tables, caches, and deduplication. It is an implementation of wyhash (final version 4), and produces the same values as it does with the default secret. It is not suitable for anything security-related, such as hashing passwords or protecting against hash flooding from untrusted input (though using a random seed makes the latter harder).
+
+		// Internal 64x64->128-bit multiplication; stores the low 64 bits in 'a' and the high
+		// 64 bits in 'b'
+		MUDEF inline void muu_inner_mum(uint64_m* a, uint64_m* b) {
+			#if defined(__SIZEOF_INT128__)
+				__extension__ typedef unsigned __int128 muu_inner_u128;
+				muu_inner_u128 r = (muu_inner_u128)*a * *b;
+				*a = (uint64_m)r;
+				*b = (uint64_m)(r >> 64);
+			#elif defined(_MSC_VER) && defined(_M_X64)
+				*a = _umul128(*a, *b, b);
+			#else
+				uint64_m ha = *a >> 32, hb = *b >> 32, la = (uint32_m)*a, lb = (uint32_m)*b;
+				uint64_m rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+				uint64_m t = rl + (rm0 << 32);
+				uint64_m c = t < rl;
+				uint64_m lo = t + (rm1 << 32);
+				c += lo < t;
+				*a = lo;
+				*b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+			#endif
+		}
+
+		MUDEF inline uint64_m muu_inner_mix(uint64_m a, uint64_m b) {
+			muu_inner_mum(&a, &b);
+			return a ^ b;
+		}
+
+		// Secret constants
+		#define MUU_HASH_P0 0x2D358DCCAA6C78A5ull
+		#define MUU_HASH_P1 0x8BB84B93962EACC9ull
+		#define MUU_HASH_P2 0x4B33A62ED433D4A3ull
+		#define MUU_HASH_P3 0x4D5A2DA51DE1AA47ull
+
+		// Internal parts of the hash, shared between the one-shot and streaming interfaces:
+		// processing a 48-byte stripe with 3 independent lanes, and finishing data longer
+		// than 16 bytes, in which 'p' holds the last 'i' bytes of the data (with at least 16
+		// readable bytes ending at 'p+i').
+
+		MUDEF inline void muu_inner_hash_stripe(muByte* p, uint64_m* seed, uint64_m* see1, uint64_m* see2) {
+			*seed = muu_inner_mix(MU_RLEU64(&p[0]) ^ MUU_HASH_P1, MU_RLEU64(&p[8]) ^ *seed);
+			*see1 = muu_inner_mix(MU_RLEU64(&p[16]) ^ MUU_HASH_P2, MU_RLEU64(&p[24]) ^ *see1);
+			*see2 = muu_inner_mix(MU_RLEU64(&p[32]) ^ MUU_HASH_P3, MU_RLEU64(&p[40]) ^ *see2);
+		}
+
+		MUDEF inline uint64_m muu_inner_hash_final(uint64_m a, uint64_m b, uint64_m seed, uint64_m len) {
+			a ^= MUU_HASH_P1;
+			b ^= seed;
+			muu_inner_mum(&a, &b);
+			return muu_inner_mix(a ^ MUU_HASH_P0 ^ len, b ^ MUU_HASH_P1);
+		}
+
+		MUDEF inline uint64_m muu_inner_hash_tail(muByte* p, size_m i, uint64_m seed, uint64_m len) {
+			for (; i > 16; i -= 16, p += 16) {
+				seed = muu_inner_mix(MU_RLEU64(&p[0]) ^ MUU_HASH_P1, MU_RLEU64(&p[8]) ^ seed);
+			}
+			return muu_inner_hash_final(MU_RLEU64(&p[i-16]), MU_RLEU64(&p[i-8]), seed, len);
+		}
+
+		// Hashes data of at most 16 bytes
+		MUDEF inline uint64_m muu_inner_hash_short(muByte* p, size_m len, uint64_m seed) {
+			uint64_m a, b;
+			if (len >= 4) {
+				size_m m = (len >> 3) << 2;
+				a = ((uint64_m)MU_RLEU32(p) << 32) | MU_RLEU32(&p[m]);
+				b = ((uint64_m)MU_RLEU32(&p[len-4]) << 32) | MU_RLEU32(&p[len-4-m]);
+			} else if (len > 0) {
+				a = ((uint64_m)p[0] << 16) | ((uint64_m)p[len >> 1] << 8) | p[len-1];
+				b = 0;
+			} else {
+				a = b = 0;
+			}
+			return muu_inner_hash_final(a, b, seed, len);
+		}
+
+		MUDEF inline uint64_m muu_inner_hash_seed(uint64_m seed) {
+			return seed ^ muu_inner_mix(seed ^ MUU_HASH_P0, MUU_HASH_P1);
+		}
+
+		// @DOCLINE ## One-shot hashing
+
+			// @DOCLINE The function `muu_hash64` hashes `len` bytes of data, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint64_m muu_hash64(muByte* b, size_m len, uint64_m seed);
+			```
+			@DOCEND */
+
+			MUDEF inline uint64_m muu_hash64(muByte* b, size_m len, uint64_m seed) {
+				seed = muu_inner_hash_seed(seed);
+				if (len <= 16) {
+					return muu_inner_hash_short(b, len, seed);
+				}
+
+				size_m i = len;
+				if (i >= 48) {
+					uint64_m see1 = seed, see2 = seed;
+					for (; i >= 48; i -= 48, b += 48) {
+						muu_inner_hash_stripe(b, &seed, &see1, &see2);
+					}
+					seed ^= see1 ^ see2;
+				}
+				return muu_inner_hash_tail(b, i, seed, len);
+			}
+
+			// @DOCLINE Data is read 8 bytes at a time with `MU_RLEU64`, meaning that hash values are the same regardless of the byte order of the host. Different seeds produce unrelated hash values; 0 is a fine seed if there's no reason to pick another one.
+
+		// @DOCLINE ## Integer keys
+
+			// @DOCLINE The functions `muu_hash64_u32` and `muu_hash64_u64` hash a single 32-bit or 64-bit integer, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint64_m muu_hash64_u32(uint32_m n, uint64_m seed);
+			MUDEF inline uint64_m muu_hash64_u64(uint64_m n, uint64_m seed);
+			```
+			@DOCEND */
+
+			MUDEF inline uint64_m muu_hash64_u32(uint32_m n, uint64_m seed) {
+				uint64_m v = ((uint64_m)n << 32) | n;
+				return muu_inner_hash_final(v, v, muu_inner_hash_seed(seed), 4);
+			}
+
+			MUDEF inline uint64_m muu_hash64_u64(uint64_m n, uint64_m seed) {
+				return muu_inner_hash_final((n << 32) | (n >> 32), n, muu_inner_hash_seed(seed), 8);
+			}
+
+			// @DOCLINE These skip all length checks and memory reads, and return the same value that `muu_hash64` does for the little-endian bytes of the integer.
+
+		// @DOCLINE ## Streaming hashing
+
+			// @DOCLINE The struct `muHasher` holds the state of a hash being computed over data arriving in pieces, and has the following members, which shouldn't be modified directly:
+
+			struct muHasher {
+				// @DOCLINE * `uint64_m seed` - the state of the first lane.
+				uint64_m seed;
+				// @DOCLINE * `uint64_m see1` - the state of the second lane.
+				uint64_m see1;
+				// @DOCLINE * `uint64_m see2` - the state of the third lane.
+				uint64_m see2;
+				// @DOCLINE * `uint64_m len` - the amount of bytes hashed so far.
+				uint64_m len;
+				// @DOCLINE * `muByte buf[64]` - the last 16 bytes of processed data, followed by up to 48 bytes of unprocessed data.
+				muByte buf[64];
+				// @DOCLINE * `size_m buflen` - the amount of unprocessed bytes in `buf`.
+				size_m buflen;
+			};
+			typedef struct muHasher muHasher;
+
+			// @DOCLINE The function `muu_hasher_init` initializes a hasher with a seed, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_hasher_init(muHasher* h, uint64_m seed);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_hasher_init(muHasher* h, uint64_m seed) {
+				h->seed = h->see1 = h->see2 = muu_inner_hash_seed(seed);
+				h->len = 0;
+				h->buflen = 0;
+			}
+
+			// @DOCLINE The function `muu_hasher_update` hashes the next `len` bytes of data, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_hasher_update(muHasher* h, muByte* b, size_m len);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_hasher_update(muHasher* h, muByte* b, size_m len) {
+				h->len += len;
+
+				// Fill the buffer, processing it once it holds a full stripe
+				if (h->buflen) {
+					size_m n = 48 - h->buflen;
+					if (n > len) {
+						n = len;
+					}
+					mu_memcpy(&h->buf[16 + h->buflen], b, n);
+					h->buflen += n;
+					b += n;
+					len -= n;
+					if (h->buflen < 48) {
+						return;
+					}
+					muu_inner_hash_stripe(&h->buf[16], &h->seed, &h->see1, &h->see2);
+					mu_memcpy(h->buf, &h->buf[48], 16);
+					h->buflen = 0;
+				}
+
+				// Process full stripes directly from the data
+				if (len >= 48) {
+					for (; len >= 48; len -= 48, b += 48) {
+						muu_inner_hash_stripe(b, &h->seed, &h->see1, &h->see2);
+					}
+					mu_memcpy(h->buf, b - 16, 16);
+				}
+
+				mu_memcpy(&h->buf[16], b, len);
+				h->buflen = len;
+			}
+
+			// @DOCLINE The function `muu_hasher_digest` returns the hash of all data given so far, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint64_m muu_hasher_digest(muHasher* h);
+			```
+			@DOCEND */
+
+			MUDEF inline uint64_m muu_hasher_digest(muHasher* h) {
+				if (h->len <= 16) {
+					return muu_inner_hash_short(&h->buf[16], (size_m)h->len, h->seed);
+				}
+				uint64_m seed = h->seed;
+				if (h->len >= 48) {
+					seed ^= h->see1 ^ h->see2;
+				}
+				return muu_inner_hash_tail(&h->buf[16], h->buflen, seed, h->len);
+			}
+
+			// @DOCLINE The value returned is the same as `muu_hash64` would return for all of the data at once with the same seed, regardless of how the data was split up. The hasher isn't modified, so more data can be given after a digest.
+
+	// @DOCLINE # Set result
+
+		/* @DOCBEGIN
+
+		The `MU_SET_RESULT(res, val)` macro is an overridable function that checks if the given parameter `res` is a null pointer. If it is, it does nothing, but if it isn't, it dereferences the pointer and sets the value to `val`. This macro saves a lot of code, shrinking down what would be this:
+
+		```c
+		if (result) {
+			*result = ...;
+		}
+		```
+
+		into this:
+
+		```c
+		MU_SET_RESULT(result, ...)
+		```
+
+		@DOCEND */
+
+		#ifndef MU_SET_RESULT
+			#define MU_SET_RESULT(res, val) if(res){*res=val;}
+		#endif
+
+	// @DOCLINE # Enum
+
+		/* @DOCBEGIN
+
+		The `MU_ENUM(name, ...)` macro is an overridable function used to declare an enumerator. `name` is the name of the enumerator type, and `...` are all of the values. The reason why one would prefer this over the traditional way of declaring enumerators is because it actually makes it a `size_m`, which can avoid errors on certain compilers (looking at you, Microsoft) in regards to treating enumerators like values. It expands like this:
+
+		```c
+		enum _##name {
+			__VA_ARGS__
+		};
+		typedef enum _##name _##name;
+		typedef size_m name;
+		```
+
+		@DOCEND */
+
+		#define MU_ENUM(name, ...) enum _##name{__VA_ARGS__};typedef enum _##name _##name;typedef size_m name;
+
+		/* @DOCBEGIN
+
+		Since `size_m` is usually 8 bytes wide, the macro `MU_ENUM_TYPED(name, type, ...)` is also defined, which works the same way as `MU_ENUM`, but uses `type` as the storage type of the enumerator instead, being an integer type (such as `uint8_m`) that must be able to hold all of the values. This keeps the same protection against compilers treating enumerators and values differently, while letting structs with enumerator members take up less space. It expands like this:
+
+		```c
+		enum _##name {
+			__VA_ARGS__
+		};
+		typedef enum _##name _##name;
+		typedef type name;
+		```
+
+		@DOCEND */
+
+		#define MU_ENUM_TYPED(name, type, ...) enum _##name{__VA_ARGS__};typedef enum _##name _##name;typedef type name;
+
+		/* @DOCBEGIN
+
+		The macro `MU_ENUM_NAMED(name, type, values)` declares an enumerator like `MU_ENUM_TYPED`, along with a table of the names of its values. `values` is the name of a function-like macro taking one parameter, `X`, which lists the values by expanding to `X(value)` for each one; the values are numbered from 0 in the order that they're listed. For example:
+
+		```c
+		#define EVENT_KIND(X) \
+			X(EVENT_PRESS) \
+			X(EVENT_RELEASE) \
+			X(EVENT_MOVE)
+
+		MU_ENUM_NAMED(EventKind, uint8_m, EVENT_KIND)
+		```
+
+		Besides the listed values, the enumerator gets the value `name##_COUNT`, which is the amount of listed values. The declaration fails to compile if `name##_COUNT - 1` doesn't fit in `type`. `MU_ENUM_NAMED` also declares the function `name##_name`, which returns the name of a value as a string by indexing the table (so `EventKind_name(EVENT_RELEASE)` returns `"EVENT_RELEASE"`), or 0 if the value is out of range, defined as `MUDEF inline const char* name##_name(name v)`.
+
+		@DOCEND */
+
+		#define MUU_ENUM_VALUE(value) value,
+		#define MUU_ENUM_STRING(value) #value,
+
+		#define MU_ENUM_NAMED(name, type, values) \
+			enum _##name { \
+				values(MUU_ENUM_VALUE) \
+				name##_COUNT \
+			}; \
+			typedef enum _##name _##name; \
+			typedef type name; \
+			typedef char name##_fits_type[((type)(name##_COUNT - 1) == name##_COUNT - 1) ? 1 : -1]; \
+			\
+			MUDEF inline const char* name##_name(name v) { \
+				static const char* const names[] = { values(MUU_ENUM_STRING) 0 }; \
+				return ((size_m)v < (size_m)name##_COUNT) ? names[v] : 0; \
+			}
+
+	// @DOCLINE # Result
+
+		// @DOCLINE The `muuResult` enumerator is used by muUtility functions that can fail to report what went wrong, via a `muuResult*` parameter set with `MU_SET_RESULT`. It has the following values:
+
+		MU_ENUM(muuResult,
+			// @DOCLINE * `MUU_SUCCESS` - the operation succeeded.
+			MUU_SUCCESS,
+			// @DOCLINE * `MUU_OUT_OF_DATA` - there wasn't enough data left to read.
+			MUU_OUT_OF_DATA,
+			// @DOCLINE * `MUU_OUT_OF_SPACE` - there wasn't enough space left to write.
+			MUU_OUT_OF_SPACE,
+			// @DOCLINE * `MUU_FLUSH_FAILED` - a flush callback reported failure.
+			MUU_FLUSH_FAILED,
+			// @DOCLINE * `MUU_ALLOCATION_FAILED` - a memory allocation failed.
+			MUU_ALLOCATION_FAILED,
+			// @DOCLINE * `MUU_FILE_OPEN_FAILED` - a file couldn't be opened or queried.
+			MUU_FILE_OPEN_FAILED,
+			// @DOCLINE * `MUU_FILE_READ_FAILED` - reading a file's contents failed.
+			MUU_FILE_READ_FAILED,
+			// @DOCLINE * `MUU_INVALID_DATA` - the data being read was malformed.
+			MUU_INVALID_DATA,
+			// @DOCLINE * `MUU_THREAD_FAILED` - a thread couldn't be created.
+			MUU_THREAD_FAILED,
+		)
+
+	// @DOCLINE # Operating system recognition
+
+		/* @DOCBEGIN
+
+		The macros `MU_WIN32` or `MU_LINUX` are defined (if neither were defined before) in order to allow mu libraries to easily check if they're running on a Windows or Linux system.
+
+		`MU_WIN32` will be defined if `WIN32` or `_WIN32` are defined, one of which is usually pre-defined on Windows systems.
+
+		`MU_LINUX` will be defined if `__linux__` is defined.
+
+		@DOCEND */
+
+		#if !defined(MU_WIN32) && !defined(MU_LINUX)
+			#if defined(WIN32) || defined(_WIN32)
+				#define MU_WIN32
+			#endif
+			#if defined(__linux__)
+				#define MU_LINUX
+			#endif
+		#endif
+
+	// @DOCLINE # Time
+
+		// @DOCLINE muUtility provides a monotonic clock for measuring elapsed time, and a cycle counter for measuring very short spans of code.
+
+		#if defined(MU_WIN32)
+			#ifndef WIN32_LEAN_AND_MEAN
+				#define WIN32_LEAN_AND_MEAN
+			#endif
+			#include <windows.h>
+		#else
+			#include <time.h>
+		#endif
+
+		// @DOCLINE The function `muu_time_ns` returns the current time of a monotonic clock in nanoseconds, defined below:
+
+		/* @DOCBEGIN
+		```c
+		MUDEF inline uint64_m muu_time_ns(void);
+		```
+		@DOCEND */
+
+		MUDEF inline uint64_m muu_time_ns(void) {
+			#if defined(MU_WIN32)
+				static LARGE_INTEGER freq;
+				if (!freq.QuadPart) {
+					QueryPerformanceFrequency(&freq);
+				}
+				LARGE_INTEGER t;
+				QueryPerformanceCounter(&t);
+				// Split to avoid overflowing 64 bits
+				uint64_m s = (uint64_m)t.QuadPart / (uint64_m)freq.QuadPart;
+				uint64_m r = (uint64_m)t.QuadPart % (uint64_m)freq.QuadPart;
+				return s * 1000000000ull + r * 1000000000ull / (uint64_m)freq.QuadPart;
+			#elif defined(CLOCK_MONOTONIC)
+				struct timespec t;
+				clock_gettime(CLOCK_MONOTONIC, &t);
+				return (uint64_m)t.tv_sec * 1000000000ull + (uint64_m)t.tv_nsec;
+			#elif defined(TIME_UTC)
+				struct timespec t;
+				timespec_get(&t, TIME_UTC);
+				return (uint64_m)t.tv_sec * 1000000000ull + (uint64_m)t.tv_nsec;
+			#else
+				return (uint64_m)clock() * (1000000000ull / CLOCKS_PER_SEC);
+			#endif
+		}
+
+		// @DOCLINE The value of the clock only has meaning relative to other values returned by it. On `MU_WIN32`, it uses `QueryPerformanceCounter`; otherwise, it uses `clock_gettime` with `CLOCK_MONOTONIC` if `time.h` declares it, falling back to the C11 function `timespec_get` (which isn't monotonic), or `clock` (which measures processor time) if not. Note that, when compiling with a strict standard mode (such as `-std=c99`), `time.h` only declares `clock_gettime` if a feature-test macro such as `_DEFAULT_SOURCE` or `_POSIX_C_SOURCE` (`199309L` or later) is defined before the inclusion of any system header, as with mapped files; without one, the clock falls back to `clock`. Since that makes profiling timestamps meaningless, enabling profiling (see `MU_PROFILE`) on `MU_LINUX` without `clock_gettime` being declared is a compile error.
+
+		// @DOCLINE The function `muu_cycles` returns the current value of a cycle counter, defined below:
+
+		/* @DOCBEGIN
+		```c
+		MUDEF inline uint64_m muu_cycles(void);
+		```
+		@DOCEND */
+
+		MUDEF inline uint64_m muu_cycles(void) {
+			#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+				return __builtin_ia32_rdtsc();
+			#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+				return __rdtsc();
+			#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+				uint64_m t;
+				__asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(t));
+				return t;
+			#else
+				return muu_time_ns();
+			#endif
+		}
+
+		// @DOCLINE On x86, this is the time-stamp counter (`RDTSC`), which on modern CPUs ticks at a constant rate regardless of the current clock speed; on AArch64, it's the virtual counter (`CNTVCT_EL0`). Neither is guaranteed to be synchronized across cores or to tick at any particular rate, so the cycle counter is meant for measuring and comparing short spans of code on a single thread; `muu_time_ns` is used on other architectures.
+
+	// @DOCLINE # Allocation
+
+		// @DOCLINE All memory allocated by muUtility (and ideally by mu libraries in general) goes through the allocation macros below, which are overridable by defining them before the inclusion of muUtility, allowing all allocations to be routed to a custom allocator in one place:
+
+		// @DOCLINE * `MU_ALLOC(size)` - allocates `size` bytes, returning 0 upon failure; defaults to `mu_malloc`.
+
+		// @DOCLINE * `MU_REALLOC(p, size)` - reallocates `p` to `size` bytes, returning 0 upon failure; defaults to `mu_realloc`.
+
+		// @DOCLINE * `MU_FREE(p)` - frees `p`; defaults to `mu_free`.
+
+		// @DOCLINE If a custom allocator only needs to replace the C standard library functions, overriding `mu_malloc`, `mu_realloc`, and `mu_free` is enough.
+
+		// @DOCLINE ## Instrumentation
+
+			// @DOCLINE If `MU_ALLOC_INSTRUMENT` is defined before the inclusion of muUtility (and the allocation macros aren't overridden), every allocation made through the allocation macros is recorded along with the file and line of its call site. The statistics can be queried at runtime, which allows finding where, how often, and how much memory is being allocated. This adds a 16-byte header to every allocation and takes a lock upon every allocation, so it is meant for profiling rather than for release builds.
+
+			// @DOCLINE Statistics are kept in a fixed-size table of `MU_ALLOC_MAX_SITES` call sites (overridable; 256 by default); once it is full, allocations from new call sites are recorded under a single site whose file is `"(other)"` and whose line is 0. Allocation sizes are recorded in a histogram of `MU_ALLOC_SIZE_CLASSES` (32) size classes, in which class `i` holds allocations of a size between 2^i and 2^(i+1)-1 bytes (with class 0 also holding allocations of 0 bytes, and the last class also holding every larger size).
+
+			#define MU_ALLOC_SIZE_CLASSES 32
+
+			#ifndef MU_ALLOC_MAX_SITES
+				#define MU_ALLOC_MAX_SITES 256
+			#endif
+
+			// @DOCLINE The struct `muAllocSite` holds the statistics of one call site, and has the following members:
+
+			struct muAllocSite {
+				// @DOCLINE * `const char* file` - the file of the call site, as given by `__FILE__`.
+				const char* file;
+				// @DOCLINE * `uint32_m line` - the line of the call site.
+				uint32_m line;
+				// @DOCLINE * `uint64_m allocs` - the amount of allocations made.
+				uint64_m allocs;
+				// @DOCLINE * `uint64_m reallocs` - the amount of times allocations were resized.
+				uint64_m reallocs;
+				// @DOCLINE * `uint64_m frees` - the amount of allocations freed.
+				uint64_m frees;
+				// @DOCLINE * `uint64_m bytes` - the total amount of bytes allocated, in which a resize counts the amount of bytes it grew the allocation by.
+				uint64_m bytes;
+				// @DOCLINE * `uint64_m live` - the amount of bytes currently allocated.
+				uint64_m live;
+				// @DOCLINE * `uint64_m peak` - the highest value `live` has had.
+				uint64_m peak;
+				// @DOCLINE * `uint64_m classes[MU_ALLOC_SIZE_CLASSES]` - the amount of allocations made in each size class.
+				uint64_m classes[MU_ALLOC_SIZE_CLASSES];
+			};
+			typedef struct muAllocSite muAllocSite;
+
+			// @DOCLINE Frees and reallocations are attributed to the call site that made the allocation, not the one that freed or resized it; a reallocation of a null pointer counts as an allocation at its own call site. Call sites are identified by the contents of their file name and their line, so the same line reached from different translation units that share their statistics (see below) is one call site.
+
+			// @DOCLINE The statistics are kept in a single state per copy of the instrumentation functions. In C++, that is one state for the whole program, as the copies in each translation unit are merged. In C, however, several translation units can only include muUtility under `MU_STATIC`, which gives every translation unit its own copy, and so by default its own statistics, covering only the allocations, reallocations, and frees made from that translation unit (which means that memory allocated in one translation unit and freed in another is counted as live in the first, and wraps `live` around in the second). To share the statistics across translation units, define `MU_ALLOC_SHARED_STATE` before every inclusion of muUtility, and `MU_ALLOC_SHARED_STATE_DEFINE` before exactly one of them, which defines the shared state.
+
+			// @DOCLINE Since instrumented allocations have a header that uninstrumented allocations don't, every translation unit that allocates or frees the same memory must agree on `MU_ALLOC_INSTRUMENT`, as well as on `MU_ALLOC_MAX_SITES` and `MU_ALLOC_SHARED_STATE`.
+
+			// @DOCLINE Allocations made by muUtility itself (such as arena blocks, pool slabs, ring buffers, and profiler chunks) are attributed to the line of `muUtility.h` that makes them, rather than to the code that called into muUtility; their call sites still tell which kind of internal allocation is responsible.
+
+			// @DOCLINE The struct `muAllocStats` holds the statistics of all call sites combined, and has the members `allocs`, `reallocs`, `frees`, `bytes`, `live`, and `peak` (all `uint64_m`), with the same meanings as in `muAllocSite`, as well as `size_m site_count`, which is the amount of call sites recorded.
+
+			struct muAllocStats {
+				uint64_m allocs;
+				uint64_m reallocs;
+				uint64_m frees;
+				uint64_m bytes;
+				uint64_m live;
+				uint64_m peak;
+				size_m site_count;
+			};
+			typedef struct muAllocStats muAllocStats;
+
+			#if defined(MU_ALLOC_INSTRUMENT) && !defined(MU_ALLOC) && !defined(MU_REALLOC) && !defined(MU_FREE)
+
+				// Global instrumentation state
+				struct muu_inner_alloc_state {
+					muSpinLock lock;
+					muAllocStats stats;
+					muAllocSite sites[MU_ALLOC_MAX_SITES + 1];
+				};
+
+				#if defined(MU_ALLOC_SHARED_STATE)
+					extern struct muu_inner_alloc_state muu_inner_alloc_shared_state;
+					#if defined(MU_ALLOC_SHARED_STATE_DEFINE)
+						struct muu_inner_alloc_state muu_inner_alloc_shared_state;
+					#endif
+				#endif
+
+				MUDEF inline struct muu_inner_alloc_state* muu_inner_alloc_get_state(void) {
+					#if defined(MU_ALLOC_SHARED_STATE)
+						return &muu_inner_alloc_shared_state;
+					#else
+						static struct muu_inner_alloc_state state;
+						return &state;
+					#endif
+				}
+
+				// Header placed before every instrumented allocation
+				#define MUU_ALLOC_HEADER 16
+
+				// Compares two file names by their contents, as each translation unit
+				// can have its own copy of the same __FILE__ string
+				MUDEF inline muBool muu_inner_alloc_file_eq(const char* a, const char* b) {
+					if (a == b) {
+						return MU_TRUE;
+					}
+					while (*a && *a == *b) {
+						++a;
+						++b;
+					}
+					return *a == *b;
+				}
+
+				// Finds (or adds) the index of a call site; the state must be locked
+				MUDEF inline uint32_m muu_inner_alloc_site(struct muu_inner_alloc_state* s, const char* file, uint32_m line) {
+					// FNV-1a of the file name, mixed with the line
+					uint64_m fh = 0xCBF29CE484222325ull;
+					for (const char* c = file; *c; ++c) {
+						fh = (fh ^ (muByte)*c) * 0x100000001B3ull;
+					}
+					size_m h = (size_m)((fh ^ ((uint64_m)line * 2654435761u)) % MU_ALLOC_MAX_SITES);
+					for (size_m i = 0; i < MU_ALLOC_MAX_SITES; ++i) {
+						size_m j = (h + i) % MU_ALLOC_MAX_SITES;
+						muAllocSite* site = &s->sites[j];
+						if (site->file && site->line == line && muu_inner_alloc_file_eq(site->file, file)) {
+							return (uint32_m)j;
+						}
+						if (!site->file) {
+							site->file = file;
+							site->line = line;
+							s->stats.site_count++;
+							return (uint32_m)j;
+						}
+					}
+
+					// Table is full; use the overflow site
+					muAllocSite* site = &s->sites[MU_ALLOC_MAX_SITES];
+					if (!site->file) {
+						site->file = "(other)";
+						site->line = 0;
+						s->stats.site_count++;
+					}
+					return MU_ALLOC_MAX_SITES;
+				}
+
+				// Records an allocation or free of 'size' bytes at a site; the state must be locked.
+				// The site of a free comes from the allocation's header, which may have been
+				// written by a translation unit with a larger table, so it's bounds-checked, and
+				// only the combined statistics are kept if it's out of range.
+				MUDEF inline void muu_inner_alloc_record(struct muu_inner_alloc_state* s, uint32_m i, size_m size, muBool alloc) {
+					if (alloc) {
+						muAllocSite* site = &s->sites[i];
+						uint32_m c = 0;
+						while (c < MU_ALLOC_SIZE_CLASSES-1 && ((size_m)2 << c) <= size) {
+							++c;
+						}
+						site->classes[c]++;
+						site->allocs++;
+						site->bytes += size;
+						site->live += size;
+						if (site->live > site->peak) {
+							site->peak = site->live;
+						}
+						s->stats.allocs++;
+						s->stats.bytes += size;
+						s->stats.live += size;
+						if (s->stats.live > s->stats.peak) {
+							s->stats.peak = s->stats.live;
+						}
+					} else {
+						if (i <= MU_ALLOC_MAX_SITES) {
+							s->sites[i].frees++;
+							s->sites[i].live -= size;
+						}
+						s->stats.frees++;
+						s->stats.live -= size;
+					}
+				}
+
+				// Records the resize of an allocation at a site from 'old' to 'size' bytes;
+				// the state must be locked. The site is bounds-checked like for frees.
+				MUDEF inline void muu_inner_alloc_record_resize(struct muu_inner_alloc_state* s, uint32_m i, size_m old, size_m size) {
+					if (i <= MU_ALLOC_MAX_SITES) {
+						muAllocSite* site = &s->sites[i];
+						site->reallocs++;
+						if (size >= old) {
+							site->bytes += size - old;
+							site->live += size - old;
+						} else {
+							site->live -= old - size;
+						}
+						if (site->live > site->peak) {
+							site->peak = site->live;
+						}
+					}
+					s->stats.reallocs++;
+					if (size >= old) {
+						s->stats.bytes += size - old;
+						s->stats.live += size - old;
+					} else {
+						s->stats.live -= old - size;
+					}
+					if (s->stats.live > s->stats.peak) {
+						s->stats.peak = s->stats.live;
+					}
+				}
+
+				MUDEF inline void* muu_instrumented_alloc(size_m size, const char* file, uint32_m line) {
+					if (size > MU_SIZE_MAX - MUU_ALLOC_HEADER) {
+						return 0;
+					}
+					muByte* p = (muByte*)mu_malloc(size + MUU_ALLOC_HEADER);
+					if (!p) {
+						return 0;
+					}
+
+					struct muu_inner_alloc_state* s = muu_inner_alloc_get_state();
+					muu_spin_lock(&s->lock);
+					uint32_m site = muu_inner_alloc_site(s, file, line);
+					muu_inner_alloc_record(s, site, size, MU_TRUE);
+					muu_spin_unlock(&s->lock);
+
+					uint64_m size64 = size;
+					mu_memcpy(p, &size64, 8);
+					mu_memcpy(p + 8, &site, 4);
+					return p + MUU_ALLOC_HEADER;
+				}
+
+				MUDEF inline void muu_instrumented_free(void* p) {
+					if (!p) {
+						return;
+					}
+					muByte* b = ((muByte*)p) - MUU_ALLOC_HEADER;
+					uint64_m size;
+					uint32_m site;
+					mu_memcpy(&size, b, 8);
+					mu_memcpy(&site, b + 8, 4);
+
+					struct muu_inner_alloc_state* s = muu_inner_alloc_get_state();
+					muu_spin_lock(&s->lock);
+					muu_inner_alloc_record(s, site, (size_m)size, MU_FALSE);
+					muu_spin_unlock(&s->lock);
+
+					mu_free(b);
+				}
+
+				MUDEF inline void* muu_instrumented_realloc(void* p, size_m size, const char* file, uint32_m line) {
+					if (!p) {
+						return muu_instrumented_alloc(size, file, line);
+					}
+					if (size > MU_SIZE_MAX - MUU_ALLOC_HEADER) {
+						return 0;
+					}
+					muByte* b = ((muByte*)p) - MUU_ALLOC_HEADER;
+					uint64_m old;
+					uint32_m site;
+					mu_memcpy(&old, b, 8);
+					mu_memcpy(&site, b + 8, 4);
+
+					muByte* nb = (muByte*)mu_realloc(b, size + MUU_ALLOC_HEADER);
+					if (!nb) {
+						return 0;
+					}
+
+					struct muu_inner_alloc_state* s = muu_inner_alloc_get_state();
+					muu_spin_lock(&s->lock);
+					muu_inner_alloc_record_resize(s, site, (size_m)old, size);
+					muu_spin_unlock(&s->lock);
+
+					uint64_m size64 = size;
+					mu_memcpy(nb, &size64, 8);
+					return nb + MUU_ALLOC_HEADER;
+				}
+
+				#define MU_ALLOC(size) muu_instrumented_alloc(size, __FILE__, __LINE__)
+				#define MU_REALLOC(p, size) muu_instrumented_realloc(p, size, __FILE__, __LINE__)
+				#define MU_FREE(p) muu_instrumented_free(p)
+
+				// @DOCLINE The function `muu_alloc_get_stats` retrieves the combined statistics, defined below:
+
+				/* @DOCBEGIN
+				```c
+				MUDEF inline void muu_alloc_get_stats(muAllocStats* stats);
+				```
+				@DOCEND */
+
+				MUDEF inline void muu_alloc_get_stats(muAllocStats* stats) {
+					struct muu_inner_alloc_state* s = muu_inner_alloc_get_state();
+					muu_spin_lock(&s->lock);
+					*stats = s->stats;
+					muu_spin_unlock(&s->lock);
+				}
+
+				// @DOCLINE The function `muu_alloc_get_sites` retrieves the statistics of each call site, defined below:
+
+				/* @DOCBEGIN
+				```c
+				MUDEF inline size_m muu_alloc_get_sites(muAllocSite* sites, size_m len);
+				```
+				@DOCEND */
+
+				MUDEF inline size_m muu_alloc_get_sites(muAllocSite* sites, size_m len) {
+					struct muu_inner_alloc_state* s = muu_inner_alloc_get_state();
+					size_m n = 0;
+					muu_spin_lock(&s->lock);
+					for (size_m i = 0; i <= MU_ALLOC_MAX_SITES; ++i) {
+						if (s->sites[i].file) {
+							if (n < len) {
+								sites[n] = s->sites[i];
+							}
+							++n;
+						}
+					}
+					muu_spin_unlock(&s->lock);
+					return n;
+				}
+
+				// @DOCLINE Up to `len` call sites are copied into `sites` (in no particular order), and the total amount of call sites recorded is returned; `sites` can be 0 if `len` is 0.
+
+				// @DOCLINE These functions are only defined if instrumentation is enabled.
+
+			#endif /* MU_ALLOC_INSTRUMENT */
+
+			#ifndef MU_ALLOC
+				#define MU_ALLOC(size) mu_malloc(size)
+			#endif
+
+			#ifndef MU_REALLOC
+				#define MU_REALLOC(p, size) mu_realloc(p, size)
+			#endif
+
+			#ifndef MU_FREE
+				#define MU_FREE(p) mu_free(p)
+			#endif
+
+	// @DOCLINE # Byte reader
+
+		// @DOCLINE The `muByteReader` struct is a bounds-checked cursor over byte data, which wraps a buffer and reads values out of it in sequence. It can either wrap a fixed buffer holding all of the data, or a buffer that gets refilled by a user-defined callback whenever it runs dry, allowing large inputs to be parsed in fixed-size chunks instead of being loaded whole.
+
+		// @DOCLINE Every function that can fail takes in a pointer to a `muuResult` value as its last parameter, which is set to a non-success value upon failure via `MU_SET_RESULT`, and is otherwise left untouched; this means that many reads can be performed in a row, and the result only needs to be checked once afterwards.
+
+		// @DOCLINE ## Refill callback
+
+			// @DOCLINE The refill callback is defined as `muByteRefillFunc`, which is defined as:
+
+			/* @DOCBEGIN
+			```c
+			typedef size_m (*muByteRefillFunc)(void* user, muByte* data, size_m len);
+			```
+			@DOCEND */
+
+			// @DOCLINE The callback is meant to write up to `len` bytes to `data`, and return the amount of bytes written. Returning 0 indicates that there is no more data available.
+
+			typedef size_m (*muByteRefillFunc)(void* user, muByte* data, size_m len);
+
+		// @DOCLINE ## Reader struct
+
+			// @DOCLINE The struct `muByteReader` has the following members:
+
+			struct muByteReader {
+				// @DOCLINE * `muByte* data` - the buffer being read from.
+				muByte* data;
+				// @DOCLINE * `size_m pos` - the index of the next byte to be read within `data`.
+				size_m pos;
+				// @DOCLINE * `size_m len` - the amount of valid bytes currently in `data`.
+				size_m len;
+				// @DOCLINE * `size_m capacity` - the size of `data`, being the maximum amount of bytes that can be held at once.
+				size_m capacity;
+				// @DOCLINE * `size_m offset` - the total amount of bytes that were discarded from the front of `data` by refills; the total amount of bytes consumed so far is `offset + pos`.
+				size_m offset;
+				// @DOCLINE * `muByteRefillFunc refill` - the refill callback, or 0 if the reader wraps a fixed buffer.
+				muByteRefillFunc refill;
+				// @DOCLINE * `void* user` - the user data passed to `refill`.
+				void* user;
+			};
+			typedef struct muByteReader muByteReader;
+
+			// @DOCLINE These members can be read, but should generally not be modified directly.
+
+		// @DOCLINE ## Initialization
+
+			// @DOCLINE The function `muu_byte_reader_init` initializes a reader over a fixed buffer holding all of the data, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_byte_reader_init(muByteReader* r, muByte* data, size_m len);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_byte_reader_init(muByteReader* r, muByte* data, size_m len) {
+				r->data = data;
+				r->pos = 0;
+				r->len = len;
+				r->capacity = len;
+				r->offset = 0;
+				r->refill = 0;
+				r->user = 0;
+			}
+
+			// @DOCLINE The function `muu_byte_reader_init_refill` initializes a reader over a buffer that gets filled by a refill callback, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_byte_reader_init_refill(muByteReader* r, muByte* buffer, size_m capacity, muByteRefillFunc refill, void* user);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_byte_reader_init_refill(muByteReader* r, muByte* buffer, size_m capacity, muByteRefillFunc refill, void* user) {
+				r->data = buffer;
+				r->pos = 0;
+				r->len = 0;
+				r->capacity = capacity;
+				r->offset = 0;
+				r->refill = refill;
+				r->user = user;
+			}
+
+			// @DOCLINE The buffer is initially empty, and is filled on the first read. No single read can request more than `capacity` bytes at once, with the exception of `muu_byte_reader_read` and `muu_byte_reader_skip`.
+
+		// @DOCLINE ## Raw access
+
+			// Moves any leftover bytes to the front of the buffer and refills it
+			// until at least 'n' bytes are available
+			MUDEF inline muBool muu_inner_byte_reader_fill(muByteReader* r, size_m n) {
+				if (!r->refill || n > r->capacity) {
+					return MU_FALSE;
+				}
+
+				size_m left = r->len - r->pos;
+				if (r->pos != 0) {
+					mu_memmove(r->data, &r->data[r->pos], left);
+					r->offset += r->pos;
+					r->pos = 0;
+					r->len = left;
+				}
+
+				while (r->len < n) {
+					size_m got = r->refill(r->user, &r->data[r->len], r->capacity - r->len);
+					if (got == 0) {
+						return MU_FALSE;
+					}
+					r->len += got;
+				}
+				return MU_TRUE;
+			}
+
+			// @DOCLINE The function `muu_byte_reader_peek` returns a pointer to the next `n` bytes without consuming them, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muByte* muu_byte_reader_peek(muByteReader* r, size_m n, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline muByte* muu_byte_reader_peek(muByteReader* r, size_m n, muuResult* result) {
+				if (r->len - r->pos < n && !muu_inner_byte_reader_fill(r, n)) {
+					MU_SET_RESULT(result, MUU_OUT_OF_DATA)
+					return 0;
+				}
+				return &r->data[r->pos];
+			}
+
+			// @DOCLINE The function `muu_byte_reader_take` returns a pointer to the next `n` bytes and consumes them, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muByte* muu_byte_reader_take(muByteReader* r, size_m n, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline muByte* muu_byte_reader_take(muByteReader* r, size_m n, muuResult* result) {
+				muByte* b = muu_byte_reader_peek(r, n, result);
+				if (b) {
+					r->pos += n;
+				}
+				return b;
+			}
+
+			// @DOCLINE Both of these functions return 0 and set `result` to `MUU_OUT_OF_DATA` if `n` bytes couldn't be made available. The returned pointer is valid until the next call on the reader. This allows one bounds check to be performed for a batch of fields, which can then be read with the byte manipulation functions directly; for example:
+
+			/* @DOCBEGIN
+			```c
+			muByte* b = muu_byte_reader_take(&r, 10, &result);
+			if (b) {
+				uint32_m tag = MU_RBEU32(&b[0]);
+				uint32_m len = MU_RBEU32(&b[4]);
+				uint16_m flags = MU_RBEU16(&b[8]);
+			}
+			```
+			@DOCEND */
+
+			// @DOCLINE The function `muu_byte_reader_read` copies the next `n` bytes into `dst`, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_byte_reader_read(muByteReader* r, muByte* dst, size_m n, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_byte_reader_read(muByteReader* r, muByte* dst, size_m n, muuResult* result) {
+				while (n > 0) {
+					size_m left = r->len - r->pos;
+					if (left == 0) {
+						if (!muu_inner_byte_reader_fill(r, 1)) {
+							MU_SET_RESULT(result, MUU_OUT_OF_DATA)
+							return MU_FALSE;
+						}
+						left = r->len - r->pos;
+					}
+					if (left > n) {
+						left = n;
+					}
+					mu_memcpy(dst, &r->data[r->pos], left);
+					r->pos += left;
+					dst += left;
+					n -= left;
+				}
+				return MU_TRUE;
+			}
+
+			// @DOCLINE The function `muu_byte_reader_skip` consumes the next `n` bytes without reading them, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_byte_reader_skip(muByteReader* r, size_m n, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_byte_reader_skip(muByteReader* r, size_m n, muuResult* result) {
+				while (r->len - r->pos < n) {
+					n -= r->len - r->pos;
+					r->offset += r->len;
+					r->pos = 0;
+					r->len = 0;
+					if (!muu_inner_byte_reader_fill(r, 1)) {
+						MU_SET_RESULT(result, MUU_OUT_OF_DATA)
+						return MU_FALSE;
+					}
+				}
+				r->pos += n;
+				return MU_TRUE;
+			}
+
+			// @DOCLINE Both of these functions can handle amounts of bytes larger than `capacity`, and return `MU_FALSE` and set `result` to `MUU_OUT_OF_DATA` if the data ran out, in which case all of the remaining data has been consumed.
+
+		// @DOCLINE ## Typed reading
+
+			// @DOCLINE Typed reading functions exist for every byte manipulation reading function, which read a value and consume its bytes; they return 0 and set `result` to `MUU_OUT_OF_DATA` if there isn't enough data. They are named after the byte manipulation function they use, with the prefix `muu_byte_reader_`; for example, `muu_byte_reader_rbeu32` is defined as:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint32_m muu_byte_reader_rbeu32(muByteReader* r, muuResult* result);
+			```
+			@DOCEND */
+
+			// @DOCLINE The following typed reading functions are defined:
+
+			// @DOCLINE * `muu_byte_reader_rleu8` - reads an unsigned 8-bit integer of little-endian byte data, using `MU_RLEU8`.
+			MUDEF inline uint8_m muu_byte_reader_rleu8(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 1, result);
+				return b ? MU_RLEU8(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rles8` - reads a signed 8-bit integer of little-endian byte data, using `MU_RLES8`.
+			MUDEF inline int8_m muu_byte_reader_rles8(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 1, result);
+				return b ? MU_RLES8(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbeu8` - reads an unsigned 8-bit integer of big-endian byte data, using `MU_RBEU8`.
+			MUDEF inline uint8_m muu_byte_reader_rbeu8(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 1, result);
+				return b ? MU_RBEU8(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbes8` - reads a signed 8-bit integer of big-endian byte data, using `MU_RBES8`.
+			MUDEF inline int8_m muu_byte_reader_rbes8(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 1, result);
+				return b ? MU_RBES8(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rleu16` - reads an unsigned 16-bit integer of little-endian byte data, using `MU_RLEU16`.
+			MUDEF inline uint16_m muu_byte_reader_rleu16(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 2, result);
+				return b ? MU_RLEU16(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rles16` - reads a signed 16-bit integer of little-endian byte data, using `MU_RLES16`.
+			MUDEF inline int16_m muu_byte_reader_rles16(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 2, result);
+				return b ? MU_RLES16(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbeu16` - reads an unsigned 16-bit integer of big-endian byte data, using `MU_RBEU16`.
+			MUDEF inline uint16_m muu_byte_reader_rbeu16(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 2, result);
+				return b ? MU_RBEU16(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbes16` - reads a signed 16-bit integer of big-endian byte data, using `MU_RBES16`.
+			MUDEF inline int16_m muu_byte_reader_rbes16(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 2, result);
+				return b ? MU_RBES16(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rleu24` - reads an unsigned 24-bit integer of little-endian byte data, using `MU_RLEU24`.
+			MUDEF inline uint32_m muu_byte_reader_rleu24(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 3, result);
+				return b ? MU_RLEU24(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rles24` - reads a signed 24-bit integer of little-endian byte data, using `MU_RLES24`.
+			MUDEF inline int32_m muu_byte_reader_rles24(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 3, result);
+				return b ? MU_RLES24(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbeu24` - reads an unsigned 24-bit integer of big-endian byte data, using `MU_RBEU24`.
+			MUDEF inline uint32_m muu_byte_reader_rbeu24(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 3, result);
+				return b ? MU_RBEU24(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbes24` - reads a signed 24-bit integer of big-endian byte data, using `MU_RBES24`.
+			MUDEF inline int32_m muu_byte_reader_rbes24(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 3, result);
+				return b ? MU_RBES24(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rleu32` - reads an unsigned 32-bit integer of little-endian byte data, using `MU_RLEU32`.
+			MUDEF inline uint32_m muu_byte_reader_rleu32(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 4, result);
+				return b ? MU_RLEU32(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rles32` - reads a signed 32-bit integer of little-endian byte data, using `MU_RLES32`.
+			MUDEF inline int32_m muu_byte_reader_rles32(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 4, result);
+				return b ? MU_RLES32(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbeu32` - reads an unsigned 32-bit integer of big-endian byte data, using `MU_RBEU32`.
+			MUDEF inline uint32_m muu_byte_reader_rbeu32(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 4, result);
+				return b ? MU_RBEU32(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbes32` - reads a signed 32-bit integer of big-endian byte data, using `MU_RBES32`.
+			MUDEF inline int32_m muu_byte_reader_rbes32(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 4, result);
+				return b ? MU_RBES32(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rleu64` - reads an unsigned 64-bit integer of little-endian byte data, using `MU_RLEU64`.
+			MUDEF inline uint64_m muu_byte_reader_rleu64(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 8, result);
+				return b ? MU_RLEU64(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rles64` - reads a signed 64-bit integer of little-endian byte data, using `MU_RLES64`.
+			MUDEF inline int64_m muu_byte_reader_rles64(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 8, result);
+				return b ? MU_RLES64(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbeu64` - reads an unsigned 64-bit integer of big-endian byte data, using `MU_RBEU64`.
+			MUDEF inline uint64_m muu_byte_reader_rbeu64(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 8, result);
+				return b ? MU_RBEU64(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbes64` - reads a signed 64-bit integer of big-endian byte data, using `MU_RBES64`.
+			MUDEF inline int64_m muu_byte_reader_rbes64(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 8, result);
+				return b ? MU_RBES64(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rlef32` - reads a float of little-endian byte data, using `MU_RLEF32`.
+			MUDEF inline float muu_byte_reader_rlef32(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 4, result);
+				return b ? MU_RLEF32(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbef32` - reads a float of big-endian byte data, using `MU_RBEF32`.
+			MUDEF inline float muu_byte_reader_rbef32(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 4, result);
+				return b ? MU_RBEF32(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rlef64` - reads a double of little-endian byte data, using `MU_RLEF64`.
+			MUDEF inline double muu_byte_reader_rlef64(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 8, result);
+				return b ? MU_RLEF64(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbef64` - reads a double of big-endian byte data, using `MU_RBEF64`.
+			MUDEF inline double muu_byte_reader_rbef64(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 8, result);
+				return b ? MU_RBEF64(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rlef16` - reads an f16 value of little-endian byte data as a `float`, using `MU_RLEF16`.
+			MUDEF inline float muu_byte_reader_rlef16(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 2, result);
+				return b ? MU_RLEF16(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbef16` - reads an f16 value of big-endian byte data as a `float`, using `MU_RBEF16`.
+			MUDEF inline float muu_byte_reader_rbef16(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 2, result);
+				return b ? MU_RBEF16(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rlebf16` - reads a bf16 value of little-endian byte data as a `float`, using `MU_RLEBF16`.
+			MUDEF inline float muu_byte_reader_rlebf16(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 2, result);
+				return b ? MU_RLEBF16(b) : 0;
+			}
+
+			// @DOCLINE * `muu_byte_reader_rbebf16` - reads a bf16 value of big-endian byte data as a `float`, using `MU_RBEBF16`.
+			MUDEF inline float muu_byte_reader_rbebf16(muByteReader* r, muuResult* result) {
+				muByte* b = muu_byte_reader_take(r, 2, result);
+				return b ? MU_RBEBF16(b) : 0;
+			}
+		// @DOCLINE ## Variable-length reading
+
+			// Reads a LEB128 integer's bytes into 'tmp' one at a time, for when the
+			// buffer doesn't hold MU_LEB128_MAX bytes at once
+			MUDEF inline size_m muu_inner_byte_reader_leb128(muByteReader* r, muByte* tmp, muuResult* result) {
+				for (size_m i = 0; i < MU_LEB128_MAX; ++i) {
+					muByte* b = muu_byte_reader_take(r, 1, result);
+					if (!b) {
+						return 0;
+					}
+					tmp[i] = b[0];
+					if (!(b[0] & 0x80)) {
+						return i+1;
+					}
+				}
+				MU_SET_RESULT(result, MUU_INVALID_DATA)
+				return 0;
+			}
+
+			// @DOCLINE The functions `muu_byte_reader_rleb128u` and `muu_byte_reader_rleb128s` read an unsigned and signed LEB128 integer respectively, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint64_m muu_byte_reader_rleb128u(muByteReader* r, muuResult* result);
+			MUDEF inline int64_m muu_byte_reader_rleb128s(muByteReader* r, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline uint64_m muu_byte_reader_rleb128u(muByteReader* r, muuResult* result) {
+				uint64_m n = 0;
+				size_m left = r->len - r->pos;
+				if (left >= MU_LEB128_MAX) {
+					size_m used = MU_RLEB128U(&r->data[r->pos], left, &n);
+					if (!used) {
+						MU_SET_RESULT(result, MUU_INVALID_DATA)
+						return 0;
+					}
+					r->pos += used;
+					return n;
+				}
+
+				muByte tmp[MU_LEB128_MAX];
+				size_m used = muu_inner_byte_reader_leb128(r, tmp, result);
+				if (used && !MU_RLEB128U(tmp, used, &n)) {
+					MU_SET_RESULT(result, MUU_INVALID_DATA)
+					return 0;
+				}
+				return n;
+			}
+
+			MUDEF inline int64_m muu_byte_reader_rleb128s(muByteReader* r, muuResult* result) {
+				int64_m n = 0;
+				size_m left = r->len - r->pos;
+				if (left >= MU_LEB128_MAX) {
+					size_m used = MU_RLEB128S(&r->data[r->pos], left, &n);
+					if (!used) {
+						MU_SET_RESULT(result, MUU_INVALID_DATA)
+						return 0;
+					}
+					r->pos += used;
+					return n;
+				}
+
+				muByte tmp[MU_LEB128_MAX];
+				size_m used = muu_inner_byte_reader_leb128(r, tmp, result);
+				if (used && !MU_RLEB128S(tmp, used, &n)) {
+					MU_SET_RESULT(result, MUU_INVALID_DATA)
+					return 0;
+				}
+				return n;
+			}
+
+			// @DOCLINE Both functions return 0 and set `result` to `MUU_OUT_OF_DATA` if the data ran out, or `MUU_INVALID_DATA` if the encoding was invalid (longer than `MU_LEB128_MAX` bytes or overflowing 64 bits).
+
+	// @DOCLINE # Byte writer
+
+		// @DOCLINE The `muByteWriter` struct is the writing counterpart of `muByteReader`, which writes values in sequence into a buffer. It can either wrap a fixed buffer, or a buffer that gets flushed by a user-defined callback whenever it fills up, allowing large outputs to be written in fixed-size chunks. It follows the same error-reporting conventions as `muByteReader`.
+
+		// @DOCLINE ## Flush callback
+
+			// @DOCLINE The flush callback is defined as `muByteFlushFunc`, which is defined as:
+
+			/* @DOCBEGIN
+			```c
+			typedef muBool (*muByteFlushFunc)(void* user, muByte* data, size_m len);
+			```
+			@DOCEND */
+
+			// @DOCLINE The callback is meant to consume all `len` bytes of `data`, and return whether or not it succeeded.
+
+			typedef muBool (*muByteFlushFunc)(void* user, muByte* data, size_m len);
+
+		// @DOCLINE ## Writer struct
+
+			// @DOCLINE The struct `muByteWriter` has the following members:
+
+			struct muByteWriter {
+				// @DOCLINE * `muByte* data` - the buffer being written to.
+				muByte* data;
+				// @DOCLINE * `size_m pos` - the index of the next byte to be written within `data`.
+				size_m pos;
+				// @DOCLINE * `size_m capacity` - the size of `data`.
+				size_m capacity;
+				// @DOCLINE * `size_m offset` - the total amount of bytes that were flushed so far; the total amount of bytes written so far is `offset + pos`.
+				size_m offset;
+				// @DOCLINE * `muByteFlushFunc flush` - the flush callback, or 0 if the writer wraps a fixed buffer.
+				muByteFlushFunc flush;
+				// @DOCLINE * `void* user` - the user data passed to `flush`.
+				void* user;
+			};
+			typedef struct muByteWriter muByteWriter;
+
+		// @DOCLINE ## Initialization
+
+			// @DOCLINE The function `muu_byte_writer_init` initializes a writer over a fixed buffer, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_byte_writer_init(muByteWriter* w, muByte* data, size_m capacity);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_byte_writer_init(muByteWriter* w, muByte* data, size_m capacity) {
+				w->data = data;
+				w->pos = 0;
+				w->capacity = capacity;
+				w->offset = 0;
+				w->flush = 0;
+				w->user = 0;
+			}
+
+			// @DOCLINE The function `muu_byte_writer_init_flush` initializes a writer over a buffer that gets emptied by a flush callback, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_byte_writer_init_flush(muByteWriter* w, muByte* buffer, size_m capacity, muByteFlushFunc flush, void* user);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_byte_writer_init_flush(muByteWriter* w, muByte* buffer, size_m capacity, muByteFlushFunc flush, void* user) {
+				w->data = buffer;
+				w->pos = 0;
+				w->capacity = capacity;
+				w->offset = 0;
+				w->flush = flush;
+				w->user = user;
+			}
+
+		// @DOCLINE ## Raw access
+
+			// @DOCLINE The function `muu_byte_writer_flush` passes all bytes currently written in the buffer to the flush callback and empties the buffer, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_byte_writer_flush(muByteWriter* w, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_byte_writer_flush(muByteWriter* w, muuResult* result) {
+				if (w->pos == 0 || !w->flush) {
+					return MU_TRUE;
+				}
+				if (!w->flush(w->user, w->data, w->pos)) {
+					MU_SET_RESULT(result, MUU_FLUSH_FAILED)
+					return MU_FALSE;
+				}
+				w->offset += w->pos;
+				w->pos = 0;
+				return MU_TRUE;
+			}
+
+			// @DOCLINE This function does nothing if the writer wraps a fixed buffer, and sets `result` to `MUU_FLUSH_FAILED` if the flush callback failed. It needs to be called once writing is finished in order for the last bytes to be flushed.
+
+			// @DOCLINE The function `muu_byte_writer_reserve` returns a pointer to the next `n` bytes to be written and consumes them, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muByte* muu_byte_writer_reserve(muByteWriter* w, size_m n, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline muByte* muu_byte_writer_reserve(muByteWriter* w, size_m n, muuResult* result) {
+				if (w->capacity - w->pos < n) {
+					if (!w->flush || n > w->capacity) {
+						MU_SET_RESULT(result, MUU_OUT_OF_SPACE)
+						return 0;
+					}
+					if (!muu_byte_writer_flush(w, result)) {
+						return 0;
+					}
+				}
+				muByte* b = &w->data[w->pos];
+				w->pos += n;
+				return b;
+			}
+
+			// @DOCLINE This function returns 0 and sets `result` to `MUU_OUT_OF_SPACE` if `n` bytes couldn't be made available, and `MUU_FLUSH_FAILED` if flushing failed. It is the writing counterpart of `muu_byte_reader_take`, allowing one bounds check to be performed for a batch of fields. The returned pointer is valid until the next call on the writer.
+
+			// @DOCLINE The function `muu_byte_writer_write` copies `n` bytes from `src` into the writer, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_byte_writer_write(muByteWriter* w, muByte* src, size_m n, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_byte_writer_write(muByteWriter* w, muByte* src, size_m n, muuResult* result) {
+				while (n > 0) {
+					size_m space = w->capacity - w->pos;
+					if (space == 0) {
+						if (!w->flush) {
+							MU_SET_RESULT(result, MUU_OUT_OF_SPACE)
+							return MU_FALSE;
+						}
+						if (!muu_byte_writer_flush(w, result)) {
+							return MU_FALSE;
+						}
+						space = w->capacity;
+					}
+					if (space > n) {
+						space = n;
+					}
+					mu_memcpy(&w->data[w->pos], src, space);
+					w->pos += space;
+					src += space;
+					n -= space;
+				}
+				return MU_TRUE;
+			}
+
+			// @DOCLINE This function can handle amounts of bytes larger than `capacity`.
+
+		// @DOCLINE ## Typed writing
+
+			// @DOCLINE Typed writing functions exist for every byte manipulation writing function, which write a value and consume its bytes, setting `result` to a non-success value if there isn't enough space. They are named after the byte manipulation function they use, with the prefix `muu_byte_writer_`; for example, `muu_byte_writer_wbeu32` is defined as:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_byte_writer_wbeu32(muByteWriter* w, uint32_m n, muuResult* result);
+			```
+			@DOCEND */
+
+			// @DOCLINE The following typed writing functions are defined:
+
+			// @DOCLINE * `muu_byte_writer_wleu8` - writes an unsigned 8-bit integer as little-endian byte data, using `MU_WLEU8`.
+			MUDEF inline void muu_byte_writer_wleu8(muByteWriter* w, uint8_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 1, result);
+				if (b) {
+					MU_WLEU8(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wles8` - writes a signed 8-bit integer as little-endian byte data, using `MU_WLES8`.
+			MUDEF inline void muu_byte_writer_wles8(muByteWriter* w, int8_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 1, result);
+				if (b) {
+					MU_WLES8(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbeu8` - writes an unsigned 8-bit integer as big-endian byte data, using `MU_WBEU8`.
+			MUDEF inline void muu_byte_writer_wbeu8(muByteWriter* w, uint8_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 1, result);
+				if (b) {
+					MU_WBEU8(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbes8` - writes a signed 8-bit integer as big-endian byte data, using `MU_WBES8`.
+			MUDEF inline void muu_byte_writer_wbes8(muByteWriter* w, int8_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 1, result);
+				if (b) {
+					MU_WBES8(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wleu16` - writes an unsigned 16-bit integer as little-endian byte data, using `MU_WLEU16`.
+			MUDEF inline void muu_byte_writer_wleu16(muByteWriter* w, uint16_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 2, result);
+				if (b) {
+					MU_WLEU16(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wles16` - writes a signed 16-bit integer as little-endian byte data, using `MU_WLES16`.
+			MUDEF inline void muu_byte_writer_wles16(muByteWriter* w, int16_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 2, result);
+				if (b) {
+					MU_WLES16(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbeu16` - writes an unsigned 16-bit integer as big-endian byte data, using `MU_WBEU16`.
+			MUDEF inline void muu_byte_writer_wbeu16(muByteWriter* w, uint16_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 2, result);
+				if (b) {
+					MU_WBEU16(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbes16` - writes a signed 16-bit integer as big-endian byte data, using `MU_WBES16`.
+			MUDEF inline void muu_byte_writer_wbes16(muByteWriter* w, int16_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 2, result);
+				if (b) {
+					MU_WBES16(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wleu24` - writes an unsigned 24-bit integer as little-endian byte data, using `MU_WLEU24`.
+			MUDEF inline void muu_byte_writer_wleu24(muByteWriter* w, uint32_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 3, result);
+				if (b) {
+					MU_WLEU24(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wles24` - writes a signed 24-bit integer as little-endian byte data, using `MU_WLES24`.
+			MUDEF inline void muu_byte_writer_wles24(muByteWriter* w, int32_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 3, result);
+				if (b) {
+					MU_WLES24(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbeu24` - writes an unsigned 24-bit integer as big-endian byte data, using `MU_WBEU24`.
+			MUDEF inline void muu_byte_writer_wbeu24(muByteWriter* w, uint32_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 3, result);
+				if (b) {
+					MU_WBEU24(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbes24` - writes a signed 24-bit integer as big-endian byte data, using `MU_WBES24`.
+			MUDEF inline void muu_byte_writer_wbes24(muByteWriter* w, int32_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 3, result);
+				if (b) {
+					MU_WBES24(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wleu32` - writes an unsigned 32-bit integer as little-endian byte data, using `MU_WLEU32`.
+			MUDEF inline void muu_byte_writer_wleu32(muByteWriter* w, uint32_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 4, result);
+				if (b) {
+					MU_WLEU32(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wles32` - writes a signed 32-bit integer as little-endian byte data, using `MU_WLES32`.
+			MUDEF inline void muu_byte_writer_wles32(muByteWriter* w, int32_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 4, result);
+				if (b) {
+					MU_WLES32(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbeu32` - writes an unsigned 32-bit integer as big-endian byte data, using `MU_WBEU32`.
+			MUDEF inline void muu_byte_writer_wbeu32(muByteWriter* w, uint32_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 4, result);
+				if (b) {
+					MU_WBEU32(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbes32` - writes a signed 32-bit integer as big-endian byte data, using `MU_WBES32`.
+			MUDEF inline void muu_byte_writer_wbes32(muByteWriter* w, int32_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 4, result);
+				if (b) {
+					MU_WBES32(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wleu64` - writes an unsigned 64-bit integer as little-endian byte data, using `MU_WLEU64`.
+			MUDEF inline void muu_byte_writer_wleu64(muByteWriter* w, uint64_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 8, result);
+				if (b) {
+					MU_WLEU64(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wles64` - writes a signed 64-bit integer as little-endian byte data, using `MU_WLES64`.
+			MUDEF inline void muu_byte_writer_wles64(muByteWriter* w, int64_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 8, result);
+				if (b) {
+					MU_WLES64(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbeu64` - writes an unsigned 64-bit integer as big-endian byte data, using `MU_WBEU64`.
+			MUDEF inline void muu_byte_writer_wbeu64(muByteWriter* w, uint64_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 8, result);
+				if (b) {
+					MU_WBEU64(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbes64` - writes a signed 64-bit integer as big-endian byte data, using `MU_WBES64`.
+			MUDEF inline void muu_byte_writer_wbes64(muByteWriter* w, int64_m n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 8, result);
+				if (b) {
+					MU_WBES64(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wlef32` - writes a float as little-endian byte data, using `MU_WLEF32`.
+			MUDEF inline void muu_byte_writer_wlef32(muByteWriter* w, float n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 4, result);
+				if (b) {
+					MU_WLEF32(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbef32` - writes a float as big-endian byte data, using `MU_WBEF32`.
+			MUDEF inline void muu_byte_writer_wbef32(muByteWriter* w, float n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 4, result);
+				if (b) {
+					MU_WBEF32(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wlef64` - writes a double as little-endian byte data, using `MU_WLEF64`.
+			MUDEF inline void muu_byte_writer_wlef64(muByteWriter* w, double n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 8, result);
+				if (b) {
+					MU_WLEF64(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbef64` - writes a double as big-endian byte data, using `MU_WBEF64`.
+			MUDEF inline void muu_byte_writer_wbef64(muByteWriter* w, double n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 8, result);
+				if (b) {
+					MU_WBEF64(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wlef16` - writes a `float` as little-endian f16 byte data, using `MU_WLEF16`.
+			MUDEF inline void muu_byte_writer_wlef16(muByteWriter* w, float n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 2, result);
+				if (b) {
+					MU_WLEF16(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbef16` - writes a `float` as big-endian f16 byte data, using `MU_WBEF16`.
+			MUDEF inline void muu_byte_writer_wbef16(muByteWriter* w, float n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 2, result);
+				if (b) {
+					MU_WBEF16(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wlebf16` - writes a `float` as little-endian bf16 byte data, using `MU_WLEBF16`.
+			MUDEF inline void muu_byte_writer_wlebf16(muByteWriter* w, float n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 2, result);
+				if (b) {
+					MU_WLEBF16(b, n);
+				}
+			}
+
+			// @DOCLINE * `muu_byte_writer_wbebf16` - writes a `float` as big-endian bf16 byte data, using `MU_WBEBF16`.
+			MUDEF inline void muu_byte_writer_wbebf16(muByteWriter* w, float n, muuResult* result) {
+				muByte* b = muu_byte_writer_reserve(w, 2, result);
+				if (b) {
+					MU_WBEBF16(b, n);
+				}
+			}
+
+		// @DOCLINE ## Variable-length writing
+
+			// @DOCLINE The functions `muu_byte_writer_wleb128u` and `muu_byte_writer_wleb128s` write an unsigned and signed LEB128 integer respectively, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_byte_writer_wleb128u(muByteWriter* w, uint64_m n, muuResult* result);
+			MUDEF inline void muu_byte_writer_wleb128s(muByteWriter* w, int64_m n, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_byte_writer_wleb128u(muByteWriter* w, uint64_m n, muuResult* result) {
+				muByte tmp[MU_LEB128_MAX];
+				muu_byte_writer_write(w, tmp, MU_WLEB128U(tmp, n), result);
+			}
+
+			MUDEF inline void muu_byte_writer_wleb128s(muByteWriter* w, int64_m n, muuResult* result) {
+				muByte tmp[MU_LEB128_MAX];
+				muu_byte_writer_write(w, tmp, MU_WLEB128S(tmp, n), result);
+			}
+
+	// @DOCLINE # Bit reader
+
+		// @DOCLINE The `muBitReader` struct reads bit-level data (such as Huffman-coded or otherwise packed data) out of a fixed buffer of bytes. It keeps a 64-bit buffer of upcoming bits, which is refilled with a single unaligned 64-bit load (see `MU_RLEU64` and `MU_RBEU64`), without any branches other than a check for being near the end of the data. After a refill, at least 57 bits can be peeked and consumed.
+
+		// @DOCLINE Bits can be read in two orders, which have separate sets of functions: LSB-first (`lsb`), in which bits are read starting from the least significant bit of each byte, as used by formats such as deflate, and MSB-first (`msb`), in which bits are read starting from the most significant bit of each byte, as used by formats such as JPEG. The two orders should not be mixed on one reader without a call to `muu_bit_reader_align` in-between.
+
+		// @DOCLINE Reading past the end of the data doesn't fail immediately; instead, the missing bits are read as zeros, and `muu_bit_reader_overrun` can be used to check if this has happened once a batch of reads is done, which keeps checks out of the decoding loop.
+
+		// @DOCLINE ## Reader struct
+
+			// @DOCLINE The struct `muBitReader` has the following members:
+
+			struct muBitReader {
+				// @DOCLINE * `muByte* data` - the data being read from.
+				muByte* data;
+				// @DOCLINE * `size_m len` - the amount of bytes in `data`.
+				size_m len;
+				// @DOCLINE * `size_m bitpos` - the index of the next bit to be consumed, counting from the start of `data`.
+				size_m bitpos;
+				// @DOCLINE * `uint64_m bits` - the buffer of upcoming bits.
+				uint64_m bits;
+				// @DOCLINE * `uint32_m count` - the amount of valid bits in `bits`.
+				uint32_m count;
+			};
+			typedef struct muBitReader muBitReader;
+
+		// @DOCLINE ## Reader initialization
+
+			// @DOCLINE The function `muu_bit_reader_init` initializes a bit reader over the given data, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_bit_reader_init(muBitReader* r, muByte* data, size_m len);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_bit_reader_init(muBitReader* r, muByte* data, size_m len) {
+				r->data = data;
+				r->len = len;
+				r->bitpos = 0;
+				r->bits = 0;
+				r->count = 0;
+			}
+
+			// @DOCLINE The bit buffer starts out empty, so the reader needs to be refilled before the first peek.
+
+		// @DOCLINE ## Reading bits
+
+			// Loads the 8 bytes starting at the given byte index, reading bytes past
+			// the end of the data as zeros
+			MUDEF inline void muu_inner_bit_reader_load(muBitReader* r, size_m i, muByte* b) {
+				for (size_m j = 0; j < 8; ++j) {
+					b[j] = (i+j < r->len) ? r->data[i+j] : 0;
+				}
+			}
+
+			// @DOCLINE The following functions exist for reading bits:
+
+			// @DOCLINE * `muu_bit_reader_lsb_refill` / `muu_bit_reader_msb_refill` - refills the bit buffer, after which at least 57 bits can be peeked and consumed; defined as `MUDEF inline void muu_bit_reader_lsb_refill(muBitReader* r)`.
+			MUDEF inline void muu_bit_reader_lsb_refill(muBitReader* r) {
+				size_m i = r->bitpos >> 3;
+				uint64_m v;
+				if (i + 8 <= r->len) {
+					v = MU_RLEU64(&r->data[i]);
+				} else {
+					muByte b[8];
+					muu_inner_bit_reader_load(r, i, b);
+					v = MU_RLEU64(b);
+				}
+				r->bits = v >> (r->bitpos & 7);
+				r->count = 64 - (uint32_m)(r->bitpos & 7);
+			}
+
+			MUDEF inline void muu_bit_reader_msb_refill(muBitReader* r) {
+				size_m i = r->bitpos >> 3;
+				uint64_m v;
+				if (i + 8 <= r->len) {
+					v = MU_RBEU64(&r->data[i]);
+				} else {
+					muByte b[8];
+					muu_inner_bit_reader_load(r, i, b);
+					v = MU_RBEU64(b);
+				}
+				r->bits = v << (r->bitpos & 7);
+				r->count = 64 - (uint32_m)(r->bitpos & 7);
+			}
+
+			// @DOCLINE * `muu_bit_reader_lsb_peek` / `muu_bit_reader_msb_peek` - returns the next `n` bits without consuming them, with the first bit in the stream being the least or most significant bit of the result respectively; defined as `MUDEF inline uint64_m muu_bit_reader_lsb_peek(muBitReader* r, uint32_m n)`. `n` must be at most `count`.
+			MUDEF inline uint64_m muu_bit_reader_lsb_peek(muBitReader* r, uint32_m n) {
+				return r->bits & ((((uint64_m)1) << n) - 1);
+			}
+
+			MUDEF inline uint64_m muu_bit_reader_msb_peek(muBitReader* r, uint32_m n) {
+				// Shifted in two steps so that n = 0 doesn't shift by 64
+				return (r->bits >> 1) >> (63 - n);
+			}
+
+			// @DOCLINE * `muu_bit_reader_lsb_consume` / `muu_bit_reader_msb_consume` - consumes the next `n` bits; defined as `MUDEF inline void muu_bit_reader_lsb_consume(muBitReader* r, uint32_m n)`. `n` must be at most `count`.
+			MUDEF inline void muu_bit_reader_lsb_consume(muBitReader* r, uint32_m n) {
+				r->bits >>= n;
+				r->count -= n;
+				r->bitpos += n;
+			}
+
+			MUDEF inline void muu_bit_reader_msb_consume(muBitReader* r, uint32_m n) {
+				r->bits <<= n;
+				r->count -= n;
+				r->bitpos += n;
+			}
+
+			// @DOCLINE * `muu_bit_reader_lsb_read` / `muu_bit_reader_msb_read` - refills the bit buffer if fewer than `n` bits are in it, and then peeks and consumes the next `n` bits; defined as `MUDEF inline uint64_m muu_bit_reader_lsb_read(muBitReader* r, uint32_m n)`. `n` must be at most 57.
+			MUDEF inline uint64_m muu_bit_reader_lsb_read(muBitReader* r, uint32_m n) {
+				if (r->count < n) {
+					muu_bit_reader_lsb_refill(r);
+				}
+				uint64_m v = muu_bit_reader_lsb_peek(r, n);
+				muu_bit_reader_lsb_consume(r, n);
+				return v;
+			}
+
+			MUDEF inline uint64_m muu_bit_reader_msb_read(muBitReader* r, uint32_m n) {
+				if (r->count < n) {
+					muu_bit_reader_msb_refill(r);
+				}
+				uint64_m v = muu_bit_reader_msb_peek(r, n);
+				muu_bit_reader_msb_consume(r, n);
+				return v;
+			}
+
+			// @DOCLINE The usual decoding loop refills once, and then peeks and consumes several codes whose total length is known to be at most 57 bits.
+
+		// @DOCLINE ## Reader position
+
+			// @DOCLINE The function `muu_bit_reader_align` skips to the start of the next byte, if not at the start of one already, and empties the bit buffer, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_bit_reader_align(muBitReader* r);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_bit_reader_align(muBitReader* r) {
+				r->bitpos = (r->bitpos + 7) & ~(size_m)7;
+				r->bits = 0;
+				r->count = 0;
+			}
+
+			// @DOCLINE The byte-aligned data following the bits can then be accessed at `&data[bitpos/8]`.
+
+			// @DOCLINE The function `muu_bit_reader_overrun` returns whether or not more bits have been consumed than exist in the data, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_bit_reader_overrun(muBitReader* r);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_bit_reader_overrun(muBitReader* r) {
+				return (r->bitpos >> 3) > r->len || ((r->bitpos >> 3) == r->len && (r->bitpos & 7) != 0);
+			}
+
+	// @DOCLINE # Bit writer
+
+		// @DOCLINE The `muBitWriter` struct is the writing counterpart of `muBitReader`, which writes bit-level data into a fixed buffer of bytes. It accumulates bits in a 64-bit buffer, which is flushed with a single unaligned 64-bit store when there is enough space left in the buffer. It supports the same two bit orders as `muBitReader`, which also should not be mixed.
+
+		// @DOCLINE ## Writer struct
+
+			// @DOCLINE The struct `muBitWriter` has the following members:
+
+			struct muBitWriter {
+				// @DOCLINE * `muByte* data` - the buffer being written to.
+				muByte* data;
+				// @DOCLINE * `size_m capacity` - the size of `data`.
+				size_m capacity;
+				// @DOCLINE * `size_m pos` - the index of the next byte to be flushed within `data`.
+				size_m pos;
+				// @DOCLINE * `uint64_m bits` - the buffer of bits not flushed yet.
+				uint64_m bits;
+				// @DOCLINE * `uint32_m count` - the amount of valid bits in `bits`.
+				uint32_m count;
+				// @DOCLINE * `muBool overflow` - whether or not more bytes were written than fit in `data`; the bytes that didn't fit are dropped.
+				muBool overflow;
+			};
+			typedef struct muBitWriter muBitWriter;
+
+		// @DOCLINE ## Writer initialization
+
+			// @DOCLINE The function `muu_bit_writer_init` initializes a bit writer over the given buffer, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_bit_writer_init(muBitWriter* w, muByte* data, size_m capacity);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_bit_writer_init(muBitWriter* w, muByte* data, size_m capacity) {
+				w->data = data;
+				w->capacity = capacity;
+				w->pos = 0;
+				w->bits = 0;
+				w->count = 0;
+				w->overflow = MU_FALSE;
+			}
+
+		// @DOCLINE ## Writing bits
+
+			// Stores the given 8 bytes, dropping the ones that don't fit
+			MUDEF inline void muu_inner_bit_writer_store(muBitWriter* w, muByte* b, size_m n) {
+				for (size_m j = 0; j < n; ++j) {
+					if (w->pos + j < w->capacity) {
+						w->data[w->pos + j] = b[j];
+					} else {
+						w->overflow = MU_TRUE;
+					}
+				}
+			}
+
+			// @DOCLINE The following functions exist for writing bits:
+
+			// @DOCLINE * `muu_bit_writer_lsb_flush` / `muu_bit_writer_msb_flush` - flushes all whole bytes in the bit buffer to the data; defined as `MUDEF inline void muu_bit_writer_lsb_flush(muBitWriter* w)`. This is called automatically when needed.
+			MUDEF inline void muu_bit_writer_lsb_flush(muBitWriter* w) {
+				uint32_m bytes = w->count >> 3;
+				if (w->pos + 8 <= w->capacity) {
+					MU_WLEU64(&w->data[w->pos], w->bits);
+				} else {
+					muByte b[8];
+					MU_WLEU64(b, w->bits);
+					muu_inner_bit_writer_store(w, b, bytes);
+				}
+				w->pos += bytes;
+				w->bits = (bytes == 8) ? 0 : (w->bits >> (bytes*8));
+				w->count &= 7;
+			}
+
+			MUDEF inline void muu_bit_writer_msb_flush(muBitWriter* w) {
+				uint32_m bytes = w->count >> 3;
+				if (w->pos + 8 <= w->capacity) {
+					MU_WBEU64(&w->data[w->pos], w->bits);
+				} else {
+					muByte b[8];
+					MU_WBEU64(b, w->bits);
+					muu_inner_bit_writer_store(w, b, bytes);
+				}
+				w->pos += bytes;
+				w->bits = (bytes == 8) ? 0 : (w->bits << (bytes*8));
+				w->count &= 7;
+			}
+
+			// @DOCLINE * `muu_bit_writer_lsb_write` / `muu_bit_writer_msb_write` - writes the lower `n` bits of `v`, with the least or most significant of them respectively being the first bit in the stream; defined as `MUDEF inline void muu_bit_writer_lsb_write(muBitWriter* w, uint64_m v, uint32_m n)`. `n` must be at most 57.
+			MUDEF inline void muu_bit_writer_lsb_write(muBitWriter* w, uint64_m v, uint32_m n) {
+				if (w->count + n > 64) {
+					muu_bit_writer_lsb_flush(w);
+				}
+				if (n != 0) {
+					w->bits |= (v & ((((uint64_m)1) << n) - 1)) << w->count;
+				}
+				w->count += n;
+			}
+
+			MUDEF inline void muu_bit_writer_msb_write(muBitWriter* w, uint64_m v, uint32_m n) {
+				if (w->count + n > 64) {
+					muu_bit_writer_msb_flush(w);
+				}
+				if (n != 0) {
+					w->bits |= (v & ((((uint64_m)1) << n) - 1)) << (64 - w->count - n);
+				}
+				w->count += n;
+			}
+
+			// @DOCLINE * `muu_bit_writer_lsb_finish` / `muu_bit_writer_msb_finish` - flushes all remaining bits, padding the last byte with zero bits, and returns the total amount of bytes written; defined as `MUDEF inline size_m muu_bit_writer_lsb_finish(muBitWriter* w, muuResult* result)`. `result` is set to `MUU_OUT_OF_SPACE` if the data didn't fit.
+			MUDEF inline size_m muu_bit_writer_lsb_finish(muBitWriter* w, muuResult* result) {
+				w->count = (w->count + 7) & ~(uint32_m)7;
+				muu_bit_writer_lsb_flush(w);
+				if (w->overflow) {
+					MU_SET_RESULT(result, MUU_OUT_OF_SPACE)
+				}
+				return w->pos;
+			}
+
+			MUDEF inline size_m muu_bit_writer_msb_finish(muBitWriter* w, muuResult* result) {
+				w->count = (w->count + 7) & ~(uint32_m)7;
+				muu_bit_writer_msb_flush(w);
+				if (w->overflow) {
+					MU_SET_RESULT(result, MUU_OUT_OF_SPACE)
+				}
+				return w->pos;
+			}
+
+			// @DOCLINE Finishing also byte-aligns the writer, so byte-aligned data can be written at `&data[pos]` afterwards, and more bits can be written after that if `pos` is adjusted accordingly.
+
+	// @DOCLINE # Records
+
+		// @DOCLINE muUtility defines a way to describe the layout of a binary record (such as a file header or a table entry) once, and generate a native struct along with functions that convert whole arrays of such records between byte data and the struct. The generated code reads and writes every field at a constant offset in one loop over the records, which is much faster (and shorter) than a hand-written sequence of byte manipulation calls per field.
+
+		// @DOCLINE ## Field types
+
+			/* @DOCBEGIN
+
+			The type of each field is given by its endianness, being `LE` or `BE`, and one of the following type names, which map to the byte manipulation macros of the same name (for example, `BE` and `U32` map to `MU_RBEU32` and `MU_WBEU32`):
+
+			* `U8`, `S8`, `U16`, `S16`, `U32`, `S32`, `U64`, and `S64` - the integers of the given size, stored as the integer type of the same size.
+
+			* `U24` and `S24` - the 24-bit integers, stored as `uint32_m` and `int32_m` respectively.
+
+			* `F32` and `F64` - floating-point values, stored as `float` and `double` respectively.
+
+			* `F16` and `BF16` - half-precision floating-point values, stored as `float`.
+
+			@DOCEND */
+
+			#define MUU_RECORD_TYPE_U8 uint8_m
+			#define MUU_RECORD_TYPE_S8 int8_m
+			#define MUU_RECORD_TYPE_U16 uint16_m
+			#define MUU_RECORD_TYPE_S16 int16_m
+			#define MUU_RECORD_TYPE_U24 uint32_m
+			#define MUU_RECORD_TYPE_S24 int32_m
+			#define MUU_RECORD_TYPE_U32 uint32_m
+			#define MUU_RECORD_TYPE_S32 int32_m
+			#define MUU_RECORD_TYPE_U64 uint64_m
+			#define MUU_RECORD_TYPE_S64 int64_m
+			#define MUU_RECORD_TYPE_F32 float
+			#define MUU_RECORD_TYPE_F64 double
+			#define MUU_RECORD_TYPE_F16 float
+			#define MUU_RECORD_TYPE_BF16 float
+
+			#define MUU_RECORD_SIZE_U8 1
+			#define MUU_RECORD_SIZE_S8 1
+			#define MUU_RECORD_SIZE_U16 2
+			#define MUU_RECORD_SIZE_S16 2
+			#define MUU_RECORD_SIZE_U24 3
+			#define MUU_RECORD_SIZE_S24 3
+			#define MUU_RECORD_SIZE_U32 4
+			#define MUU_RECORD_SIZE_S32 4
+			#define MUU_RECORD_SIZE_U64 8
+			#define MUU_RECORD_SIZE_S64 8
+			#define MUU_RECORD_SIZE_F32 4
+			#define MUU_RECORD_SIZE_F64 8
+			#define MUU_RECORD_SIZE_F16 2
+			#define MUU_RECORD_SIZE_BF16 2
+
+			// Expansions of a record's field list for each part of MU_RECORD
+			#define MUU_RECORD_MEMBER(member, offset, e, t) MUU_RECORD_TYPE_##t member;
+			#define MUU_RECORD_ARRAY_MEMBER(member, offset, e, t, count) MUU_RECORD_TYPE_##t member[count];
+			#define MUU_RECORD_UNPACK(member, offset, e, t) n[i].member = MU_R##e##t(&b[offset]);
+			#define MUU_RECORD_ARRAY_UNPACK(member, offset, e, t, count) \
+				for (size_m j = 0; j < (count); ++j) { \
+					n[i].member[j] = MU_R##e##t(&b[(offset) + j*MUU_RECORD_SIZE_##t]); \
+				}
+			#define MUU_RECORD_PACK(member, offset, e, t) MU_W##e##t(&b[offset], n[i].member);
+			#define MUU_RECORD_ARRAY_PACK(member, offset, e, t, count) \
+				for (size_m j = 0; j < (count); ++j) { \
+					MU_W##e##t(&b[(offset) + j*MUU_RECORD_SIZE_##t], n[i].member[j]); \
+				}
+
+		// @DOCLINE ## Declaring a record
+
+			/* @DOCBEGIN
+
+			The macro `MU_RECORD(name, size, fields)` declares a record type named `name`, whose byte data is `size` bytes long, along with its functions. `fields` is the name of a function-like macro taking two parameters, `FIELD` and `ARRAY`, which lists the fields of the record by expanding to `FIELD(member, offset, endianness, type)` for each single value and `ARRAY(member, offset, endianness, type, count)` for each fixed-size array of values, where `offset` is the offset of the field within the record's byte data. For example, the format chunk of a WAV file can be described like this:
+
+			```c
+			#define WAV_FMT(FIELD, ARRAY) \
+				ARRAY(id, 0, LE, U8, 4) \
+				FIELD(chunk_size, 4, LE, U32) \
+				FIELD(format, 8, LE, U16) \
+				FIELD(channels, 10, LE, U16) \
+				FIELD(sample_rate, 12, LE, U32) \
+				FIELD(byte_rate, 16, LE, U32) \
+				FIELD(block_align, 20, LE, U16) \
+				FIELD(bits, 22, LE, U16)
+
+			MU_RECORD(WavFmt, 24, WAV_FMT)
+			```
+
+			`MU_RECORD` declares the struct `name`, which has a member of the field's type for every field in the order that they are listed (for example, `uint8_m id[4]` and `uint32_m chunk_size` above). Fields can be listed in any order and may leave gaps, which are left untouched when packing, but must lie within the `size` bytes of the record.
+
+			@DOCEND */
+
+			#define MU_RECORD(name, size, fields) \
+				struct name { \
+					fields(MUU_RECORD_MEMBER, MUU_RECORD_ARRAY_MEMBER) \
+				}; \
+				typedef struct name name; \
+				\
+				MUDEF inline void name##_unpack(muByte* b, name* n, size_m count) { \
+					for (size_m i = 0; i < count; ++i, b += (size)) { \
+						fields(MUU_RECORD_UNPACK, MUU_RECORD_ARRAY_UNPACK) \
+					} \
+				} \
+				\
+				MUDEF inline void name##_pack(muByte* b, name* n, size_m count) { \
+					for (size_m i = 0; i < count; ++i, b += (size)) { \
+						fields(MUU_RECORD_PACK, MUU_RECORD_ARRAY_PACK) \
+					} \
+				} \
+				\
+				MUDEF inline muBool name##_read(muByteReader* r, name* n, size_m count, muuResult* result) { \
+					size_m batch = (r->refill) ? (r->capacity / (size)) : count; \
+					batch = (batch == 0) ? 1 : batch; \
+					while (count != 0) { \
+						size_m len = (count < batch) ? count : batch; \
+						muByte* b = muu_byte_reader_take(r, len * (size), result); \
+						if (!b) { \
+							return MU_FALSE; \
+						} \
+						name##_unpack(b, n, len); \
+						n += len; \
+						count -= len; \
+					} \
+					return MU_TRUE; \
+				} \
+				\
+				MUDEF inline muBool name##_write(muByteWriter* w, name* n, size_m count, muuResult* result) { \
+					size_m batch = (w->flush) ? (w->capacity / (size)) : count; \
+					batch = (batch == 0) ? 1 : batch; \
+					while (count != 0) { \
+						size_m len = (count < batch) ? count : batch; \
+						muByte* b = muu_byte_writer_reserve(w, len * (size), result); \
+						if (!b) { \
+							return MU_FALSE; \
+						} \
+						name##_pack(b, n, len); \
+						n += len; \
+						count -= len; \
+					} \
+					return MU_TRUE; \
+				}
+
+		// @DOCLINE ## Record functions
+
+			// @DOCLINE `MU_RECORD` declares the following functions, where `count` is the amount of records:
+
+			// @DOCLINE * `name##_unpack` - reads `count` records from `count*size` bytes of byte data; defined as `MUDEF inline void name##_unpack(muByte* b, name* n, size_m count)`.
+
+			// @DOCLINE * `name##_pack` - writes `count` records to `count*size` bytes of byte data; defined as `MUDEF inline void name##_pack(muByte* b, name* n, size_m count)`.
+
+			// @DOCLINE * `name##_read` - reads `count` records from a byte reader; defined as `MUDEF inline muBool name##_read(muByteReader* r, name* n, size_m count, muuResult* result)`. It returns `MU_FALSE` and sets `result` to `MUU_OUT_OF_DATA` if the data ran out, in which case the records before the last batch taken from the reader have still been read.
+
+			// @DOCLINE * `name##_write` - writes `count` records to a byte writer; defined as `MUDEF inline muBool name##_write(muByteWriter* w, name* n, size_m count, muuResult* result)`. It returns `MU_FALSE` and sets `result` to a non-success value if the records couldn't be written.
+
+			// @DOCLINE Records are converted in batches of as many as fit in the reader's or writer's buffer, so a buffer with a callback must be able to hold at least one record.
+
+	// @DOCLINE # Endian views
+
+		// @DOCLINE muUtility defines wrapper types for values of a fixed endianness, which can be used to declare structs that overlay byte data directly (such as a memory-mapped file) instead of decoding it into native structs up front. Each wrapper type is a struct holding only the raw bytes of the value, so it has the exact size of the value and an alignment of 1, and the value is only decoded when it is read. For example:
+
+		/* @DOCBEGIN
+		```c
+		struct TableRecord {
+			muBEU32 tag;
+			muBEU32 checksum;
+			muBEU32 offset;
+			muBEU32 length;
+		};
+		typedef struct TableRecord TableRecord;
+
+		TableRecord* records = MU_VIEW_ARRAY(TableRecord, data, len, 12, count);
+		if (records) {
+			uint32_m offset = muu_beu32_get(&records[i].offset);
+		}
+		```
+		@DOCEND */
+
+		// @DOCLINE A struct made only of wrapper types and `muByte` members has no padding, so its size is the same as the size of the byte data it overlays.
+
+		// @DOCLINE ## Wrapper types
+
+			// @DOCLINE The following wrapper types exist, each of which is a struct with the single member `muByte b[n]`, where `n` is the size of the value in bytes:
+
+			// @DOCLINE * `muLEU16` - an unsigned 16-bit integer of little-endian byte data.
+			struct muLEU16 {
+				muByte b[2];
+			};
+			typedef struct muLEU16 muLEU16;
+
+			// @DOCLINE * `muLES16` - a signed 16-bit integer of little-endian byte data.
+			struct muLES16 {
+				muByte b[2];
+			};
+			typedef struct muLES16 muLES16;
+
+			// @DOCLINE * `muLEU24` - an unsigned 24-bit integer of little-endian byte data.
+			struct muLEU24 {
+				muByte b[3];
+			};
+			typedef struct muLEU24 muLEU24;
+
+			// @DOCLINE * `muLES24` - a signed 24-bit integer of little-endian byte data.
+			struct muLES24 {
+				muByte b[3];
+			};
+			typedef struct muLES24 muLES24;
+
+			// @DOCLINE * `muLEU32` - an unsigned 32-bit integer of little-endian byte data.
+			struct muLEU32 {
+				muByte b[4];
+			};
+			typedef struct muLEU32 muLEU32;
+
+			// @DOCLINE * `muLES32` - a signed 32-bit integer of little-endian byte data.
+			struct muLES32 {
+				muByte b[4];
+			};
+			typedef struct muLES32 muLES32;
+
+			// @DOCLINE * `muLEU64` - an unsigned 64-bit integer of little-endian byte data.
+			struct muLEU64 {
+				muByte b[8];
+			};
+			typedef struct muLEU64 muLEU64;
+
+			// @DOCLINE * `muLES64` - a signed 64-bit integer of little-endian byte data.
+			struct muLES64 {
+				muByte b[8];
+			};
+			typedef struct muLES64 muLES64;
+
+			// @DOCLINE * `muLEF32` - a float of little-endian byte data.
+			struct muLEF32 {
+				muByte b[4];
+			};
+			typedef struct muLEF32 muLEF32;
+
+			// @DOCLINE * `muLEF64` - a double of little-endian byte data.
+			struct muLEF64 {
+				muByte b[8];
+			};
+			typedef struct muLEF64 muLEF64;
+
+			// @DOCLINE * `muLEF16` - an f16 value of little-endian byte data.
+			struct muLEF16 {
+				muByte b[2];
+			};
+			typedef struct muLEF16 muLEF16;
+
+			// @DOCLINE * `muLEBF16` - a bf16 value of little-endian byte data.
+			struct muLEBF16 {
+				muByte b[2];
+			};
+			typedef struct muLEBF16 muLEBF16;
+
+			// @DOCLINE * `muBEU16` - an unsigned 16-bit integer of big-endian byte data.
+			struct muBEU16 {
+				muByte b[2];
+			};
+			typedef struct muBEU16 muBEU16;
+
+			// @DOCLINE * `muBES16` - a signed 16-bit integer of big-endian byte data.
+			struct muBES16 {
+				muByte b[2];
+			};
+			typedef struct muBES16 muBES16;
+
+			// @DOCLINE * `muBEU24` - an unsigned 24-bit integer of big-endian byte data.
+			struct muBEU24 {
+				muByte b[3];
+			};
+			typedef struct muBEU24 muBEU24;
+
+			// @DOCLINE * `muBES24` - a signed 24-bit integer of big-endian byte data.
+			struct muBES24 {
+				muByte b[3];
+			};
+			typedef struct muBES24 muBES24;
+
+			// @DOCLINE * `muBEU32` - an unsigned 32-bit integer of big-endian byte data.
+			struct muBEU32 {
+				muByte b[4];
+			};
+			typedef struct muBEU32 muBEU32;
+
+			// @DOCLINE * `muBES32` - a signed 32-bit integer of big-endian byte data.
+			struct muBES32 {
+				muByte b[4];
+			};
+			typedef struct muBES32 muBES32;
+
+			// @DOCLINE * `muBEU64` - an unsigned 64-bit integer of big-endian byte data.
+			struct muBEU64 {
+				muByte b[8];
+			};
+			typedef struct muBEU64 muBEU64;
+
+			// @DOCLINE * `muBES64` - a signed 64-bit integer of big-endian byte data.
+			struct muBES64 {
+				muByte b[8];
+			};
+			typedef struct muBES64 muBES64;
+
+			// @DOCLINE * `muBEF32` - a float of big-endian byte data.
+			struct muBEF32 {
+				muByte b[4];
+			};
+			typedef struct muBEF32 muBEF32;
+
+			// @DOCLINE * `muBEF64` - a double of big-endian byte data.
+			struct muBEF64 {
+				muByte b[8];
+			};
+			typedef struct muBEF64 muBEF64;
+
+			// @DOCLINE * `muBEF16` - an f16 value of big-endian byte data.
+			struct muBEF16 {
+				muByte b[2];
+			};
+			typedef struct muBEF16 muBEF16;
+
+			// @DOCLINE * `muBEBF16` - a bf16 value of big-endian byte data.
+			struct muBEBF16 {
+				muByte b[2];
+			};
+			typedef struct muBEBF16 muBEBF16;
+
+		// @DOCLINE ## Reading and writing
+
+			// @DOCLINE Each wrapper type has a function that reads its value and a function that writes it, which are named after the wrapper type with the suffixes `_get` and `_set`; for example, the functions of `muBEU32` are defined as:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline uint32_m muu_beu32_get(muBEU32* v);
+			MUDEF inline void muu_beu32_set(muBEU32* v, uint32_m n);
+			```
+			@DOCEND */
+
+			// @DOCLINE The following reading and writing functions are defined:
+
+			// @DOCLINE * `muu_leu16_get` / `muu_leu16_set` - reads or writes the value of a `muLEU16`, using `MU_RLEU16` and `MU_WLEU16`.
+			MUDEF inline uint16_m muu_leu16_get(muLEU16* v) {
+				return MU_RLEU16(v->b);
+			}
+
+			MUDEF inline void muu_leu16_set(muLEU16* v, uint16_m n) {
+				MU_WLEU16(v->b, n);
+			}
+
+			// @DOCLINE * `muu_les16_get` / `muu_les16_set` - reads or writes the value of a `muLES16`, using `MU_RLES16` and `MU_WLES16`.
+			MUDEF inline int16_m muu_les16_get(muLES16* v) {
+				return MU_RLES16(v->b);
+			}
+
+			MUDEF inline void muu_les16_set(muLES16* v, int16_m n) {
+				MU_WLES16(v->b, n);
+			}
+
+			// @DOCLINE * `muu_leu24_get` / `muu_leu24_set` - reads or writes the value of a `muLEU24`, using `MU_RLEU24` and `MU_WLEU24`.
+			MUDEF inline uint32_m muu_leu24_get(muLEU24* v) {
+				return MU_RLEU24(v->b);
+			}
+
+			MUDEF inline void muu_leu24_set(muLEU24* v, uint32_m n) {
+				MU_WLEU24(v->b, n);
+			}
+
+			// @DOCLINE * `muu_les24_get` / `muu_les24_set` - reads or writes the value of a `muLES24`, using `MU_RLES24` and `MU_WLES24`.
+			MUDEF inline int32_m muu_les24_get(muLES24* v) {
+				return MU_RLES24(v->b);
+			}
+
+			MUDEF inline void muu_les24_set(muLES24* v, int32_m n) {
+				MU_WLES24(v->b, n);
+			}
+
+			// @DOCLINE * `muu_leu32_get` / `muu_leu32_set` - reads or writes the value of a `muLEU32`, using `MU_RLEU32` and `MU_WLEU32`.
+			MUDEF inline uint32_m muu_leu32_get(muLEU32* v) {
+				return MU_RLEU32(v->b);
+			}
+
+			MUDEF inline void muu_leu32_set(muLEU32* v, uint32_m n) {
+				MU_WLEU32(v->b, n);
+			}
+
+			// @DOCLINE * `muu_les32_get` / `muu_les32_set` - reads or writes the value of a `muLES32`, using `MU_RLES32` and `MU_WLES32`.
+			MUDEF inline int32_m muu_les32_get(muLES32* v) {
+				return MU_RLES32(v->b);
+			}
+
+			MUDEF inline void muu_les32_set(muLES32* v, int32_m n) {
+				MU_WLES32(v->b, n);
+			}
+
+			// @DOCLINE * `muu_leu64_get` / `muu_leu64_set` - reads or writes the value of a `muLEU64`, using `MU_RLEU64` and `MU_WLEU64`.
+			MUDEF inline uint64_m muu_leu64_get(muLEU64* v) {
+				return MU_RLEU64(v->b);
+			}
+
+			MUDEF inline void muu_leu64_set(muLEU64* v, uint64_m n) {
+				MU_WLEU64(v->b, n);
+			}
+
+			// @DOCLINE * `muu_les64_get` / `muu_les64_set` - reads or writes the value of a `muLES64`, using `MU_RLES64` and `MU_WLES64`.
+			MUDEF inline int64_m muu_les64_get(muLES64* v) {
+				return MU_RLES64(v->b);
+			}
+
+			MUDEF inline void muu_les64_set(muLES64* v, int64_m n) {
+				MU_WLES64(v->b, n);
+			}
+
+			// @DOCLINE * `muu_lef32_get` / `muu_lef32_set` - reads or writes the value of a `muLEF32`, using `MU_RLEF32` and `MU_WLEF32`.
+			MUDEF inline float muu_lef32_get(muLEF32* v) {
+				return MU_RLEF32(v->b);
+			}
+
+			MUDEF inline void muu_lef32_set(muLEF32* v, float n) {
+				MU_WLEF32(v->b, n);
+			}
+
+			// @DOCLINE * `muu_lef64_get` / `muu_lef64_set` - reads or writes the value of a `muLEF64`, using `MU_RLEF64` and `MU_WLEF64`.
+			MUDEF inline double muu_lef64_get(muLEF64* v) {
+				return MU_RLEF64(v->b);
+			}
+
+			MUDEF inline void muu_lef64_set(muLEF64* v, double n) {
+				MU_WLEF64(v->b, n);
+			}
+
+			// @DOCLINE * `muu_lef16_get` / `muu_lef16_set` - reads or writes the value of a `muLEF16`, using `MU_RLEF16` and `MU_WLEF16`.
+			MUDEF inline float muu_lef16_get(muLEF16* v) {
+				return MU_RLEF16(v->b);
+			}
+
+			MUDEF inline void muu_lef16_set(muLEF16* v, float n) {
+				MU_WLEF16(v->b, n);
+			}
+
+			// @DOCLINE * `muu_lebf16_get` / `muu_lebf16_set` - reads or writes the value of a `muLEBF16`, using `MU_RLEBF16` and `MU_WLEBF16`.
+			MUDEF inline float muu_lebf16_get(muLEBF16* v) {
+				return MU_RLEBF16(v->b);
+			}
+
+			MUDEF inline void muu_lebf16_set(muLEBF16* v, float n) {
+				MU_WLEBF16(v->b, n);
+			}
+
+			// @DOCLINE * `muu_beu16_get` / `muu_beu16_set` - reads or writes the value of a `muBEU16`, using `MU_RBEU16` and `MU_WBEU16`.
+			MUDEF inline uint16_m muu_beu16_get(muBEU16* v) {
+				return MU_RBEU16(v->b);
+			}
+
+			MUDEF inline void muu_beu16_set(muBEU16* v, uint16_m n) {
+				MU_WBEU16(v->b, n);
+			}
+
+			// @DOCLINE * `muu_bes16_get` / `muu_bes16_set` - reads or writes the value of a `muBES16`, using `MU_RBES16` and `MU_WBES16`.
+			MUDEF inline int16_m muu_bes16_get(muBES16* v) {
+				return MU_RBES16(v->b);
+			}
+
+			MUDEF inline void muu_bes16_set(muBES16* v, int16_m n) {
+				MU_WBES16(v->b, n);
+			}
+
+			// @DOCLINE * `muu_beu24_get` / `muu_beu24_set` - reads or writes the value of a `muBEU24`, using `MU_RBEU24` and `MU_WBEU24`.
+			MUDEF inline uint32_m muu_beu24_get(muBEU24* v) {
+				return MU_RBEU24(v->b);
+			}
+
+			MUDEF inline void muu_beu24_set(muBEU24* v, uint32_m n) {
+				MU_WBEU24(v->b, n);
+			}
+
+			// @DOCLINE * `muu_bes24_get` / `muu_bes24_set` - reads or writes the value of a `muBES24`, using `MU_RBES24` and `MU_WBES24`.
+			MUDEF inline int32_m muu_bes24_get(muBES24* v) {
+				return MU_RBES24(v->b);
+			}
+
+			MUDEF inline void muu_bes24_set(muBES24* v, int32_m n) {
+				MU_WBES24(v->b, n);
+			}
+
+			// @DOCLINE * `muu_beu32_get` / `muu_beu32_set` - reads or writes the value of a `muBEU32`, using `MU_RBEU32` and `MU_WBEU32`.
+			MUDEF inline uint32_m muu_beu32_get(muBEU32* v) {
+				return MU_RBEU32(v->b);
+			}
+
+			MUDEF inline void muu_beu32_set(muBEU32* v, uint32_m n) {
+				MU_WBEU32(v->b, n);
+			}
+
+			// @DOCLINE * `muu_bes32_get` / `muu_bes32_set` - reads or writes the value of a `muBES32`, using `MU_RBES32` and `MU_WBES32`.
+			MUDEF inline int32_m muu_bes32_get(muBES32* v) {
+				return MU_RBES32(v->b);
+			}
+
+			MUDEF inline void muu_bes32_set(muBES32* v, int32_m n) {
+				MU_WBES32(v->b, n);
+			}
+
+			// @DOCLINE * `muu_beu64_get` / `muu_beu64_set` - reads or writes the value of a `muBEU64`, using `MU_RBEU64` and `MU_WBEU64`.
+			MUDEF inline uint64_m muu_beu64_get(muBEU64* v) {
+				return MU_RBEU64(v->b);
+			}
+
+			MUDEF inline void muu_beu64_set(muBEU64* v, uint64_m n) {
+				MU_WBEU64(v->b, n);
+			}
+
+			// @DOCLINE * `muu_bes64_get` / `muu_bes64_set` - reads or writes the value of a `muBES64`, using `MU_RBES64` and `MU_WBES64`.
+			MUDEF inline int64_m muu_bes64_get(muBES64* v) {
+				return MU_RBES64(v->b);
+			}
+
+			MUDEF inline void muu_bes64_set(muBES64* v, int64_m n) {
+				MU_WBES64(v->b, n);
+			}
+
+			// @DOCLINE * `muu_bef32_get` / `muu_bef32_set` - reads or writes the value of a `muBEF32`, using `MU_RBEF32` and `MU_WBEF32`.
+			MUDEF inline float muu_bef32_get(muBEF32* v) {
+				return MU_RBEF32(v->b);
+			}
+
+			MUDEF inline void muu_bef32_set(muBEF32* v, float n) {
+				MU_WBEF32(v->b, n);
+			}
+
+			// @DOCLINE * `muu_bef64_get` / `muu_bef64_set` - reads or writes the value of a `muBEF64`, using `MU_RBEF64` and `MU_WBEF64`.
+			MUDEF inline double muu_bef64_get(muBEF64* v) {
+				return MU_RBEF64(v->b);
+			}
+
+			MUDEF inline void muu_bef64_set(muBEF64* v, double n) {
+				MU_WBEF64(v->b, n);
+			}
+
+			// @DOCLINE * `muu_bef16_get` / `muu_bef16_set` - reads or writes the value of a `muBEF16`, using `MU_RBEF16` and `MU_WBEF16`.
+			MUDEF inline float muu_bef16_get(muBEF16* v) {
+				return MU_RBEF16(v->b);
+			}
+
+			MUDEF inline void muu_bef16_set(muBEF16* v, float n) {
+				MU_WBEF16(v->b, n);
+			}
+
+			// @DOCLINE * `muu_bebf16_get` / `muu_bebf16_set` - reads or writes the value of a `muBEBF16`, using `MU_RBEBF16` and `MU_WBEBF16`.
+			MUDEF inline float muu_bebf16_get(muBEBF16* v) {
+				return MU_RBEBF16(v->b);
+			}
+
+			MUDEF inline void muu_bebf16_set(muBEBF16* v, float n) {
+				MU_WBEBF16(v->b, n);
+			}
+
+		// @DOCLINE ## Views
+
+			// @DOCLINE The function `muu_view` returns a pointer to `size` bytes at `offset` within byte data of length `len`, or 0 if they don't lie entirely within the data, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muByte* muu_view(muByte* data, size_m len, size_m offset, size_m size);
+			```
+			@DOCEND */
+
+			MUDEF inline muByte* muu_view(muByte* data, size_m len, size_m offset, size_m size) {
+				if (offset > len || size > len - offset) {
+					return 0;
+				}
+				return &data[offset];
+			}
+
+			// @DOCLINE The function `muu_view_array` does the same for an array of `count` elements of `size` bytes each, also returning 0 if the total size overflows, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muByte* muu_view_array(muByte* data, size_m len, size_m offset, size_m size, size_m count);
+			```
+			@DOCEND */
+
+			MUDEF inline muByte* muu_view_array(muByte* data, size_m len, size_m offset, size_m size, size_m count) {
+				if (size != 0 && count > MU_SIZE_MAX / size) {
+					return 0;
+				}
+				return muu_view(data, len, offset, size * count);
+			}
+
+			// @DOCLINE The macros `MU_VIEW(type, data, len, offset)` and `MU_VIEW_ARRAY(type, data, len, offset, count)` call these functions with `sizeof(type)` as the size, and cast the result to `type*`.
+			#define MU_VIEW(type, data, len, offset) ((type*)muu_view(data, len, offset, sizeof(type)))
+			#define MU_VIEW_ARRAY(type, data, len, offset, count) ((type*)muu_view_array(data, len, offset, sizeof(type), count))
+
+			// @DOCLINE These only check bounds once, after which the fields of the view can be read in any order without further checks. Since only the fields that are read get decoded, this is useful for large files of which only a small part is accessed.
+
+	// @DOCLINE # Mapped files
+
+		// @DOCLINE muUtility defines an optional API for getting the contents of a file as a range of bytes without copying it into a heap buffer, by memory-mapping it. It is only defined if `MU_LINUX` is defined, and if `MU_FILE_MAP` is defined before the inclusion of muUtility, as it relies on the POSIX headers `fcntl.h`, `unistd.h`, `sys/mman.h`, and `sys/stat.h`; note that this means that, when compiling with a strict standard mode (such as `-std=c99`), a feature-test macro such as `_DEFAULT_SOURCE` also needs to be defined before the inclusion of any system header.
+
+		// @DOCLINE If a file can't be mapped (for example, if it isn't a regular file), its contents are read into a buffer allocated with `MU_ALLOC` using `read` instead (retrying reads interrupted by a signal), so that the API can be used with any readable file.
+
+		#if defined(MU_LINUX) && defined(MU_FILE_MAP)
+
+			#include <errno.h>
+			#include <fcntl.h>
+			#include <unistd.h>
+			#include <sys/mman.h>
+			#include <sys/stat.h>
+
+		// @DOCLINE ## Mapped file struct
+
+			// @DOCLINE The struct `muMappedFile` represents the contents of a file, and has the following members:
+
+			struct muMappedFile {
+				// @DOCLINE * `muByte* data` - the contents of the file, or 0 if the file is empty. This memory is read-only if the file was mapped.
+				muByte* data;
+				// @DOCLINE * `size_m len` - the size of the file, in bytes.
+				size_m len;
+				// @DOCLINE * `muBool mapped` - whether or not the file was mapped; if not, `data` was allocated via `MU_ALLOC`.
+				muBool mapped;
+			};
+			typedef struct muMappedFile muMappedFile;
+
+			// @DOCLINE `data` and `len` can be passed directly to the byte manipulation functions or to `muu_byte_reader_init`.
+
+		// @DOCLINE ## Mapping flags
+
+			// @DOCLINE The enumerator `muFileMapFlag` defines flags that can be bitwise-OR'd together to give hints on how the file is going to be accessed. It has the following values:
+
+			MU_ENUM(muFileMapFlag,
+				// @DOCLINE * `MU_FILE_MAP_SEQUENTIAL` - the file is going to be read sequentially, so it should be read ahead aggressively (`POSIX_MADV_SEQUENTIAL`).
+				MU_FILE_MAP_SEQUENTIAL = 1,
+				// @DOCLINE * `MU_FILE_MAP_RANDOM` - the file is going to be accessed in a random order, so read-ahead should be minimal (`POSIX_MADV_RANDOM`).
+				MU_FILE_MAP_RANDOM = 2,
+				// @DOCLINE * `MU_FILE_MAP_WILLNEED` - the whole file is going to be needed soon, so reading it in should be started now (`POSIX_MADV_WILLNEED`).
+				MU_FILE_MAP_WILLNEED = 4,
+				// @DOCLINE * `MU_FILE_MAP_POPULATE` - the whole file should be read in and its page tables populated before mapping returns (`MAP_POPULATE`), avoiding page faults later on.
+				MU_FILE_MAP_POPULATE = 8,
+			)
+
+		// @DOCLINE ## Mapping a file
+
+			// Reads the rest of a file descriptor's contents into a heap buffer; used when mapping
+			// isn't possible. 'hint' is the expected size of the file, or 0 if unknown.
+			MUDEF inline muBool muu_inner_file_read_all(muMappedFile* f, int fd, size_m hint, muuResult* result) {
+				size_m cap = hint ? hint+1 : 4096;
+				size_m len = 0;
+				muByte* data = (muByte*)MU_ALLOC(cap);
+				if (!data) {
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+					return MU_FALSE;
+				}
+
+				for (;;) {
+					if (len == cap) {
+						muByte* ndata = (muByte*)MU_REALLOC(data, cap*2);
+						if (!ndata) {
+							MU_FREE(data);
+							MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+							return MU_FALSE;
+						}
+						data = ndata;
+						cap *= 2;
+					}
+
+					ssize_t got = read(fd, &data[len], cap - len);
+					if (got < 0 && errno == EINTR) {
+						continue;
+					}
+					if (got < 0) {
+						MU_FREE(data);
+						MU_SET_RESULT(result, MUU_FILE_READ_FAILED)
+						return MU_FALSE;
+					}
+					if (got == 0) {
+						break;
+					}
+					len += (size_m)got;
+				}
+
+				// Files such as those in /proc report a size of 0 but still have contents, so
+				// emptiness is only known once reading is done
+				if (len == 0) {
+					MU_FREE(data);
+					data = 0;
+				}
+
+				f->data = data;
+				f->len = len;
+				f->mapped = MU_FALSE;
+				return MU_TRUE;
+			}
+
+			// @DOCLINE The function `muu_file_map` gets the contents of a file at the given path, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_file_map(muMappedFile* f, const char* path, uint32_m flags, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_file_map(muMappedFile* f, const char* path, uint32_m flags, muuResult* result) {
+				f->data = 0;
+				f->len = 0;
+				f->mapped = MU_FALSE;
+
+				int fd = open(path, O_RDONLY | O_CLOEXEC);
+				if (fd < 0) {
+					MU_SET_RESULT(result, MUU_FILE_OPEN_FAILED)
+					return MU_FALSE;
+				}
+
+				struct stat st;
+				if (fstat(fd, &st) != 0) {
+					close(fd);
+					MU_SET_RESULT(result, MUU_FILE_OPEN_FAILED)
+					return MU_FALSE;
+				}
+
+				// Regular files with a known size can be mapped
+				if (S_ISREG(st.st_mode) && st.st_size > 0 && (uint64_m)st.st_size <= (uint64_m)MU_SIZE_MAX) {
+					int mflags = MAP_PRIVATE;
+					#ifdef MAP_POPULATE
+						if (flags & MU_FILE_MAP_POPULATE) {
+							mflags |= MAP_POPULATE;
+						}
+					#endif
+
+					void* p = mmap(0, (size_t)st.st_size, PROT_READ, mflags, fd, 0);
+					if (p != MAP_FAILED) {
+						if (flags & MU_FILE_MAP_SEQUENTIAL) {
+							posix_madvise(p, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+						}
+						if (flags & MU_FILE_MAP_RANDOM) {
+							posix_madvise(p, (size_t)st.st_size, POSIX_MADV_RANDOM);
+						}
+						if (flags & MU_FILE_MAP_WILLNEED) {
+							posix_madvise(p, (size_t)st.st_size, POSIX_MADV_WILLNEED);
+						}
+
+						// The mapping stays valid after the descriptor is closed
+						close(fd);
+						f->data = (muByte*)p;
+						f->len = (size_m)st.st_size;
+						f->mapped = MU_TRUE;
+						return MU_TRUE;
+					}
+				}
+
+				// Fall back to reading the file
+				muBool ok = muu_inner_file_read_all(f, fd, S_ISREG(st.st_mode) ? (size_m)st.st_size : 0, result);
+				close(fd);
+				return ok;
+			}
+
+			// @DOCLINE Upon success, `f` is filled with the contents of the file, and `MU_TRUE` is returned. Upon failure, `result` is set to `MUU_FILE_OPEN_FAILED`, `MUU_FILE_READ_FAILED`, or `MUU_ALLOCATION_FAILED`, and `MU_FALSE` is returned. `flags` is a bitwise-OR'd combination of `muFileMapFlag` values, or 0.
+
+			// @DOCLINE The function `muu_file_unmap` releases the contents of a file retrieved with `muu_file_map`, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_file_unmap(muMappedFile* f);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_file_unmap(muMappedFile* f) {
+				if (f->data) {
+					if (f->mapped) {
+						munmap(f->data, f->len);
+					} else {
+						MU_FREE(f->data);
+					}
+				}
+				f->data = 0;
+				f->len = 0;
+				f->mapped = MU_FALSE;
+			}
+
+		#endif /* MU_LINUX && MU_FILE_MAP */
+
+	// @DOCLINE # Arena
+
+		// @DOCLINE The `muArena` struct is a linear (bump) allocator, which hands out memory by advancing a position within a block of memory, and frees everything it allocated at once. It can allocate out of a fixed buffer given by the user, out of a chain of blocks allocated with `MU_ALLOC` on demand, or both, in which case blocks are chained once the fixed buffer runs out. The current position can be saved and later restored, which frees everything allocated in-between, allowing temporary allocations to be scoped.
+
+		// @DOCLINE ## Alignment
+
+			// @DOCLINE The macro `MU_ALIGNOF(type)` gives the alignment requirement of a type, and is overridable. It maps to `alignof` in C++11, `_Alignof` in C11, and compiler extensions otherwise, falling back to 16.
+			#ifndef MU_ALIGNOF
+				#if defined(__cplusplus) && (__cplusplus >= 201103L)
+					#define MU_ALIGNOF(type) alignof(type)
+				#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+					#define MU_ALIGNOF(type) _Alignof(type)
+				#elif defined(__GNUC__) || defined(__clang__)
+					#define MU_ALIGNOF(type) __alignof__(type)
+				#elif defined(_MSC_VER)
+					#define MU_ALIGNOF(type) __alignof(type)
+				#else
+					#define MU_ALIGNOF(type) 16
+				#endif
+			#endif
+
+		// @DOCLINE ## Arena struct
+
+			// Header placed at the start of every chained block; its size is rounded up
+			// to 16 bytes so that small alignments usually need no padding
+			struct muArenaBlock {
+				struct muArenaBlock* prev;
+				size_m capacity;
+			};
+			typedef struct muArenaBlock muArenaBlock;
+			#define MUU_ARENA_HEADER ((sizeof(muArenaBlock) + 15) & ~(size_m)15)
+
+			// @DOCLINE The struct `muArena` has the following members:
+
+			struct muArena {
+				// @DOCLINE * `muByte* buffer` - the fixed buffer given by the user, or 0 if none was given.
+				muByte* buffer;
+				// @DOCLINE * `size_m buffer_capacity` - the size of `buffer`.
+				size_m buffer_capacity;
+				// @DOCLINE * `muArenaBlock* block` - the most recently chained block, or 0 if still allocating out of `buffer`.
+				muArenaBlock* block;
+				// @DOCLINE * `size_m pos` - the amount of bytes used in the current block (or `buffer`).
+				size_m pos;
+				// @DOCLINE * `size_m block_size` - the minimum size of chained blocks, or 0 if the arena never chains blocks.
+				size_m block_size;
+			};
+			typedef struct muArena muArena;
+
+			// @DOCLINE These members should not be modified directly.
+
+		// @DOCLINE ## Arena initialization
+
+			// @DOCLINE The function `muu_arena_init` initializes an arena that allocates out of chained blocks, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_arena_init(muArena* a, size_m block_size);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_arena_init(muArena* a, size_m block_size) {
+				a->buffer = 0;
+				a->buffer_capacity = 0;
+				a->block = 0;
+				a->pos = 0;
+				a->block_size = block_size;
+			}
+
+			// @DOCLINE `block_size` is the minimum size of each block; allocations larger than it get a block of their own.
+
+			// @DOCLINE The function `muu_arena_init_buffer` initializes an arena that allocates out of a fixed buffer first, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_arena_init_buffer(muArena* a, muByte* buffer, size_m capacity, size_m block_size);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_arena_init_buffer(muArena* a, muByte* buffer, size_m capacity, size_m block_size) {
+				a->buffer = buffer;
+				a->buffer_capacity = capacity;
+				a->block = 0;
+				a->pos = 0;
+				a->block_size = block_size;
+			}
+
+			// @DOCLINE If `block_size` is 0, the arena never allocates memory itself, and allocations fail once `buffer` runs out.
+
+		// @DOCLINE ## Arena allocation
+
+			// @DOCLINE The function `muu_arena_alloc` allocates memory from an arena, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void* muu_arena_alloc(muArena* a, size_m size, size_m align, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline void* muu_arena_alloc(muArena* a, size_m size, size_m align, muuResult* result) {
+				muByte* data = a->block ? ((muByte*)a->block) + MUU_ARENA_HEADER : a->buffer;
+				size_m cap = a->block ? a->block->capacity : a->buffer_capacity;
+
+				// Try to fit the allocation in the current block
+				if (data) {
+					size_m pad = (align - (((size_m)data + a->pos) & (align - 1))) & (align - 1);
+					if (pad <= cap - a->pos && size <= cap - a->pos - pad) {
+						void* p = &data[a->pos + pad];
+						a->pos += pad + size;
+						return p;
+					}
+				}
+
+				// Chain a new block
+				if (a->block_size == 0) {
+					MU_SET_RESULT(result, MUU_OUT_OF_SPACE)
+					return 0;
+				}
+				// MU_ALLOC may return memory of any alignment (a user-supplied allocator, or 8-byte
+				// aligned malloc on 32-bit Windows), so the block has room for the worst padding
+				size_m extra = align - 1;
+				if (size > MU_SIZE_MAX - MUU_ARENA_HEADER - extra) {
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+					return 0;
+				}
+				size_m bcap = (size + extra > a->block_size) ? size + extra : a->block_size;
+				muArenaBlock* block = (muArenaBlock*)MU_ALLOC(MUU_ARENA_HEADER + bcap);
+				if (!block) {
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+					return 0;
+				}
+				block->prev = a->block;
+				block->capacity = bcap;
+				a->block = block;
+				a->pos = 0;
+
+				data = ((muByte*)block) + MUU_ARENA_HEADER;
+				size_m pad = (align - ((size_m)data & (align - 1))) & (align - 1);
+				a->pos = pad + size;
+				return &data[pad];
+			}
+
+			// @DOCLINE `align` must be a power of two. Upon failure, 0 is returned, and `result` is set to `MUU_OUT_OF_SPACE` if the arena can't chain blocks, or `MUU_ALLOCATION_FAILED` if chaining a block failed. The memory is not zeroed. The alignment doesn't depend on that of the memory returned by `MU_ALLOC`, as chained blocks are made large enough to be padded to any alignment.
+
+			// @DOCLINE The function `muu_arena_alloc_zero` does the same, but zeroes the memory, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void* muu_arena_alloc_zero(muArena* a, size_m size, size_m align, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline void* muu_arena_alloc_zero(muArena* a, size_m size, size_m align, muuResult* result) {
+				void* p = muu_arena_alloc(a, size, align, result);
+				if (p) {
+					mu_memset(p, 0, size);
+				}
+				return p;
+			}
+
+			// @DOCLINE The macro `MU_ARENA_ALLOC(a, type, count, result)` allocates an array of `count` values of type `type`, returning a pointer of type `type*`.
+			#define MU_ARENA_ALLOC(a, type, count, result) ((type*)muu_arena_alloc(a, sizeof(type)*(count), MU_ALIGNOF(type), result))
+
+		// @DOCLINE ## Arena marks
+
+			// @DOCLINE The struct `muArenaMark` holds a saved position of an arena, and has no members meant to be accessed directly.
+
+			struct muArenaMark {
+				muArenaBlock* block;
+				size_m pos;
+			};
+			typedef struct muArenaMark muArenaMark;
+
+			// @DOCLINE The function `muu_arena_mark` returns the current position of an arena, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muArenaMark muu_arena_mark(muArena* a);
+			```
+			@DOCEND */
+
+			MUDEF inline muArenaMark muu_arena_mark(muArena* a) {
+				muArenaMark m;
+				m.block = a->block;
+				m.pos = a->pos;
+				return m;
+			}
+
+			// @DOCLINE The function `muu_arena_restore` restores an arena to a position returned by `muu_arena_mark`, freeing everything allocated since, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_arena_restore(muArena* a, muArenaMark m);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_arena_restore(muArena* a, muArenaMark m) {
+				while (a->block != m.block) {
+					muArenaBlock* prev = a->block->prev;
+					MU_FREE(a->block);
+					a->block = prev;
+				}
+				a->pos = m.pos;
+			}
+
+			// @DOCLINE Marks must be restored in the reverse order that they were made in, and a mark can't be restored once an earlier mark has been restored. Scoped temporary allocations would look like this:
+
+			/* @DOCBEGIN
+			```c
+			muArenaMark m = muu_arena_mark(&arena);
+			// Temporary allocations...
+			muu_arena_restore(&arena, m);
+			```
+			@DOCEND */
+
+			// @DOCLINE The function `muu_arena_reset` frees everything allocated by an arena, including all chained blocks, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_arena_reset(muArena* a);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_arena_reset(muArena* a) {
+				muArenaMark m;
+				m.block = 0;
+				m.pos = 0;
+				muu_arena_restore(a, m);
+			}
+
+			// @DOCLINE The arena can be used again after being reset, and doesn't need to be reset if it never chained any blocks.
+
+	// @DOCLINE # Pool
+
+		// @DOCLINE The `muPool` struct is a fixed-size object allocator, which hands out blocks of one size and alignment, allocated from the backing allocator (`MU_ALLOC`) in slabs of many blocks at a time. Freed blocks are kept in an intrusive free list (the link to the next free block is stored inside the freed block itself), so both allocating and freeing a block are O(1), and memory is only returned to the backing allocator when the whole pool is destroyed.
+
+		// @DOCLINE ## Pool struct
+
+			// @DOCLINE The struct `muPool` has the following members:
+
+			struct muPool {
+				// @DOCLINE * `size_m block_size` - the size of each block, rounded up to hold a pointer and to be a multiple of `align`.
+				size_m block_size;
+				// @DOCLINE * `size_m align` - the alignment of each block, being at least the alignment of a pointer.
+				size_m align;
+				// @DOCLINE * `size_m slab_count` - the amount of blocks allocated per slab.
+				size_m slab_count;
+				// @DOCLINE * `void* free` - the first block of the free list, or 0 if empty.
+				void* free;
+				// @DOCLINE * `void* slabs` - the most recently allocated slab, or 0 if none.
+				void* slabs;
+				// @DOCLINE * `muBool thread_safe` - whether or not the pool is locked upon being accessed.
+				muBool thread_safe;
+				// @DOCLINE * `muSpinLock lock` - the lock used if `thread_safe` is true.
+				muSpinLock lock;
+			};
+			typedef struct muPool muPool;
+
+			// @DOCLINE These members should not be modified directly.
+
+		// @DOCLINE ## Pool initialization
+
+			// @DOCLINE The function `muu_pool_init` initializes a pool, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_pool_init(muPool* p, size_m block_size, size_m align, size_m slab_count, muBool thread_safe);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_pool_init(muPool* p, size_m block_size, size_m align, size_m slab_count, muBool thread_safe) {
+				if (align < MU_ALIGNOF(void*)) {
+					align = MU_ALIGNOF(void*);
+				}
+				if (block_size < sizeof(void*)) {
+					block_size = sizeof(void*);
+				}
+				p->block_size = (block_size + align - 1) & ~(align - 1);
+				p->align = align;
+				p->slab_count = slab_count ? slab_count : 1;
+				p->free = 0;
+				p->slabs = 0;
+				p->thread_safe = thread_safe;
+				muu_spin_lock_init(&p->lock);
+			}
+
+			// @DOCLINE `align` must be a power of two. If `thread_safe` is true, the pool can be accessed from several threads at once, with every access taking a lock; see `muPoolCache` for keeping the lock off the hot path. Thread-safe mode requires atomics (see `MU_ATOMICS`).
+
+			// @DOCLINE The function `muu_pool_destroy` frees all memory allocated by a pool, including all blocks handed out, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_pool_destroy(muPool* p);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_pool_destroy(muPool* p) {
+				while (p->slabs) {
+					void* next = *(void**)p->slabs;
+					MU_FREE(p->slabs);
+					p->slabs = next;
+				}
+				p->free = 0;
+			}
+
+		// @DOCLINE ## Pool allocation
+
+			// Internal locking of the pool, if thread-safe
+			MUDEF inline void muu_inner_pool_lock(muPool* p) {
+				if (p->thread_safe) {
+					muu_spin_lock(&p->lock);
+				}
+			}
+
+			MUDEF inline void muu_inner_pool_unlock(muPool* p) {
+				if (p->thread_safe) {
+					muu_spin_unlock(&p->lock);
+				}
+			}
+
+			// Allocates a new slab and pushes all of its blocks onto the free list;
+			// the pool must be locked
+			MUDEF inline muBool muu_inner_pool_grow(muPool* p) {
+				// The slab starts with a pointer to the previous slab, followed by the
+				// blocks, aligned by hand in case 'align' is larger than what MU_ALLOC
+				// guarantees
+				size_m head = sizeof(void*) + p->align;
+				if (p->slab_count > (MU_SIZE_MAX - head) / p->block_size) {
+					return MU_FALSE;
+				}
+				muByte* slab = (muByte*)MU_ALLOC(head + p->slab_count * p->block_size);
+				if (!slab) {
+					return MU_FALSE;
+				}
+				*(void**)slab = p->slabs;
+				p->slabs = slab;
+
+				muByte* blocks = slab + sizeof(void*);
+				blocks += (p->align - ((size_m)blocks & (p->align - 1))) & (p->align - 1);
+				for (size_m i = p->slab_count; i > 0; --i) {
+					void* b = &blocks[(i-1) * p->block_size];
+					*(void**)b = p->free;
+					p->free = b;
+				}
+				return MU_TRUE;
+			}
+
+			// @DOCLINE The function `muu_pool_alloc` allocates a block from a pool, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void* muu_pool_alloc(muPool* p, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline void* muu_pool_alloc(muPool* p, muuResult* result) {
+				muu_inner_pool_lock(p);
+				if (!p->free && !muu_inner_pool_grow(p)) {
+					muu_inner_pool_unlock(p);
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+					return 0;
+				}
+				void* b = p->free;
+				p->free = *(void**)b;
+				muu_inner_pool_unlock(p);
+				return b;
+			}
+
+			// @DOCLINE Upon failure, 0 is returned, and `result` is set to `MUU_ALLOCATION_FAILED`. The memory is not zeroed.
+
+			// @DOCLINE The function `muu_pool_free` returns a block to a pool, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_pool_free(muPool* p, void* block);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_pool_free(muPool* p, void* block) {
+				muu_inner_pool_lock(p);
+				*(void**)block = p->free;
+				p->free = block;
+				muu_inner_pool_unlock(p);
+			}
+
+		// @DOCLINE ## Pool caches
+
+			// @DOCLINE The `muPoolCache` struct is a per-thread magazine of free blocks for a thread-safe pool. Allocating from and freeing to a cache doesn't take the pool's lock; only when the cache runs empty or grows too full does it exchange a batch of `MU_POOL_MAGAZINE` blocks with the pool, under a single lock. Each thread should have its own cache for each pool (for example, in a thread-local variable), and a cache must never be accessed by more than one thread at once.
+
+			// @DOCLINE The macro `MU_POOL_MAGAZINE` is the amount of blocks exchanged at once, and is overridable; its default value is 32.
+			#ifndef MU_POOL_MAGAZINE
+				#define MU_POOL_MAGAZINE 32
+			#endif
+
+			// @DOCLINE The struct `muPoolCache` has the following members:
+
+			struct muPoolCache {
+				// @DOCLINE * `muPool* pool` - the pool that the cache belongs to.
+				muPool* pool;
+				// @DOCLINE * `void* free` - the first block of the cache's free list, or 0 if empty.
+				void* free;
+				// @DOCLINE * `size_m count` - the amount of blocks in the cache's free list.
+				size_m count;
+			};
+			typedef struct muPoolCache muPoolCache;
+
+			// @DOCLINE The function `muu_pool_cache_init` initializes an empty cache for a pool, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_pool_cache_init(muPoolCache* c, muPool* p);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_pool_cache_init(muPoolCache* c, muPool* p) {
+				c->pool = p;
+				c->free = 0;
+				c->count = 0;
+			}
+
+			// @DOCLINE The function `muu_pool_cache_alloc` allocates a block through a cache, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void* muu_pool_cache_alloc(muPoolCache* c, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline void* muu_pool_cache_alloc(muPoolCache* c, muuResult* result) {
+				if (!c->free) {
+					// Take a batch of blocks from the pool
+					muPool* p = c->pool;
+					muu_inner_pool_lock(p);
+					for (size_m i = 0; i < MU_POOL_MAGAZINE; ++i) {
+						if (!p->free && !muu_inner_pool_grow(p)) {
+							break;
+						}
+						void* b = p->free;
+						p->free = *(void**)b;
+						*(void**)b = c->free;
+						c->free = b;
+						c->count++;
+					}
+					muu_inner_pool_unlock(p);
+
+					if (!c->free) {
+						MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+						return 0;
+					}
+				}
+
+				void* b = c->free;
+				c->free = *(void**)b;
+				c->count--;
+				return b;
+			}
+
+			// @DOCLINE The function `muu_pool_cache_free` frees a block through a cache, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_pool_cache_free(muPoolCache* c, void* block);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_pool_cache_free(muPoolCache* c, void* block) {
+				*(void**)block = c->free;
+				c->free = block;
+				c->count++;
+
+				if (c->count >= 2 * MU_POOL_MAGAZINE) {
+					// Give a batch of blocks back to the pool
+					muPool* p = c->pool;
+					muu_inner_pool_lock(p);
+					for (size_m i = 0; i < MU_POOL_MAGAZINE; ++i) {
+						void* b = c->free;
+						c->free = *(void**)b;
+						*(void**)b = p->free;
+						p->free = b;
+					}
+					muu_inner_pool_unlock(p);
+					c->count -= MU_POOL_MAGAZINE;
+				}
+			}
+
+			// @DOCLINE Blocks can be freed through a different cache (or directly to the pool) than the one they were allocated through.
+
+			// @DOCLINE The function `muu_pool_cache_flush` gives all blocks held by a cache back to its pool, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_pool_cache_flush(muPoolCache* c);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_pool_cache_flush(muPoolCache* c) {
+				muPool* p = c->pool;
+				muu_inner_pool_lock(p);
+				while (c->free) {
+					void* b = c->free;
+					c->free = *(void**)b;
+					*(void**)b = p->free;
+					p->free = b;
+				}
+				muu_inner_pool_unlock(p);
+				c->count = 0;
+			}
+
+			// @DOCLINE This should be called before a thread owning a cache exits.
+
+	// @DOCLINE # Hash map
+
+		// @DOCLINE muUtility provides a type-generic open-addressing hash map in the style of Swiss tables: each slot has a metadata byte holding 7 bits of its key's hash, and lookups compare the metadata of 16 slots at once (with SSE2 on x86 and NEON on AArch64, falling back to a scalar loop otherwise), only comparing keys whose hash bits match. Keys and values are stored inline in one flat allocation, so a lookup usually touches just one metadata group and one slot.
+
+		// @DOCLINE ## Internals
+
+			// Amount of slots in a group
+			#define MUU_MAP_GROUP 16
+
+			// Metadata values; full slots hold the lower 7 bits of their key's hash
+			#define MUU_MAP_EMPTY 0x80
+			#define MUU_MAP_DELETED 0xFE
+
+			#if !defined(MU_NO_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+				#define MUU_MAP_NEON
+				#include <arm_neon.h>
+			#endif
+
+			// Counts trailing zeros of a non-zero value
+			MUDEF inline uint32_m muu_inner_ctz32(uint32_m n) {
+				#if defined(__GNUC__) || defined(__clang__)
+					return (uint32_m)__builtin_ctz(n);
+				#elif defined(_MSC_VER)
+					unsigned long i;
+					_BitScanForward(&i, n);
+					return (uint32_m)i;
+				#else
+					uint32_m i = 0;
+					while (!(n & 1)) {
+						n >>= 1;
+						++i;
+					}
+					return i;
+				#endif
+			}
+
+			#ifdef MUU_MAP_NEON
+				// Turns a NEON comparison result into a bitmask of one bit per byte
+				MUDEF inline uint32_m muu_inner_map_neon_mask(uint8x16_t v) {
+					static const uint8_m w[16] = { 1,2,4,8,16,32,64,128, 1,2,4,8,16,32,64,128 };
+					v = vandq_u8(v, vld1q_u8(w));
+					return (uint32_m)vaddv_u8(vget_low_u8(v)) | ((uint32_m)vaddv_u8(vget_high_u8(v)) << 8);
+				}
+			#endif
+
+			// Group matching; these return a bitmask of the slots in the group at 'c' whose
+			// metadata is 'h2', is empty, or is empty or deleted, respectively
+
+			MUDEF inline uint32_m muu_inner_map_match(muByte* c, muByte h2) {
+				#if defined(MU_SSE2)
+					__m128i g = _mm_loadu_si128((const __m128i*)c);
+					return (uint32_m)_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char)h2)));
+				#elif defined(MUU_MAP_NEON)
+					return muu_inner_map_neon_mask(vceqq_u8(vld1q_u8(c), vdupq_n_u8(h2)));
+				#else
+					uint32_m m = 0;
+					for (uint32_m i = 0; i < MUU_MAP_GROUP; ++i) {
+						m |= (uint32_m)(c[i] == h2) << i;
+					}
+					return m;
+				#endif
+			}
+
+			MUDEF inline uint32_m muu_inner_map_match_empty(muByte* c) {
+				return muu_inner_map_match(c, MUU_MAP_EMPTY);
+			}
+
+			MUDEF inline uint32_m muu_inner_map_match_free(muByte* c) {
+				#if defined(MU_SSE2)
+					return (uint32_m)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)c));
+				#elif defined(MUU_MAP_NEON)
+					return muu_inner_map_neon_mask(vcltzq_s8(vreinterpretq_s8_u8(vld1q_u8(c))));
+				#else
+					uint32_m m = 0;
+					for (uint32_m i = 0; i < MUU_MAP_GROUP; ++i) {
+						m |= (uint32_m)(c[i] >> 7) << i;
+					}
+					return m;
+				#endif
+			}
+
+			// Finds the slot to insert a key with the given hash into; probing visits groups in
+			// triangular order, which visits every group when their amount is a power of 2
+			MUDEF inline size_m muu_inner_map_find_free(muByte* ctrl, size_m capacity, uint64_m h) {
+				size_m mask = capacity / MUU_MAP_GROUP - 1;
+				size_m g = (size_m)(h >> 7) & mask;
+				for (size_m step = 1; ; ++step) {
+					uint32_m bits = muu_inner_map_match_free(&ctrl[g * MUU_MAP_GROUP]);
+					if (bits) {
+						return g * MUU_MAP_GROUP + muu_inner_ctz32(bits);
+					}
+					g = (g + step) & mask;
+				}
+			}
+
+			// Returns the amount of slots that can be filled before a table must grow
+			MUDEF inline size_m muu_inner_map_max_load(size_m capacity) {
+				return capacity - capacity / 8;
+			}
+
+			// Returns the smallest capacity able to hold 'count' elements
+			MUDEF inline size_m muu_inner_map_capacity(size_m count) {
+				size_m capacity = MUU_MAP_GROUP;
+				while (muu_inner_map_max_load(capacity) < count) {
+					capacity *= 2;
+				}
+				return capacity;
+			}
+
+			// Returns the offset of the slots from the metadata
+			MUDEF inline size_m muu_inner_map_slots_offset(size_m capacity, size_m align) {
+				return (capacity + align - 1) & ~(align - 1);
+			}
+
+			// Allocates a table's metadata and slots, marking every slot as empty
+			MUDEF inline muByte* muu_inner_map_alloc(size_m capacity, size_m slot_size, size_m slot_align, muuResult* result) {
+				size_m offset = muu_inner_map_slots_offset(capacity, slot_align);
+				if (slot_size && capacity > (MU_SIZE_MAX - offset) / slot_size) {
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+					return 0;
+				}
+				muByte* ctrl = (muByte*)MU_ALLOC(offset + capacity * slot_size);
+				if (!ctrl) {
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+					return 0;
+				}
+				mu_memset(ctrl, MUU_MAP_EMPTY, capacity);
+				return ctrl;
+			}
+
+			// Marks slot 'i' as free; if its group still has an empty slot, no probe sequence
+			// has ever continued past the group, so the slot can be marked empty again instead
+			// of leaving a tombstone
+			MUDEF inline void muu_inner_map_erase(muByte* ctrl, size_m i, size_m* growth_left) {
+				if (muu_inner_map_match_empty(&ctrl[i & ~(size_m)(MUU_MAP_GROUP-1)])) {
+					ctrl[i] = MUU_MAP_EMPTY;
+					(*growth_left)++;
+				} else {
+					ctrl[i] = MUU_MAP_DELETED;
+				}
+			}
+
+		// @DOCLINE ## Declaring a map
+
+			/* @DOCBEGIN
+
+			The macro `MU_MAP(name, K, V, hash, eq)` declares a hash map type named `name` mapping keys of type `K` to values of type `V`, along with its functions. `hash(key)` must evaluate to a `uint64_m` hash of a key, and `eq(a, b)` must evaluate to non-zero if two keys are equal; both can be functions or function-like macros. For example:
+
+			```c
+			MU_MAP(GlyphMap, uint32_m, Glyph, MU_MAP_HASH_INT, MU_MAP_EQ)
+			```
+
+			The macro `MU_MAP_HASH_INT(key)` hashes an integer key with `muu_hash64_u64`, and the macro `MU_MAP_EQ(a, b)` compares two keys with `==`.
+
+			`MU_MAP` declares the struct `name##_slot`, which has the members `K key` and `V value`, and the struct `name`, which has the following members, which shouldn't be modified directly:
+
+			* `muByte* ctrl` - the metadata of each slot, or 0 if nothing has been allocated yet.
+
+			* `name##_slot* slots` - the slots.
+
+			* `size_m capacity` - the amount of slots; 0 or a power of 2 that's at least 16.
+
+			* `size_m count` - the amount of elements in the map.
+
+			* `size_m growth_left` - the amount of empty slots that can be filled before the map must grow.
+
+			The memory of the map is allocated with `MU_ALLOC` and freed with `MU_FREE` (see the allocation macros). A map holds up to 7/8 of its capacity before growing, at which point its capacity is doubled (or, if enough of its slots are tombstones, it is rehashed at the same capacity). Inserting or removing elements invalidates any pointers into the map only if the map grows or is rehashed.
+
+			@DOCEND */
+
+			#define MU_MAP_HASH_INT(key) muu_hash64_u64((uint64_m)(key), 0)
+			#define MU_MAP_EQ(a, b) ((a) == (b))
+
+			#define MU_MAP(name, K, V, hash, eq) \
+				struct name##_slot { \
+					K key; \
+					V value; \
+				}; \
+				typedef struct name##_slot name##_slot; \
+				\
+				struct name { \
+					muByte* ctrl; \
+					name##_slot* slots; \
+					size_m capacity; \
+					size_m count; \
+					size_m growth_left; \
+				}; \
+				typedef struct name name; \
+				\
+				MUDEF inline void name##_init(name* m) { \
+					m->ctrl = 0; \
+					m->slots = 0; \
+					m->capacity = 0; \
+					m->count = 0; \
+					m->growth_left = 0; \
+				} \
+				\
+				MUDEF inline void name##_destroy(name* m) { \
+					if (m->ctrl) { \
+						MU_FREE(m->ctrl); \
+					} \
+					name##_init(m); \
+				} \
+				\
+				MUDEF inline muBool name##_rehash(name* m, size_m capacity, muuResult* result) { \
+					muByte* ctrl = muu_inner_map_alloc(capacity, sizeof(name##_slot), MU_ALIGNOF(name##_slot), result); \
+					if (!ctrl) { \
+						return MU_FALSE; \
+					} \
+					name##_slot* slots = (name##_slot*)&ctrl[muu_inner_map_slots_offset(capacity, MU_ALIGNOF(name##_slot))]; \
+					for (size_m i = 0; i < m->capacity; ++i) { \
+						if (m->ctrl[i] < MUU_MAP_EMPTY) { \
+							uint64_m h = hash(m->slots[i].key); \
+							size_m j = muu_inner_map_find_free(ctrl, capacity, h); \
+							ctrl[j] = (muByte)(h & 0x7F); \
+							slots[j] = m->slots[i]; \
+						} \
+					} \
+					if (m->ctrl) { \
+						MU_FREE(m->ctrl); \
+					} \
+					m->ctrl = ctrl; \
+					m->slots = slots; \
+					m->capacity = capacity; \
+					m->growth_left = muu_inner_map_max_load(capacity) - m->count; \
+					return MU_TRUE; \
+				} \
+				\
+				MUDEF inline muBool name##_reserve(name* m, size_m count, muuResult* result) { \
+					if (count <= m->count + m->growth_left) { \
+						return MU_TRUE; \
+					} \
+					return name##_rehash(m, muu_inner_map_capacity(count), result); \
+				} \
+				\
+				MUDEF inline size_m muu_inner_##name##_find(name* m, K key, uint64_m h) { \
+					if (!m->count) { \
+						return MU_SIZE_MAX; \
+					} \
+					size_m mask = m->capacity / MUU_MAP_GROUP - 1; \
+					size_m g = (size_m)(h >> 7) & mask; \
+					for (size_m step = 1; ; ++step) { \
+						muByte* c = &m->ctrl[g * MUU_MAP_GROUP]; \
+						for (uint32_m bits = muu_inner_map_match(c, (muByte)(h & 0x7F)); bits; bits &= bits - 1) { \
+							size_m i = g * MUU_MAP_GROUP + muu_inner_ctz32(bits); \
+							if (eq(m->slots[i].key, key)) { \
+								return i; \
+							} \
+						} \
+						if (muu_inner_map_match_empty(c)) { \
+							return MU_SIZE_MAX; \
+						} \
+						g = (g + step) & mask; \
+					} \
+				} \
+				\
+				MUDEF inline V* name##_find(name* m, K key) { \
+					size_m i = muu_inner_##name##_find(m, key, hash(key)); \
+					return (i == MU_SIZE_MAX) ? 0 : &m->slots[i].value; \
+				} \
+				\
+				MUDEF inline V* name##_insert(name* m, K key, V value, muuResult* result) { \
+					uint64_m h = hash(key); \
+					size_m i = muu_inner_##name##_find(m, key, h); \
+					if (i != MU_SIZE_MAX) { \
+						m->slots[i].value = value; \
+						return &m->slots[i].value; \
+					} \
+					i = m->capacity ? muu_inner_map_find_free(m->ctrl, m->capacity, h) : 0; \
+					if (!m->capacity || (m->ctrl[i] == MUU_MAP_EMPTY && !m->growth_left)) { \
+						/* Grow, unless enough of the table is tombstones to just rehash it */ \
+						size_m capacity = m->capacity ? m->capacity : MUU_MAP_GROUP; \
+						if (m->count >= muu_inner_map_max_load(capacity) / 2) { \
+							capacity = muu_inner_map_capacity(m->count + 1); \
+							if (capacity == m->capacity) { \
+								capacity *= 2; \
+							} \
+						} \
+						if (!name##_rehash(m, capacity, result)) { \
+							return 0; \
+						} \
+						i = muu_inner_map_find_free(m->ctrl, m->capacity, h); \
+					} \
+					if (m->ctrl[i] == MUU_MAP_EMPTY) { \
+						m->growth_left--; \
+					} \
+					m->ctrl[i] = (muByte)(h & 0x7F); \
+					m->slots[i].key = key; \
+					m->slots[i].value = value; \
+					m->count++; \
+					return &m->slots[i].value; \
+				} \
+				\
+				MUDEF inline muBool name##_remove(name* m, K key) { \
+					size_m i = muu_inner_##name##_find(m, key, hash(key)); \
+					if (i == MU_SIZE_MAX) { \
+						return MU_FALSE; \
+					} \
+					muu_inner_map_erase(m->ctrl, i, &m->growth_left); \
+					m->count--; \
+					return MU_TRUE; \
+				} \
+				\
+				MUDEF inline void name##_clear(name* m) { \
+					if (m->ctrl) { \
+						mu_memset(m->ctrl, MUU_MAP_EMPTY, m->capacity); \
+						m->growth_left = muu_inner_map_max_load(m->capacity); \
+					} \
+					m->count = 0; \
+				} \
+				\
+				MUDEF inline name##_slot* name##_next(name* m, size_m* i) { \
+					for (; *i < m->capacity; ++*i) { \
+						if (m->ctrl[*i] < MUU_MAP_EMPTY) { \
+							return &m->slots[(*i)++]; \
+						} \
+					} \
+					return 0; \
+				}
+
+		// @DOCLINE ## Map functions
+
+			/* @DOCBEGIN
+
+			`MU_MAP` defines the following functions, in which `name`, `K`, and `V` are replaced with the corresponding parameters:
+
+			```c
+			MUDEF inline void name_init(name* m);
+			MUDEF inline void name_destroy(name* m);
+			MUDEF inline muBool name_reserve(name* m, size_m count, muuResult* result);
+			MUDEF inline muBool name_rehash(name* m, size_m capacity, muuResult* result);
+			MUDEF inline V* name_find(name* m, K key);
+			MUDEF inline V* name_insert(name* m, K key, V value, muuResult* result);
+			MUDEF inline muBool name_remove(name* m, K key);
+			MUDEF inline void name_clear(name* m);
+			MUDEF inline name_slot* name_next(name* m, size_m* i);
+			```
+
+			`name_init` initializes an empty map without allocating anything, and `name_destroy` frees a map's memory and makes it empty.
+
+			`name_reserve` makes sure that a map can hold `count` elements without growing, and `name_rehash` rebuilds a map with a given capacity (which must be a power of 2 that's at least 16 and able to hold the map's elements); both return `MU_FALSE` and set `result` to `MUU_ALLOCATION_FAILED` if allocating fails, leaving the map untouched.
+
+			`name_find` returns a pointer to the value of a key, or 0 if the key isn't in the map.
+
+			`name_insert` sets the value of a key, inserting it if needed, and returns a pointer to the value, or 0 if the map needed to grow and allocating failed (in which case `result` is set to `MUU_ALLOCATION_FAILED`).
+
+			`name_remove` removes a key, returning whether or not it was in the map. If the slot's group has never been full, it is marked empty again; otherwise, it's marked as deleted (a tombstone), which is reclaimed upon the next rehash.
+
+			`name_clear` removes every element, keeping the map's memory.
+
+			`name_next` iterates over the elements of a map in no particular order, returning a pointer to the next slot, or 0 once all elements have been iterated over. `i` is the iteration index, which should be set to 0 before the first call. The map shouldn't be modified while iterating over it, with the exception of setting values and removing the element that was just returned.
+
+			@DOCEND */
+
+	// @DOCLINE # Dynamic array
+
+		// @DOCLINE muUtility provides a type-generic growable array, declared with a macro in the same way as the hash map. Its memory is allocated with `MU_REALLOC` and freed with `MU_FREE` (see the allocation macros), and its capacity doubles when it runs out of space, so that pushing elements takes amortized constant time.
+
+		// Returns the capacity an array should grow to in order to hold 'count' elements of
+		// 'size' bytes, or 0 if it would overflow
+		MUDEF inline size_m muu_inner_array_grow(size_m capacity, size_m count, size_m size) {
+			size_m n = capacity ? capacity : 8;
+			while (n < count) {
+				if (n > MU_SIZE_MAX / 2) {
+					return 0;
+				}
+				n *= 2;
+			}
+			if (n > MU_SIZE_MAX / size) {
+				return 0;
+			}
+			return n;
+		}
+
+		/* @DOCBEGIN
+
+		The macro `MU_ARRAY(name, T)` declares an array type named `name` holding elements of type `T`, along with its functions. For example:
+
+		```c
+		MU_ARRAY(VertexArray, Vertex)
+		```
+
+		The struct `name` has the following members:
+
+		* `T* data` - the elements, or 0 if nothing has been allocated yet.
+
+		* `size_m len` - the amount of elements.
+
+		* `size_m capacity` - the amount of elements that can be held without reallocating.
+
+		`data` and `len` can be freely read, and elements within `len` can be freely modified. `MU_ARRAY` defines the following functions:
+
+		```c
+		MUDEF inline void name_init(name* a);
+		MUDEF inline void name_destroy(name* a);
+		MUDEF inline muBool name_reserve(name* a, size_m capacity, muuResult* result);
+		MUDEF inline muBool name_resize(name* a, size_m len, muuResult* result);
+		MUDEF inline T* name_push(name* a, T value, muuResult* result);
+		MUDEF inline T* name_insert(name* a, size_m i, T value, muuResult* result);
+		MUDEF inline void name_remove(name* a, size_m i);
+		MUDEF inline void name_remove_swap(name* a, size_m i);
+		MUDEF inline muBool name_shrink(name* a, muuResult* result);
+		MUDEF inline void name_clear(name* a);
+		```
+
+		`name_init` initializes an empty array without allocating anything, and `name_destroy` frees an array's memory and makes it empty.
+
+		`name_reserve` makes sure that the array can hold at least `capacity` elements without reallocating, and `name_resize` sets the amount of elements (leaving new elements uninitialized). `name_push` appends an element, and `name_insert` inserts an element at index `i` (which can be at most `len`), moving the elements after it; both return a pointer to the new element. If allocating fails, these set `result` to `MUU_ALLOCATION_FAILED` and return `MU_FALSE` or 0, leaving the array untouched.
+
+		`name_remove` removes the element at index `i`, moving the elements after it, and `name_remove_swap` removes the element at index `i` by moving the last element into its place, which doesn't preserve the order of the elements but takes constant time.
+
+		`name_shrink` reallocates the array to fit its elements exactly, freeing its memory if it's empty, and `name_clear` removes every element, keeping the array's memory.
+
+		Pointers to elements are invalidated whenever the array is reallocated; see the stable array below for an array whose elements never move.
+
+		@DOCEND */
+
+		#define MU_ARRAY(name, T) \
+			struct name { \
+				T* data; \
+				size_m len; \
+				size_m capacity; \
+			}; \
+			typedef struct name name; \
+			\
+			MUDEF inline void name##_init(name* a) { \
+				a->data = 0; \
+				a->len = 0; \
+				a->capacity = 0; \
+			} \
+			\
+			MUDEF inline void name##_destroy(name* a) { \
+				if (a->data) { \
+					MU_FREE(a->data); \
+				} \
+				name##_init(a); \
+			} \
+			\
+			MUDEF inline muBool name##_reserve(name* a, size_m capacity, muuResult* result) { \
+				if (capacity <= a->capacity) { \
+					return MU_TRUE; \
+				} \
+				size_m n = muu_inner_array_grow(a->capacity, capacity, sizeof(T)); \
+				T* data = n ? (T*)MU_REALLOC(a->data, n * sizeof(T)) : 0; \
+				if (!data) { \
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED) \
+					return MU_FALSE; \
+				} \
+				a->data = data; \
+				a->capacity = n; \
+				return MU_TRUE; \
+			} \
+			\
+			MUDEF inline muBool name##_resize(name* a, size_m len, muuResult* result) { \
+				if (!name##_reserve(a, len, result)) { \
+					return MU_FALSE; \
+				} \
+				a->len = len; \
+				return MU_TRUE; \
+			} \
+			\
+			MUDEF inline T* name##_push(name* a, T value, muuResult* result) { \
+				if (a->len == a->capacity && !name##_reserve(a, a->len + 1, result)) { \
+					return 0; \
+				} \
+				a->data[a->len] = value; \
+				return &a->data[a->len++]; \
+			} \
+			\
+			MUDEF inline T* name##_insert(name* a, size_m i, T value, muuResult* result) { \
+				if (a->len == a->capacity && !name##_reserve(a, a->len + 1, result)) { \
+					return 0; \
+				} \
+				mu_memmove(&a->data[i + 1], &a->data[i], (a->len - i) * sizeof(T)); \
+				a->data[i] = value; \
+				a->len++; \
+				return &a->data[i]; \
+			} \
+			\
+			MUDEF inline void name##_remove(name* a, size_m i) { \
+				mu_memmove(&a->data[i], &a->data[i + 1], (a->len - i - 1) * sizeof(T)); \
+				a->len--; \
+			} \
+			\
+			MUDEF inline void name##_remove_swap(name* a, size_m i) { \
+				a->data[i] = a->data[--a->len]; \
+			} \
+			\
+			MUDEF inline muBool name##_shrink(name* a, muuResult* result) { \
+				if (a->len == a->capacity) { \
+					return MU_TRUE; \
+				} \
+				if (!a->len) { \
+					name##_destroy(a); \
+					return MU_TRUE; \
+				} \
+				T* data = (T*)MU_REALLOC(a->data, a->len * sizeof(T)); \
+				if (!data) { \
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED) \
+					return MU_FALSE; \
+				} \
+				a->data = data; \
+				a->capacity = a->len; \
+				return MU_TRUE; \
+			} \
+			\
+			MUDEF inline void name##_clear(name* a) { \
+				a->len = 0; \
+			}
+
+	// @DOCLINE # Stable array
+
+		// @DOCLINE muUtility defines an optional array variant that reserves a large range of virtual memory up front and commits pages to it as it grows, so that growing it never copies its elements and pointers to them stay valid for the array's whole lifetime. It is only defined if `MU_LINUX` is defined, and if `MU_VIRTUAL_MEMORY` is defined before the inclusion of muUtility, as it relies on the POSIX headers `unistd.h` and `sys/mman.h` (with the same note about feature-test macros as mapped files).
+
+		#if defined(MU_LINUX) && defined(MU_VIRTUAL_MEMORY)
+
+			#include <unistd.h>
+			#include <sys/mman.h>
+
+		// @DOCLINE ## Virtual memory
+
+			// @DOCLINE The following functions are used by the stable array, and can be used directly to manage reserved ranges of virtual memory. Pointers and sizes passed to them don't need to be page-aligned: committing affects every page that the given range touches, while decommitting only affects the pages that lie entirely within it, so that neither ever makes memory outside of the range inaccessible.
+
+			// @DOCLINE The function `muu_vmem_page_size` returns the size of a page, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline size_m muu_vmem_page_size(void);
+			```
+			@DOCEND */
+
+			MUDEF inline size_m muu_vmem_page_size(void) {
+				long n = sysconf(_SC_PAGESIZE);
+				return (n > 0) ? (size_m)n : 4096;
+			}
+
+			// @DOCLINE The function `muu_vmem_reserve` reserves `size` bytes of address space without making any of it accessible or backing it with memory, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void* muu_vmem_reserve(size_m size, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline void* muu_vmem_reserve(size_m size, muuResult* result) {
+				void* p = mmap(0, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+				if (p == MAP_FAILED) {
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+					return 0;
+				}
+				return p;
+			}
+
+			// @DOCLINE The function `muu_vmem_commit` makes `size` bytes of a reserved range readable and writable, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_vmem_commit(void* p, size_m size, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_vmem_commit(void* p, size_m size, muuResult* result) {
+				if (size == 0) {
+					return MU_TRUE;
+				}
+				// Round the start down and the end up, as mprotect needs a page-aligned address
+				size_m page = muu_vmem_page_size();
+				size_m start = (size_m)p & ~(page - 1);
+				size_m end = ((size_m)p + size + page - 1) & ~(page - 1);
+				if (mprotect((void*)start, end - start, PROT_READ | PROT_WRITE) != 0) {
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+					return MU_FALSE;
+				}
+				return MU_TRUE;
+			}
+
+			// @DOCLINE Committed pages are backed by zeroed memory upon first being touched.
+
+			// @DOCLINE The function `muu_vmem_decommit` gives the memory of `size` bytes of a reserved range back to the system and makes them inaccessible, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_vmem_decommit(void* p, size_m size);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_vmem_decommit(void* p, size_m size) {
+				// Round the start up and the end down, as pages only partly within the range may
+				// still be in use
+				size_m page = muu_vmem_page_size();
+				size_m start = ((size_m)p + page - 1) & ~(page - 1);
+				size_m end = ((size_m)p + size) & ~(page - 1);
+				if (end > start) {
+					madvise((void*)start, end - start, MADV_DONTNEED);
+					mprotect((void*)start, end - start, PROT_NONE);
+				}
+			}
+
+			// @DOCLINE The function `muu_vmem_release` releases a reserved range, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_vmem_release(void* p, size_m size);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_vmem_release(void* p, size_m size) {
+				munmap(p, size);
+			}
+
+			// Returns the amount of bytes that should be committed in order to hold 'need' bytes,
+			// given that 'committed' bytes already are and 'reserved' bytes can be at most;
+			// commits at least double the current amount to keep the amount of calls low
+			MUDEF inline size_m muu_inner_vmem_grow(size_m committed, size_m need, size_m reserved) {
+				size_m page = muu_vmem_page_size();
+				size_m n = committed ? committed * 2 : page * 16;
+				if (n < need) {
+					n = need;
+				}
+				n = (n + page - 1) & ~(page - 1);
+				return (n > reserved) ? reserved : n;
+			}
+
+		// @DOCLINE ## Declaring a stable array
+
+			/* @DOCBEGIN
+
+			The macro `MU_STABLE_ARRAY(name, T)` declares a stable array type named `name` holding elements of type `T`, along with its functions. The struct `name` has the members `T* data`, `size_m len`, and `size_m capacity`, with the same meanings as for `MU_ARRAY`, as well as `size_m max`, the maximum amount of elements that the array can hold. `MU_STABLE_ARRAY` defines the following functions:
+
+			```c
+			MUDEF inline muBool name_init(name* a, size_m max, muuResult* result);
+			MUDEF inline void name_destroy(name* a);
+			MUDEF inline muBool name_reserve(name* a, size_m capacity, muuResult* result);
+			MUDEF inline muBool name_resize(name* a, size_m len, muuResult* result);
+			MUDEF inline T* name_push(name* a, T value, muuResult* result);
+			MUDEF inline T* name_insert(name* a, size_m i, T value, muuResult* result);
+			MUDEF inline void name_remove(name* a, size_m i);
+			MUDEF inline void name_remove_swap(name* a, size_m i);
+			MUDEF inline void name_shrink(name* a);
+			MUDEF inline void name_clear(name* a);
+			```
+
+			`name_init` reserves address space for `max` elements, returning `MU_FALSE` and setting `result` to `MUU_ALLOCATION_FAILED` if reserving fails. Reserving address space is cheap, and only committed pages use memory, so `max` can be generous (for example, several gigabytes' worth of elements on a 64-bit system). `name_destroy` releases the reserved address space.
+
+			The other functions behave like their `MU_ARRAY` counterparts, except that growing commits more pages in place instead of reallocating, so the address of each element never changes, and growing past `max` elements fails with `MUU_OUT_OF_SPACE`. `name_shrink` decommits the pages past the ones needed by the elements.
+
+			@DOCEND */
+
+			#define MU_STABLE_ARRAY(name, T) \
+				struct name { \
+					T* data; \
+					size_m len; \
+					size_m capacity; \
+					size_m max; \
+				}; \
+				typedef struct name name; \
+				\
+				MUDEF inline muBool name##_init(name* a, size_m max, muuResult* result) { \
+					size_m page = muu_vmem_page_size(); \
+					a->data = 0; \
+					a->len = 0; \
+					a->capacity = 0; \
+					a->max = 0; \
+					if (max > (MU_SIZE_MAX - page) / sizeof(T)) { \
+						MU_SET_RESULT(result, MUU_ALLOCATION_FAILED) \
+						return MU_FALSE; \
+					} \
+					size_m size = (max * sizeof(T) + page - 1) & ~(page - 1); \
+					a->data = (T*)muu_vmem_reserve(size, result); \
+					if (!a->data) { \
+						return MU_FALSE; \
+					} \
+					a->max = max; \
+					return MU_TRUE; \
+				} \
+				\
+				MUDEF inline void name##_destroy(name* a) { \
+					if (a->data) { \
+						size_m page = muu_vmem_page_size(); \
+						muu_vmem_release(a->data, (a->max * sizeof(T) + page - 1) & ~(page - 1)); \
+					} \
+					a->data = 0; \
+					a->len = 0; \
+					a->capacity = 0; \
+					a->max = 0; \
+				} \
+				\
+				MUDEF inline muBool name##_reserve(name* a, size_m capacity, muuResult* result) { \
+					if (capacity <= a->capacity) { \
+						return MU_TRUE; \
+					} \
+					if (capacity > a->max) { \
+						MU_SET_RESULT(result, MUU_OUT_OF_SPACE) \
+						return MU_FALSE; \
+					} \
+					size_m page = muu_vmem_page_size(); \
+					size_m committed = (a->capacity * sizeof(T) + page - 1) & ~(page - 1); \
+					size_m reserved = (a->max * sizeof(T) + page - 1) & ~(page - 1); \
+					size_m n = muu_inner_vmem_grow(committed, capacity * sizeof(T), reserved); \
+					if (!muu_vmem_commit((muByte*)a->data + committed, n - committed, result)) { \
+						return MU_FALSE; \
+					} \
+					a->capacity = n / sizeof(T); \
+					if (a->capacity > a->max) { \
+						a->capacity = a->max; \
+					} \
+					return MU_TRUE; \
+				} \
+				\
+				MUDEF inline muBool name##_resize(name* a, size_m len, muuResult* result) { \
+					if (!name##_reserve(a, len, result)) { \
+						return MU_FALSE; \
+					} \
+					a->len = len; \
+					return MU_TRUE; \
+				} \
+				\
+				MUDEF inline T* name##_push(name* a, T value, muuResult* result) { \
+					if (a->len == a->capacity && !name##_reserve(a, a->len + 1, result)) { \
+						return 0; \
+					} \
+					a->data[a->len] = value; \
+					return &a->data[a->len++]; \
+				} \
+				\
+				MUDEF inline T* name##_insert(name* a, size_m i, T value, muuResult* result) { \
+					if (a->len == a->capacity && !name##_reserve(a, a->len + 1, result)) { \
+						return 0; \
+					} \
+					mu_memmove(&a->data[i + 1], &a->data[i], (a->len - i) * sizeof(T)); \
+					a->data[i] = value; \
+					a->len++; \
+					return &a->data[i]; \
+				} \
+				\
+				MUDEF inline void name##_remove(name* a, size_m i) { \
+					mu_memmove(&a->data[i], &a->data[i + 1], (a->len - i - 1) * sizeof(T)); \
+					a->len--; \
+				} \
+				\
+				MUDEF inline void name##_remove_swap(name* a, size_m i) { \
+					a->data[i] = a->data[--a->len]; \
+				} \
+				\
+				MUDEF inline void name##_shrink(name* a) { \
+					size_m page = muu_vmem_page_size(); \
+					size_m committed = (a->capacity * sizeof(T) + page - 1) & ~(page - 1); \
+					size_m needed = (a->len * sizeof(T) + page - 1) & ~(page - 1); \
+					if (needed < committed) { \
+						muu_vmem_decommit((muByte*)a->data + needed, committed - needed); \
+						a->capacity = needed / sizeof(T); \
+					} \
+				} \
+				\
+				MUDEF inline void name##_clear(name* a) { \
+					a->len = 0; \
+				}
+
+		#endif /* MU_LINUX && MU_VIRTUAL_MEMORY */
+
+	// @DOCLINE # Ring buffers
+
+		// @DOCLINE muUtility provides two bounded lock-free queues for handing data between threads: a byte ring for a single producer and a single consumer, and a queue of fixed-size records for any amount of producers and consumers. Both allocate their memory once upon initialization with `MU_ALLOC`, never block, and are only safe to use from several threads if `MU_ATOMICS` is defined.
+
+		// @DOCLINE The macro `MU_CACHE_LINE` (overridable, 64 by default) is the size of a cache line; the indices written by different threads are separated by at least this many bytes, so that one thread writing its index doesn't evict the cache line holding the other's.
+
+		#ifndef MU_CACHE_LINE
+			#define MU_CACHE_LINE 64
+		#endif
+
+		// Rounds a ring capacity up to a power of two, returning 0 if it doesn't fit the
+		// 32-bit wrapping indices (whose differences must stay below 2^31)
+		MUDEF inline uint32_m muu_inner_ring_capacity(size_m capacity) {
+			if (capacity > 0x80000000u) {
+				return 0;
+			}
+			uint32_m n = 1;
+			while (n < capacity) {
+				n <<= 1;
+			}
+			return n;
+		}
+
+		// Allocates 'count' elements of 'size' bytes, or returns 0 if 'count' is 0 or the
+		// total size would overflow
+		MUDEF inline void* muu_inner_ring_alloc(size_m count, size_m size) {
+			if (!count || count > MU_SIZE_MAX / size) {
+				return 0;
+			}
+			return MU_ALLOC(count * size);
+		}
+
+		// @DOCLINE ## Byte ring
+
+			// @DOCLINE The struct `muByteRing` is a bounded single-producer single-consumer queue of bytes. It has the following members:
+
+			struct muByteRing {
+				// @DOCLINE * `muByte* data` - the ring's memory.
+				muByte* data;
+				// @DOCLINE * `uint32_m capacity` - the size of `data`, being a power of two.
+				uint32_m capacity;
+				muByte pad0[MU_CACHE_LINE];
+				// @DOCLINE * `muAtomic32 write` - the total amount of bytes committed by the producer, wrapping around.
+				muAtomic32 write;
+				// @DOCLINE * `uint32_m read_cache` - the producer's last known value of `read`.
+				uint32_m read_cache;
+				muByte pad1[MU_CACHE_LINE];
+				// @DOCLINE * `muAtomic32 read` - the total amount of bytes committed by the consumer, wrapping around.
+				muAtomic32 read;
+				// @DOCLINE * `uint32_m write_cache` - the consumer's last known value of `write`.
+				uint32_m write_cache;
+				muByte pad2[MU_CACHE_LINE];
+			};
+			typedef struct muByteRing muByteRing;
+
+			// @DOCLINE These members should not be modified directly. The producer and consumer each only read the other's index when their cached copy of it says that there isn't enough data or space, so a stream of writes and reads only synchronizes once every time the ring fills up or runs dry, rather than once per operation.
+
+			// @DOCLINE The function `muu_byte_ring_init` initializes a byte ring, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_byte_ring_init(muByteRing* r, size_m capacity, muuResult* result);
+			```
+			@DOCEND */
+
+			MUDEF inline muBool muu_byte_ring_init(muByteRing* r, size_m capacity, muuResult* result) {
+				uint32_m n = muu_inner_ring_capacity(capacity);
+				r->data = (muByte*)muu_inner_ring_alloc(n, 1);
+				if (!r->data) {
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+					return MU_FALSE;
+				}
+				r->capacity = n;
+				mu_atomic_store32(&r->write, 0, MU_ATOMIC_RELAXED);
+				mu_atomic_store32(&r->read, 0, MU_ATOMIC_RELAXED);
+				r->read_cache = 0;
+				r->write_cache = 0;
+				return MU_TRUE;
+			}
+
+			// @DOCLINE `capacity` is rounded up to a power of two, and can be at most 2^31. If allocating fails, `result` is set to `MUU_ALLOCATION_FAILED` and `MU_FALSE` is returned.
+
+			// @DOCLINE The function `muu_byte_ring_destroy` frees a byte ring's memory, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_byte_ring_destroy(muByteRing* r);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_byte_ring_destroy(muByteRing* r) {
+				if (r->data) {
+					MU_FREE(r->data);
+					r->data = 0;
+				}
+			}
+
+			// @DOCLINE ### Producing
+
+				// Free space as seen by the producer, refreshing its copy of 'read' if the
+				// cached copy shows less than 'want' bytes free
+				MUDEF inline uint32_m muu_inner_byte_ring_space(muByteRing* r, uint32_m w, size_m want) {
+					uint32_m space = r->capacity - (w - r->read_cache);
+					if (space < want) {
+						r->read_cache = mu_atomic_load32(&r->read, MU_ATOMIC_ACQUIRE);
+						space = r->capacity - (w - r->read_cache);
+					}
+					return space;
+				}
+
+				// @DOCLINE The function `muu_byte_ring_write_begin` returns a pointer to contiguous free space in a byte ring that can be written to directly, defined below:
+
+				/* @DOCBEGIN
+				```c
+				MUDEF inline muByte* muu_byte_ring_write_begin(muByteRing* r, size_m* len);
+				```
+				@DOCEND */
+
+				MUDEF inline muByte* muu_byte_ring_write_begin(muByteRing* r, size_m* len) {
+					uint32_m w = mu_atomic_load32(&r->write, MU_ATOMIC_RELAXED);
+					uint32_m space = muu_inner_byte_ring_space(r, w, *len);
+					uint32_m i = w & (r->capacity - 1);
+					uint32_m contiguous = r->capacity - i;
+					*len = space < contiguous ? space : contiguous;
+					return r->data + i;
+				}
+
+				// @DOCLINE `len` should point to the amount of bytes desired, and is set to the amount of bytes available at the returned pointer, which can be less than desired (0 if the ring is full), or more. The available space stops at the end of the ring's memory even if there's free space wrapping around to its start, which a second call after committing returns.
+
+				// @DOCLINE The function `muu_byte_ring_write_commit` makes bytes written after `muu_byte_ring_write_begin` visible to the consumer, defined below:
+
+				/* @DOCBEGIN
+				```c
+				MUDEF inline void muu_byte_ring_write_commit(muByteRing* r, size_m len);
+				```
+				@DOCEND */
+
+				MUDEF inline void muu_byte_ring_write_commit(muByteRing* r, size_m len) {
+					uint32_m w = mu_atomic_load32(&r->write, MU_ATOMIC_RELAXED);
+					mu_atomic_store32(&r->write, w + (uint32_m)len, MU_ATOMIC_RELEASE);
+				}
+
+				// @DOCLINE `len` must be at most the amount of bytes returned as available. Committing is a single store, so it's cheaper to write many bytes and commit them together than to commit them piece by piece.
+
+				// @DOCLINE The function `muu_byte_ring_write` copies bytes into a byte ring, defined below:
+
+				/* @DOCBEGIN
+				```c
+				MUDEF inline size_m muu_byte_ring_write(muByteRing* r, const muByte* b, size_m len);
+				```
+				@DOCEND */
+
+				MUDEF inline size_m muu_byte_ring_write(muByteRing* r, const muByte* b, size_m len) {
+					uint32_m w = mu_atomic_load32(&r->write, MU_ATOMIC_RELAXED);
+					uint32_m space = muu_inner_byte_ring_space(r, w, len);
+					if (len > space) {
+						len = space;
+					}
+					uint32_m i = w & (r->capacity - 1);
+					size_m first = r->capacity - i;
+					if (first > len) {
+						first = len;
+					}
+					mu_memcpy(r->data + i, b, first);
+					mu_memcpy(r->data, b + first, len - first);
+					mu_atomic_store32(&r->write, w + (uint32_m)len, MU_ATOMIC_RELEASE);
+					return len;
+				}
+
+				// @DOCLINE As many bytes as there's space for (up to `len`) are copied, wrapping around the end of the ring's memory, and committed at once; the amount copied is returned.
+
+			// @DOCLINE ### Consuming
+
+				// Data available as seen by the consumer, refreshing its copy of 'write' if
+				// the cached copy shows less than 'want' bytes available
+				MUDEF inline uint32_m muu_inner_byte_ring_data(muByteRing* r, uint32_m rd, size_m want) {
+					uint32_m avail = r->write_cache - rd;
+					if (avail < want) {
+						r->write_cache = mu_atomic_load32(&r->write, MU_ATOMIC_ACQUIRE);
+						avail = r->write_cache - rd;
+					}
+					return avail;
+				}
+
+				// @DOCLINE The function `muu_byte_ring_read_begin` returns a pointer to contiguous data in a byte ring that can be read directly, defined below:
+
+				/* @DOCBEGIN
+				```c
+				MUDEF inline const muByte* muu_byte_ring_read_begin(muByteRing* r, size_m* len);
+				```
+				@DOCEND */
+
+				MUDEF inline const muByte* muu_byte_ring_read_begin(muByteRing* r, size_m* len) {
+					uint32_m rd = mu_atomic_load32(&r->read, MU_ATOMIC_RELAXED);
+					uint32_m avail = muu_inner_byte_ring_data(r, rd, *len);
+					uint32_m i = rd & (r->capacity - 1);
+					uint32_m contiguous = r->capacity - i;
+					*len = avail < contiguous ? avail : contiguous;
+					return r->data + i;
+				}
+
+				// @DOCLINE `len` works the same way as in `muu_byte_ring_write_begin`, being set to 0 if the ring is empty. The returned data can be read with the byte accessors or a `muByteReader` until it's committed.
+
+				// @DOCLINE The function `muu_byte_ring_read_commit` frees bytes read after `muu_byte_ring_read_begin` for the producer to reuse, defined below:
+
+				/* @DOCBEGIN
+				```c
+				MUDEF inline void muu_byte_ring_read_commit(muByteRing* r, size_m len);
+				```
+				@DOCEND */
+
+				MUDEF inline void muu_byte_ring_read_commit(muByteRing* r, size_m len) {
+					uint32_m rd = mu_atomic_load32(&r->read, MU_ATOMIC_RELAXED);
+					mu_atomic_store32(&r->read, rd + (uint32_m)len, MU_ATOMIC_RELEASE);
+				}
+
+				// @DOCLINE The function `muu_byte_ring_read` copies bytes out of a byte ring, defined below:
+
+				/* @DOCBEGIN
+				```c
+				MUDEF inline size_m muu_byte_ring_read(muByteRing* r, muByte* b, size_m len);
+				```
+				@DOCEND */
+
+				MUDEF inline size_m muu_byte_ring_read(muByteRing* r, muByte* b, size_m len) {
+					uint32_m rd = mu_atomic_load32(&r->read, MU_ATOMIC_RELAXED);
+					uint32_m avail = muu_inner_byte_ring_data(r, rd, len);
+					if (len > avail) {
+						len = avail;
+					}
+					uint32_m i = rd & (r->capacity - 1);
+					size_m first = r->capacity - i;
+					if (first > len) {
+						first = len;
+					}
+					mu_memcpy(b, r->data + i, first);
+					mu_memcpy(b + first, r->data, len - first);
+					mu_atomic_store32(&r->read, rd + (uint32_m)len, MU_ATOMIC_RELEASE);
+					return len;
+				}
+
+				// @DOCLINE As many bytes as are available (up to `len`) are copied and committed at once; the amount copied is returned.
+
+		// @DOCLINE ## Record queue
+
+			/* @DOCBEGIN
+
+			The macro `MU_QUEUE(name, T)` declares a bounded multi-producer multi-consumer queue type named `name` holding records of type `T`, along with its functions, in the same way as the dynamic array. For example:
+
+			```c
+			MU_QUEUE(JobQueue, Job)
+			```
+
+			It's implemented as an array of cells, each holding a record and a sequence number that tells which lap around the array the cell is on and whether it's full. Producers and consumers claim positions with a compare-and-swap on a shared index, and then hand the cell to the other side with a single store of its sequence number, so threads working on different cells never wait on each other. The members of the struct `name` should not be accessed directly. `MU_QUEUE` defines the following functions:
+
+			```c
+			MUDEF inline muBool name_init(name* q, size_m capacity, muuResult* result);
+			MUDEF inline void name_destroy(name* q);
+			MUDEF inline muBool name_push(name* q, const T* value);
+			MUDEF inline muBool name_pop(name* q, T* value);
+			```
+
+			`name_init` initializes a queue that can hold `capacity` records (rounded up to a power of two that's at least 2, being at most 2^31), setting `result` to `MUU_ALLOCATION_FAILED` and returning `MU_FALSE` if allocating fails. `name_destroy` frees a queue's memory, and must only be called once no thread accesses it anymore.
+
+			`name_push` copies a record into the queue, returning `MU_FALSE` if it's full, and `name_pop` copies the oldest record out of the queue, returning `MU_FALSE` if it's empty. Neither blocks; threads that need to wait for space or records are expected to retry (calling `mu_pause` in between) or to sleep on their own synchronization.
+
+			@DOCEND */
+
+			#define MU_QUEUE(name, T) \
+				struct name##_cell { \
+					muAtomic32 seq; \
+					T value; \
+				}; \
+				typedef struct name##_cell name##_cell; \
+				\
+				struct name { \
+					name##_cell* cells; \
+					uint32_m mask; \
+					muByte pad0[MU_CACHE_LINE]; \
+					muAtomic32 push_pos; \
+					muByte pad1[MU_CACHE_LINE]; \
+					muAtomic32 pop_pos; \
+					muByte pad2[MU_CACHE_LINE]; \
+				}; \
+				typedef struct name name; \
+				\
+				MUDEF inline muBool name##_init(name* q, size_m capacity, muuResult* result) { \
+					uint32_m n = muu_inner_ring_capacity(capacity < 2 ? 2 : capacity); \
+					q->cells = (name##_cell*)muu_inner_ring_alloc(n, sizeof(name##_cell)); \
+					if (!q->cells) { \
+						MU_SET_RESULT(result, MUU_ALLOCATION_FAILED) \
+						return MU_FALSE; \
+					} \
+					for (uint32_m i = 0; i < n; ++i) { \
+						mu_atomic_store32(&q->cells[i].seq, i, MU_ATOMIC_RELAXED); \
+					} \
+					q->mask = n - 1; \
+					mu_atomic_store32(&q->push_pos, 0, MU_ATOMIC_RELAXED); \
+					mu_atomic_store32(&q->pop_pos, 0, MU_ATOMIC_RELAXED); \
+					return MU_TRUE; \
+				} \
+				\
+				MUDEF inline void name##_destroy(name* q) { \
+					if (q->cells) { \
+						MU_FREE(q->cells); \
+						q->cells = 0; \
+					} \
+				} \
+				\
+				MUDEF inline muBool name##_push(name* q, const T* value) { \
+					uint32_m pos = mu_atomic_load32(&q->push_pos, MU_ATOMIC_RELAXED); \
+					name##_cell* c; \
+					for (;;) { \
+						c = &q->cells[pos & q->mask]; \
+						int32_m diff = (int32_m)(mu_atomic_load32(&c->seq, MU_ATOMIC_ACQUIRE) - pos); \
+						if (diff == 0) { \
+							if (mu_atomic_cas32(&q->push_pos, &pos, pos + 1, MU_ATOMIC_RELAXED)) { \
+								break; \
+							} \
+						} else if (diff < 0) { \
+							return MU_FALSE; \
+						} else { \
+							pos = mu_atomic_load32(&q->push_pos, MU_ATOMIC_RELAXED); \
+						} \
+					} \
+					c->value = *value; \
+					mu_atomic_store32(&c->seq, pos + 1, MU_ATOMIC_RELEASE); \
+					return MU_TRUE; \
+				} \
+				\
+				MUDEF inline muBool name##_pop(name* q, T* value) { \
+					uint32_m pos = mu_atomic_load32(&q->pop_pos, MU_ATOMIC_RELAXED); \
+					name##_cell* c; \
+					for (;;) { \
+						c = &q->cells[pos & q->mask]; \
+						int32_m diff = (int32_m)(mu_atomic_load32(&c->seq, MU_ATOMIC_ACQUIRE) - (pos + 1)); \
+						if (diff == 0) { \
+							if (mu_atomic_cas32(&q->pop_pos, &pos, pos + 1, MU_ATOMIC_RELAXED)) { \
+								break; \
+							} \
+						} else if (diff < 0) { \
+							return MU_FALSE; \
+						} else { \
+							pos = mu_atomic_load32(&q->pop_pos, MU_ATOMIC_RELAXED); \
+						} \
+					} \
+					*value = c->value; \
+					mu_atomic_store32(&c->seq, pos + q->mask + 1, MU_ATOMIC_RELEASE); \
+					return MU_TRUE; \
+				}
+
+	// @DOCLINE # Profiling
+
+		// @DOCLINE muUtility provides an optional profiling layer that records when named zones of code begin and end on each thread, and exports the recorded events in the Chrome trace event format, which can be viewed in `chrome://tracing`, Perfetto, or Speedscope. It is enabled by defining `MU_PROFILE` before the inclusion of muUtility; otherwise, the profiling macros expand to nothing, and the profiling functions aren't defined. It requires `MU_ATOMICS` and `MU_THREAD_LOCAL`, and enabling it is a compile error if either isn't available for the compiler and standard in use.
+
+		// @DOCLINE The recorded events are kept in a single state per copy of the profiling functions. In C++, that is one state for the whole program, as the copies in each translation unit are merged. In C, however, several translation units can only include muUtility under `MU_STATIC`, which gives every translation unit its own copy, and so by default its own events: `muu_profile_export` and `muu_profile_free` only see the events recorded from the translation unit that calls them. To share the events across translation units, define `MU_PROFILE_SHARED_STATE` before every inclusion of muUtility, and `MU_PROFILE_SHARED_STATE_DEFINE` before exactly one of them, which defines the shared state.
+
+		// @DOCLINE ## Thread-local storage
+
+			// @DOCLINE The macro `MU_THREAD_LOCAL` is placed before a static or global variable's type to give each thread its own copy of it, and is overridable. It maps to `thread_local` in C++11, `_Thread_local` in C11, and compiler extensions otherwise; it is left undefined if none are available.
+
+			#ifndef MU_THREAD_LOCAL
+				#if defined(__cplusplus) && (__cplusplus >= 201103L)
+					#define MU_THREAD_LOCAL thread_local
+				#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+					#define MU_THREAD_LOCAL _Thread_local
+				#elif defined(__GNUC__) || defined(__clang__)
+					#define MU_THREAD_LOCAL __thread
+				#elif defined(_MSC_VER)
+					#define MU_THREAD_LOCAL __declspec(thread)
+				#endif
+			#endif
+
+			// Token concatenation after expansion
+			#define MUU_CAT2(a, b) a##b
+			#define MUU_CAT(a, b) MUU_CAT2(a, b)
+
+		// @DOCLINE ## Zones
+
+			/* @DOCBEGIN
+
+			The following macros mark zones of code:
+
+			* `MU_PROFILE_BEGIN(name)` - marks the beginning of a zone named `name` on the current thread.
+
+			* `MU_PROFILE_END(name)` - marks the end of the most recently begun zone on the current thread; `name` should match the name it was begun with.
+
+			* `MU_PROFILE_SCOPE(name)` - begins a zone, and ends it automatically when the current scope exits; only available in C++ and with GCC or Clang, since it relies on destructors or `__attribute__((cleanup))`.
+
+			Zones can be nested, but must end in the reverse order that they began on each thread. `name` must be a string that stays valid until the events are exported, such as a string literal. For example:
+
+			```c
+			MU_PROFILE_BEGIN("load textures");
+			for (size_m i = 0; i < count; ++i) {
+				MU_PROFILE_SCOPE("decode");
+				decode(&textures[i]);
+			}
+			MU_PROFILE_END("load textures");
+			```
+
+			Recording an event takes a clock read (see `muu_time_ns`) and a store into a buffer owned by the current thread, without any locks or atomic read-modify-write operations; a thread only synchronizes with other threads upon recording its first event and when its buffer runs out of space, at which point another chunk of `MU_PROFILE_CHUNK` events (overridable, 4096 by default) is allocated with `MU_ALLOC`. If allocating fails, events are dropped.
+
+			@DOCEND */
+
+			#if defined(MU_PROFILE) && !defined(MU_ATOMICS)
+				#error "MU_PROFILE requires MU_ATOMICS, which isn't available for this compiler and standard"
+			#endif
+			#if defined(MU_PROFILE) && !defined(MU_THREAD_LOCAL)
+				#error "MU_PROFILE requires MU_THREAD_LOCAL, which isn't available for this compiler and standard"
+			#endif
+			#if defined(MU_PROFILE) && defined(MU_LINUX) && !defined(CLOCK_MONOTONIC)
+				#error "MU_PROFILE requires clock_gettime; define _DEFAULT_SOURCE or _POSIX_C_SOURCE before including any system header"
+			#endif
+
+			#if defined(MU_PROFILE)
+
+				#ifndef MU_PROFILE_CHUNK
+					#define MU_PROFILE_CHUNK 4096
+				#endif
+
+				// Event types, as letters used by the trace event format
+				#define MUU_PROFILE_BEGIN 'B'
+				#define MUU_PROFILE_END 'E'
+
+				struct muu_inner_profile_event {
+					const char* name;
+					uint64_m time;
+					uint32_m type;
+				};
+
+				// Chunk of events; 'count' is only written by the owning thread, and is stored
+				// with release semantics so that exporting sees completely written events
+				struct muu_inner_profile_chunk {
+					muAtomicPtr next;
+					muAtomic32 count;
+					struct muu_inner_profile_event events[MU_PROFILE_CHUNK];
+				};
+
+				struct muu_inner_profile_thread {
+					struct muu_inner_profile_thread* next;
+					uint32_m id;
+					struct muu_inner_profile_chunk* first;
+					struct muu_inner_profile_chunk* last;
+				};
+
+				// Global list of threads that have recorded events
+				struct muu_inner_profile_state {
+					muAtomicPtr threads;
+					muAtomic32 ids;
+				};
+
+				// Under MU_PROFILE_SHARED_STATE, the state and each thread's buffer are defined
+				// once for the whole program instead of once per copy of these functions
+				#if defined(MU_PROFILE_SHARED_STATE)
+					extern struct muu_inner_profile_state muu_inner_profile_shared_state;
+					extern MU_THREAD_LOCAL struct muu_inner_profile_thread* muu_inner_profile_shared_thread;
+					#if defined(MU_PROFILE_SHARED_STATE_DEFINE)
+						struct muu_inner_profile_state muu_inner_profile_shared_state;
+						MU_THREAD_LOCAL struct muu_inner_profile_thread* muu_inner_profile_shared_thread;
+					#endif
+				#endif
+
+				MUDEF inline struct muu_inner_profile_state* muu_inner_profile_get_state(void) {
+					#if defined(MU_PROFILE_SHARED_STATE)
+						return &muu_inner_profile_shared_state;
+					#else
+						static struct muu_inner_profile_state state;
+						return &state;
+					#endif
+				}
+
+				MUDEF inline struct muu_inner_profile_chunk* muu_inner_profile_new_chunk(void) {
+					struct muu_inner_profile_chunk* c = (struct muu_inner_profile_chunk*)MU_ALLOC(sizeof(struct muu_inner_profile_chunk));
+					if (c) {
+						mu_atomic_store_ptr(&c->next, 0, MU_ATOMIC_RELAXED);
+						mu_atomic_store32(&c->count, 0, MU_ATOMIC_RELAXED);
+					}
+					return c;
+				}
+
+				// Registers the calling thread upon its first event, pushing it onto the global
+				// list with a compare-and-swap loop
+				MUDEF inline struct muu_inner_profile_thread* muu_inner_profile_register(void) {
+					struct muu_inner_profile_thread* t = (struct muu_inner_profile_thread*)MU_ALLOC(sizeof(struct muu_inner_profile_thread));
+					if (!t) {
+						return 0;
+					}
+					t->first = t->last = muu_inner_profile_new_chunk();
+					if (!t->first) {
+						MU_FREE(t);
+						return 0;
+					}
+
+					struct muu_inner_profile_state* s = muu_inner_profile_get_state();
+					t->id = mu_atomic_fetch_add32(&s->ids, 1, MU_ATOMIC_RELAXED) + 1;
+					void* head = mu_atomic_load_ptr(&s->threads, MU_ATOMIC_RELAXED);
+					do {
+						t->next = (struct muu_inner_profile_thread*)head;
+					} while (!mu_atomic_cas_ptr(&s->threads, &head, t, MU_ATOMIC_RELEASE));
+					return t;
+				}
+
+				MUDEF inline void muu_inner_profile_record(const char* name, uint32_m type) {
+					#if defined(MU_PROFILE_SHARED_STATE)
+						struct muu_inner_profile_thread* thread = muu_inner_profile_shared_thread;
+					#else
+						static MU_THREAD_LOCAL struct muu_inner_profile_thread* muu_inner_profile_thread_local;
+						struct muu_inner_profile_thread* thread = muu_inner_profile_thread_local;
+					#endif
+					if (!thread) {
+						thread = muu_inner_profile_register();
+						if (!thread) {
+							return;
+						}
+						#if defined(MU_PROFILE_SHARED_STATE)
+							muu_inner_profile_shared_thread = thread;
+						#else
+							muu_inner_profile_thread_local = thread;
+						#endif
+					}
+
+					struct muu_inner_profile_chunk* c = thread->last;
+					uint32_m n = mu_atomic_load32(&c->count, MU_ATOMIC_RELAXED);
+					if (n == MU_PROFILE_CHUNK) {
+						struct muu_inner_profile_chunk* next = muu_inner_profile_new_chunk();
+						if (!next) {
+							return;
+						}
+						mu_atomic_store_ptr(&c->next, next, MU_ATOMIC_RELEASE);
+						thread->last = c = next;
+						n = 0;
+					}
+
+					struct muu_inner_profile_event* e = &c->events[n];
+					e->name = name;
+					e->type = type;
+					e->time = muu_time_ns();
+					mu_atomic_store32(&c->count, n + 1, MU_ATOMIC_RELEASE);
+				}
+
+				MUDEF inline void muu_profile_begin(const char* name) {
+					muu_inner_profile_record(name, MUU_PROFILE_BEGIN);
+				}
+
+				MUDEF inline void muu_profile_end(const char* name) {
+					muu_inner_profile_record(name, MUU_PROFILE_END);
+				}
+
+				#define MU_PROFILE_BEGIN(name) muu_profile_begin(name)
+				#define MU_PROFILE_END(name) muu_profile_end(name)
+
+				#if defined(__cplusplus)
+					struct muu_inner_profile_scope {
+						const char* name;
+						muu_inner_profile_scope(const char* n) : name(n) { muu_profile_begin(n); }
+						~muu_inner_profile_scope() { muu_profile_end(name); }
+					};
+					#define MU_PROFILE_SCOPE(name) muu_inner_profile_scope MUU_CAT(muu_inner_scope_, __LINE__)(name)
+				#elif defined(__GNUC__) || defined(__clang__)
+					MUDEF inline void muu_inner_profile_scope_end(const char** name) {
+						muu_profile_end(*name);
+					}
+					#define MU_PROFILE_SCOPE(name) const char* MUU_CAT(muu_inner_scope_, __LINE__) __attribute__((cleanup(muu_inner_profile_scope_end))) = (muu_profile_begin(name), (name))
+				#endif
+
+			#else
+
+				#define MU_PROFILE_BEGIN(name) ((void)0)
+				#define MU_PROFILE_END(name) ((void)0)
+				#define MU_PROFILE_SCOPE(name) ((void)0)
+
+			#endif /* MU_PROFILE */
+
+		// @DOCLINE ## Exporting
+
+			#if defined(MU_PROFILE)
+
+				MUDEF inline muBool muu_inner_profile_write(muByteWriter* w, const char* s, muuResult* result) {
+					size_m n = 0;
+					while (s[n]) {
+						++n;
+					}
+					return muu_byte_writer_write(w, (muByte*)s, n, result);
+				}
+
+				MUDEF inline muBool muu_inner_profile_write_u64(muByteWriter* w, uint64_m n, muuResult* result) {
+					char d[21];
+					size_m i = 20;
+					d[20] = 0;
+					do {
+						d[--i] = (char)('0' + n % 10);
+						n /= 10;
+					} while (n);
+					return muu_inner_profile_write(w, &d[i], result);
+				}
+
+				// Writes a string as a JSON string, escaping quotes, backslashes, and control
+				// characters
+				MUDEF inline muBool muu_inner_profile_write_name(muByteWriter* w, const char* s, muuResult* result) {
+					static const char hex[] = "0123456789abcdef";
+					if (!muu_inner_profile_write(w, "\"", result)) {
+						return MU_FALSE;
+					}
+					for (; *s; ++s) {
+						unsigned char c = (unsigned char)*s;
+						char e[7] = { '\\', (char)c, 0, 0, 0, 0, 0 };
+						if (c < 0x20) {
+							e[1] = 'u'; e[2] = '0'; e[3] = '0'; e[4] = hex[c >> 4]; e[5] = hex[c & 15];
+						} else if (c != '"' && c != '\\') {
+							e[0] = (char)c;
+							e[1] = 0;
+						}
+						if (!muu_inner_profile_write(w, e, result)) {
+							return MU_FALSE;
+						}
+					}
+					return muu_inner_profile_write(w, "\"", result);
+				}
+
+				// @DOCLINE The function `muu_profile_export` writes every event recorded so far as Chrome trace event JSON, defined below:
+
+				/* @DOCBEGIN
+				```c
+				MUDEF inline muBool muu_profile_export(muByteWriter* w, muuResult* result);
+				```
+				@DOCEND */
+
+				MUDEF inline muBool muu_profile_export(muByteWriter* w, muuResult* result) {
+					struct muu_inner_profile_state* s = muu_inner_profile_get_state();
+					struct muu_inner_profile_thread* threads = (struct muu_inner_profile_thread*)mu_atomic_load_ptr(&s->threads, MU_ATOMIC_ACQUIRE);
+
+					// Timestamps are written relative to the earliest event
+					uint64_m start = ~(uint64_m)0;
+					for (struct muu_inner_profile_thread* t = threads; t; t = t->next) {
+						uint32_m count = mu_atomic_load32(&t->first->count, MU_ATOMIC_ACQUIRE);
+						if (count && t->first->events[0].time < start) {
+							start = t->first->events[0].time;
+						}
+					}
+
+					if (!muu_inner_profile_write(w, "{\"traceEvents\":[", result)) {
+						return MU_FALSE;
+					}
+					muBool first = MU_TRUE;
+					for (struct muu_inner_profile_thread* t = threads; t; t = t->next) {
+						for (struct muu_inner_profile_chunk* c = t->first; c; ) {
+							uint32_m count = mu_atomic_load32(&c->count, MU_ATOMIC_ACQUIRE);
+							struct muu_inner_profile_chunk* next = (struct muu_inner_profile_chunk*)mu_atomic_load_ptr(&c->next, MU_ATOMIC_ACQUIRE);
+							for (uint32_m i = 0; i < count; ++i) {
+								struct muu_inner_profile_event* e = &c->events[i];
+								uint64_m ns = e->time - start;
+								char ph[2] = { (char)e->type, 0 };
+								char frac[4] = { (char)('0' + ns / 100 % 10), (char)('0' + ns / 10 % 10), (char)('0' + ns % 10), 0 };
+								if (
+									!muu_inner_profile_write(w, first ? "\n{\"name\":" : ",\n{\"name\":", result) ||
+									!muu_inner_profile_write_name(w, e->name, result) ||
+									!muu_inner_profile_write(w, ",\"ph\":\"", result) ||
+									!muu_inner_profile_write(w, ph, result) ||
+									!muu_inner_profile_write(w, "\",\"ts\":", result) ||
+									!muu_inner_profile_write_u64(w, ns / 1000, result) ||
+									!muu_inner_profile_write(w, ".", result) ||
+									!muu_inner_profile_write(w, frac, result) ||
+									!muu_inner_profile_write(w, ",\"pid\":1,\"tid\":", result) ||
+									!muu_inner_profile_write_u64(w, t->id, result) ||
+									!muu_inner_profile_write(w, "}", result)
+								) {
+									return MU_FALSE;
+								}
+								first = MU_FALSE;
+							}
+							c = next;
+						}
+					}
+					return muu_inner_profile_write(w, "\n]}\n", result);
+				}
+
+				// @DOCLINE Timestamps are written in microseconds relative to the earliest recorded event, and each thread that recorded events gets its own track. Threads can keep recording events while exporting; events recorded after the export began may or may not be included. The writer is not flushed at the end, so `muu_byte_writer_flush` should be called afterwards if the writer has a flush callback. `MU_FALSE` is returned (with `result` set accordingly) if writing fails.
+
+				// @DOCLINE The function `muu_profile_free` frees every recorded event, defined below:
+
+				/* @DOCBEGIN
+				```c
+				MUDEF inline void muu_profile_free(void);
+				```
+				@DOCEND */
+
+				MUDEF inline void muu_profile_free(void) {
+					struct muu_inner_profile_state* s = muu_inner_profile_get_state();
+					struct muu_inner_profile_thread* t = (struct muu_inner_profile_thread*)mu_atomic_exchange_ptr(&s->threads, 0, MU_ATOMIC_ACQUIRE);
+					while (t) {
+						struct muu_inner_profile_chunk* c = t->first;
+						while (c) {
+							struct muu_inner_profile_chunk* next = (struct muu_inner_profile_chunk*)mu_atomic_load_ptr(&c->next, MU_ATOMIC_RELAXED);
+							MU_FREE(c);
+							c = next;
+						}
+						struct muu_inner_profile_thread* next = t->next;
+						MU_FREE(t);
+						t = next;
+					}
+				}
+
+				// @DOCLINE This must only be called once no thread will ever record events again (for example, before the program exits), as threads keep pointers to their buffers.
+
+			#endif /* MU_PROFILE */
+
+	// @DOCLINE # Job system
+
+		// @DOCLINE muUtility provides an optional job system: a pool of worker threads that run jobs submitted to it, balancing load by letting idle workers steal jobs from busy ones. It is only defined if `MU_LINUX` is defined, and if `MU_JOBS` is defined before the inclusion of muUtility, as it relies on POSIX threads (which requires linking with `-pthread`). It also requires `MU_ATOMICS` and `MU_THREAD_LOCAL`; if either isn't available for the compiler and standard in use, requesting the job system on Linux is a compile error rather than it silently being left out.
+
+		#if defined(MU_LINUX) && defined(MU_JOBS) && !defined(MU_ATOMICS)
+			#error "MU_JOBS requires MU_ATOMICS, which isn't available for this compiler and standard"
+		#endif
+		#if defined(MU_LINUX) && defined(MU_JOBS) && !defined(MU_THREAD_LOCAL)
+			#error "MU_JOBS requires MU_THREAD_LOCAL, which isn't available for this compiler and standard"
+		#endif
+
+		#if defined(MU_LINUX) && defined(MU_JOBS)
+
+			#include <pthread.h>
+			#include <unistd.h>
+
+		// @DOCLINE ## Jobs
+
+			// @DOCLINE The struct `muJob` is a job, having the following members:
+
+			struct muJob {
+				// @DOCLINE * `void (*func)(void* data)` - the function run by the job.
+				void (*func)(void* data);
+				// @DOCLINE * `void* data` - the data passed to `func`.
+				void* data;
+				// @DOCLINE * `muAtomic32* counter` - the counter incremented upon the job being submitted and decremented once it has run, which can be waited on to know when it's done; can be 0.
+				muAtomic32* counter;
+			};
+			typedef struct muJob muJob;
+
+			// @DOCLINE A job isn't modified by the job system, and must stay valid until it has run. The same job can be submitted several times, in which case it runs once per submission. Jobs that share a counter can be waited on as a group.
+
+			// Capacity of each worker's deque and of the queue of jobs submitted from other
+			// threads; both must be powers of two
+			#ifndef MU_JOB_DEQUE_SIZE
+				#define MU_JOB_DEQUE_SIZE 4096
+			#endif
+			#ifndef MU_JOB_QUEUE_SIZE
+				#define MU_JOB_QUEUE_SIZE 4096
 			#endif
 
-			// @DOCLINE * `MU_WBES24` - writes a signed 24-bit integer to big-endian byte data; overridable macro to `muu_wbes24`.
-			#ifndef MU_WBES24
-				MUDEF inline void muu_wbes24(muByte* b, int32_m n) {
-					uint32_m un = *(uint32_m*)&n;
-					b[2] = (uint8_m)(un >> 0);
-					b[1] = (uint8_m)(un >> 8);
-					b[0] = (uint8_m)(un >> 16);
+			// Chase-Lev work-stealing deque of jobs; the owning worker pushes and takes at
+			// the bottom, and other threads steal from the top. It has a fixed size, so
+			// pushing fails when it's full instead of growing.
+			struct muu_inner_job_deque {
+				muAtomic32 top;
+				muByte pad0[MU_CACHE_LINE];
+				muAtomic32 bottom;
+				muByte pad1[MU_CACHE_LINE];
+				muAtomicPtr jobs[MU_JOB_DEQUE_SIZE];
+			};
+
+			MUDEF inline muBool muu_inner_job_deque_push(struct muu_inner_job_deque* d, muJob* job) {
+				uint32_m b = mu_atomic_load32(&d->bottom, MU_ATOMIC_RELAXED);
+				uint32_m t = mu_atomic_load32(&d->top, MU_ATOMIC_ACQUIRE);
+				if (b - t >= MU_JOB_DEQUE_SIZE) {
+					return MU_FALSE;
 				}
-				#define MU_WBES24 muu_wbes24
-			#endif
+				mu_atomic_store_ptr(&d->jobs[b & (MU_JOB_DEQUE_SIZE - 1)], job, MU_ATOMIC_RELAXED);
+				mu_atomic_store32(&d->bottom, b + 1, MU_ATOMIC_RELEASE);
+				return MU_TRUE;
+			}
 
-		// @DOCLINE ## 32-bit
+			MUDEF inline muJob* muu_inner_job_deque_take(struct muu_inner_job_deque* d) {
+				uint32_m b = mu_atomic_load32(&d->bottom, MU_ATOMIC_RELAXED) - 1;
+				mu_atomic_store32(&d->bottom, b, MU_ATOMIC_RELAXED);
+				// Publishing the new bottom must be ordered before reading the top, so that
+				// a thief and the owner can't both take the last job
+				mu_atomic_fence(MU_ATOMIC_SEQ_CST);
+				uint32_m t = mu_atomic_load32(&d->top, MU_ATOMIC_RELAXED);
+				if ((int32_m)(b - t) < 0) {
+					mu_atomic_store32(&d->bottom, b + 1, MU_ATOMIC_RELAXED);
+					return 0;
+				}
+				muJob* job = (muJob*)mu_atomic_load_ptr(&d->jobs[b & (MU_JOB_DEQUE_SIZE - 1)], MU_ATOMIC_RELAXED);
+				if (b == t) {
+					// Last job; race thieves for it
+					if (!mu_atomic_cas32(&d->top, &t, t + 1, MU_ATOMIC_SEQ_CST)) {
+						job = 0;
+					}
+					mu_atomic_store32(&d->bottom, b + 1, MU_ATOMIC_RELAXED);
+				}
+				return job;
+			}
 
-			// @DOCLINE The following macros exist for byte manipulation regarding 32-bit integers:
+			MUDEF inline muJob* muu_inner_job_deque_steal(struct muu_inner_job_deque* d) {
+				uint32_m t = mu_atomic_load32(&d->top, MU_ATOMIC_ACQUIRE);
+				mu_atomic_fence(MU_ATOMIC_SEQ_CST);
+				uint32_m b = mu_atomic_load32(&d->bottom, MU_ATOMIC_ACQUIRE);
+				if ((int32_m)(b - t) <= 0) {
+					return 0;
+				}
+				muJob* job = (muJob*)mu_atomic_load_ptr(&d->jobs[t & (MU_JOB_DEQUE_SIZE - 1)], MU_ATOMIC_RELAXED);
+				if (!mu_atomic_cas32(&d->top, &t, t + 1, MU_ATOMIC_SEQ_CST)) {
+					return 0;
+				}
+				return job;
+			}
 
-			// @DOCLINE * `MU_RLEU32` - reads an unsigned 32-bit integer from little-endian byte data; overridable macro to `muu_rleu32`.
-			#ifndef MU_RLEU32
-				MUDEF inline uint32_m muu_rleu32(muByte* b) {
-					return (
-						((uint32_m)(b[0]) << 0)  |
-						((uint32_m)(b[1]) << 8)  |
-						((uint32_m)(b[2]) << 16) |
-						((uint32_m)(b[3]) << 24)
-					);
+			// Named so that 'const T*' in the queue's functions applies to the pointer
+			typedef muJob* muu_inner_job_ptr;
+			MU_QUEUE(muu_inner_job_queue, muu_inner_job_ptr)
+
+		// @DOCLINE ## Job system struct
+
+			// @DOCLINE The struct `muJobSystem` is a pool of worker threads, and has the following members:
+
+			struct muu_inner_job_worker;
+
+			struct muJobSystem {
+				// @DOCLINE * `uint32_m worker_count` - the amount of worker threads.
+				uint32_m worker_count;
+				// @DOCLINE * `struct muu_inner_job_worker* workers` - the worker threads and their deques.
+				struct muu_inner_job_worker* workers;
+				// @DOCLINE * `muu_inner_job_queue queue` - the queue of jobs submitted by threads that aren't workers.
+				muu_inner_job_queue queue;
+				// @DOCLINE * `muAtomic32 epoch` - incremented (with `mutex` locked) whenever a submission wakes a sleeping worker, so that workers can tell a wake-up from a spurious one.
+				muAtomic32 epoch;
+				// @DOCLINE * `muAtomic32 sleepers` - the amount of workers asleep or going to sleep.
+				muAtomic32 sleepers;
+				// @DOCLINE * `muAtomic32 stop` - set when the workers should exit.
+				muAtomic32 stop;
+				// @DOCLINE * `pthread_mutex_t mutex` and `pthread_cond_t cond` - used to put idle workers to sleep and wake them up.
+				pthread_mutex_t mutex;
+				pthread_cond_t cond;
+			};
+			typedef struct muJobSystem muJobSystem;
+
+			// @DOCLINE These members should not be modified directly.
+
+			struct muu_inner_job_worker {
+				struct muu_inner_job_deque deque;
+				muJobSystem* js;
+				pthread_t thread;
+				uint32_m index;
+				// State of the xorshift generator picking which worker to steal from
+				uint32_m rng;
+				muByte pad[MU_CACHE_LINE];
+			};
+
+			// The worker running on the current thread, or 0 if it isn't a worker
+			MUDEF inline struct muu_inner_job_worker** muu_inner_job_current(void) {
+				static MU_THREAD_LOCAL struct muu_inner_job_worker* worker;
+				return &worker;
+			}
+
+		// @DOCLINE ## Running jobs
+
+			MUDEF inline void muu_inner_job_run(muJob* job) {
+				job->func(job->data);
+				if (job->counter) {
+					mu_atomic_fetch_add32(job->counter, 0xFFFFFFFFu, MU_ATOMIC_ACQ_REL);
 				}
-				#define MU_RLEU32 muu_rleu32
-			#endif
+			}
 
-			// @DOCLINE * `MU_WLEU32` - writes an unsigned 32-bit integer to little-endian byte data; overridable macro to `muu_wleu32`.
-			#ifndef MU_WLEU32
-				MUDEF inline void muu_wleu32(muByte* b, uint32_m n) {
-					b[0] = (uint8_m)(n >> 0);
-					b[1] = (uint8_m)(n >> 8);
-					b[2] = (uint8_m)(n >> 16);
-					b[3] = (uint8_m)(n >> 24);
+			// Finds a job for the given worker (or for a thread that isn't a worker if 0):
+			// first from its own deque, then from the queue, then by stealing from the other
+			// workers, starting at a random one
+			MUDEF inline muJob* muu_inner_job_find(muJobSystem* js, struct muu_inner_job_worker* self) {
+				muJob* job = 0;
+				if (self && (job = muu_inner_job_deque_take(&self->deque)) != 0) {
+					return job;
 				}
-				#define MU_WLEU32 muu_wleu32
-			#endif
+				if (muu_inner_job_queue_pop(&js->queue, &job)) {
+					return job;
+				}
+				uint32_m start = 0;
+				if (self) {
+					self->rng ^= self->rng << 13;
+					self->rng ^= self->rng >> 17;
+					self->rng ^= self->rng << 5;
+					start = self->rng;
+				}
+				for (uint32_m i = 0; i < js->worker_count; ++i) {
+					struct muu_inner_job_worker* victim = &js->workers[(start + i) % js->worker_count];
+					if (victim != self && (job = muu_inner_job_deque_steal(&victim->deque)) != 0) {
+						return job;
+					}
+				}
+				return 0;
+			}
 
-			// @DOCLINE * `MU_RLES32` - reads a signed 32-bit integer from little-endian byte data; overridable macro to `muu_rles32`.
-			#ifndef MU_RLES32
-				MUDEF inline int32_m muu_rles32(muByte* b) {
-					uint32_m u32 = muu_rleu32(b);
-					return *(int32_m*)&u32;
+			// Amount of failed searches for a job before a worker goes to sleep
+			#define MUU_JOB_SPINS 64
+
+			MUDEF inline void* muu_inner_job_worker_main(void* arg) {
+				struct muu_inner_job_worker* self = (struct muu_inner_job_worker*)arg;
+				muJobSystem* js = self->js;
+				*muu_inner_job_current() = self;
+
+				uint32_m spins = 0;
+				while (!mu_atomic_load32(&js->stop, MU_ATOMIC_ACQUIRE)) {
+					muJob* job = muu_inner_job_find(js, self);
+					if (job) {
+						muu_inner_job_run(job);
+						spins = 0;
+						continue;
+					}
+					if (++spins < MUU_JOB_SPINS) {
+						mu_pause();
+						continue;
+					}
+
+					// Sleep until a job is submitted; announcing the sleep and then looking for
+					// a job once more (while submitters push their job and then check for
+					// sleepers, with a fence in-between on both sides) makes sure that either
+					// the submitter sees the sleeper or the sleeper sees the job. The epoch is
+					// only changed with the mutex locked, so reading it here can't miss a wake-up.
+					pthread_mutex_lock(&js->mutex);
+					mu_atomic_fetch_add32(&js->sleepers, 1, MU_ATOMIC_RELAXED);
+					mu_atomic_fence(MU_ATOMIC_SEQ_CST);
+					uint32_m epoch = mu_atomic_load32(&js->epoch, MU_ATOMIC_RELAXED);
+					job = muu_inner_job_find(js, self);
+					if (!job) {
+						while (mu_atomic_load32(&js->epoch, MU_ATOMIC_RELAXED) == epoch && !mu_atomic_load32(&js->stop, MU_ATOMIC_ACQUIRE)) {
+							pthread_cond_wait(&js->cond, &js->mutex);
+						}
+					}
+					mu_atomic_fetch_add32(&js->sleepers, 0xFFFFFFFFu, MU_ATOMIC_RELAXED);
+					pthread_mutex_unlock(&js->mutex);
+					if (job) {
+						muu_inner_job_run(job);
+					}
+					spins = 0;
 				}
-				#define MU_RLES32 muu_rles32
-			#endif
+				return 0;
+			}
 
-			// @DOCLINE * `MU_WLES32` - writes a signed 32-bit integer to little-endian byte data; overridable macro to `muu_wles32`.
-			#ifndef MU_WLES32
-				MUDEF inline void muu_wles32(muByte* b, int32_m n) {
-					uint32_m un = *(uint32_m*)&n;
-					b[0] = (uint8_m)(un >> 0);
-					b[1] = (uint8_m)(un >> 8);
-					b[2] = (uint8_m)(un >> 16);
-					b[3] = (uint8_m)(un >> 24);
+			// @DOCLINE Jobs submitted from a worker thread are pushed onto that worker's own deque, which it runs in last-in first-out order (keeping recently produced data in its cache), while idle workers steal the oldest jobs from it. Jobs submitted from other threads go through a shared queue. Workers that can't find a job spin briefly, and then sleep until a job is submitted.
+
+		// @DOCLINE ## Job system initialization
+
+			// @DOCLINE The function `muu_jobs_init` initializes a job system and starts its worker threads, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline muBool muu_jobs_init(muJobSystem* js, uint32_m worker_count, muuResult* result);
+			```
+			@DOCEND */
+
+			// Stops and joins the first 'started' workers, and frees everything
+			MUDEF inline void muu_inner_jobs_stop(muJobSystem* js, uint32_m started) {
+				pthread_mutex_lock(&js->mutex);
+				mu_atomic_store32(&js->stop, 1, MU_ATOMIC_RELEASE);
+				pthread_cond_broadcast(&js->cond);
+				pthread_mutex_unlock(&js->mutex);
+				for (uint32_m i = 0; i < started; ++i) {
+					pthread_join(js->workers[i].thread, 0);
 				}
-				#define MU_WLES32 muu_wles32
-			#endif
+				pthread_cond_destroy(&js->cond);
+				pthread_mutex_destroy(&js->mutex);
+				muu_inner_job_queue_destroy(&js->queue);
+				MU_FREE(js->workers);
+				js->workers = 0;
+				js->worker_count = 0;
+			}
 
-			// @DOCLINE * `MU_RBEU32` - reads an unsigned 32-bit integer from big-endian byte data; overridable macro to `muu_rbeu32`.
-			#ifndef MU_RBEU32
-				MUDEF inline uint32_m muu_rbeu32(muByte* b) {
-					return (
-						((uint32_m)(b[3]) << 0)  |
-						((uint32_m)(b[2]) << 8)  |
-						((uint32_m)(b[1]) << 16) |
-						((uint32_m)(b[0]) << 24)
-					);
+			MUDEF inline muBool muu_jobs_init(muJobSystem* js, uint32_m worker_count, muuResult* result) {
+				if (!worker_count) {
+					long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+					worker_count = cpus > 1 ? (uint32_m)(cpus - 1) : 1;
 				}
-				#define MU_RBEU32 muu_rbeu32
-			#endif
 
-			// @DOCLINE * `MU_WBEU32` - writes an unsigned 32-bit integer to big-endian byte data; overridable macro to `muu_wbeu32`.
-			#ifndef MU_WBEU32
-				MUDEF inline void muu_wbeu32(muByte* b, uint32_m n) {
-					b[3] = (uint8_m)(n >> 0);
-					b[2] = (uint8_m)(n >> 8);
-					b[1] = (uint8_m)(n >> 16);
-					b[0] = (uint8_m)(n >> 24);
+				js->worker_count = worker_count;
+				js->workers = (struct muu_inner_job_worker*)MU_ALLOC(worker_count * sizeof(struct muu_inner_job_worker));
+				if (!js->workers) {
+					MU_SET_RESULT(result, MUU_ALLOCATION_FAILED)
+					return MU_FALSE;
 				}
-				#define MU_WBEU32 muu_wbeu32
-			#endif
+				if (!muu_inner_job_queue_init(&js->queue, MU_JOB_QUEUE_SIZE, result)) {
+					MU_FREE(js->workers);
+					return MU_FALSE;
+				}
+				mu_atomic_store32(&js->epoch, 0, MU_ATOMIC_RELAXED);
+				mu_atomic_store32(&js->sleepers, 0, MU_ATOMIC_RELAXED);
+				mu_atomic_store32(&js->stop, 0, MU_ATOMIC_RELAXED);
+				pthread_mutex_init(&js->mutex, 0);
+				pthread_cond_init(&js->cond, 0);
 
-			// @DOCLINE * `MU_RBES32` - reads a signed 32-bit integer from big-endian byte data; overridable macro to `muu_rbes32`.
-			#ifndef MU_RBES32
-				MUDEF inline int32_m muu_rbes32(muByte* b) {
-					uint32_m u32 = muu_rbeu32(b);
-					return *(int32_m*)&u32;
+				for (uint32_m i = 0; i < worker_count; ++i) {
+					struct muu_inner_job_worker* w = &js->workers[i];
+					mu_atomic_store32(&w->deque.top, 0, MU_ATOMIC_RELAXED);
+					mu_atomic_store32(&w->deque.bottom, 0, MU_ATOMIC_RELAXED);
+					w->js = js;
+					w->index = i;
+					w->rng = 0x9E3779B9u * (i + 1);
 				}
-				#define MU_RBES32 muu_rbes32
-			#endif
+				// Workers that failed to start are left with empty deques, which the others
+				// can harmlessly look at until they're stopped
+				for (uint32_m i = 0; i < worker_count; ++i) {
+					if (pthread_create(&js->workers[i].thread, 0, muu_inner_job_worker_main, &js->workers[i]) != 0) {
+						muu_inner_jobs_stop(js, i);
+						MU_SET_RESULT(result, MUU_THREAD_FAILED)
+						return MU_FALSE;
+					}
+				}
+				return MU_TRUE;
+			}
 
-			// @DOCLINE * `MU_WBES32` - writes a signed 32-bit integer to big-endian byte data; overridable macro to `muu_wbes32`.
-			#ifndef MU_WBES32
-				MUDEF inline void muu_wbes32(muByte* b, int32_m n) {
-					uint32_m un = *(uint32_m*)&n;
-					b[3] = (uint8_m)(un >> 0);
-					b[2] = (uint8_m)(un >> 8);
-					b[1] = (uint8_m)(un >> 16);
-					b[0] = (uint8_m)(un >> 24);
+			// @DOCLINE If `worker_count` is 0, one worker is started per online CPU core except for one, leaving a core for the calling thread (which can run jobs while waiting on them). If allocating fails, `result` is set to `MUU_ALLOCATION_FAILED`, and if starting a thread fails, `result` is set to `MUU_THREAD_FAILED`; `MU_FALSE` is returned in either case.
+
+			// @DOCLINE The function `muu_jobs_destroy` stops a job system's worker threads and frees its memory, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_jobs_destroy(muJobSystem* js);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_jobs_destroy(muJobSystem* js) {
+				muu_inner_jobs_stop(js, js->worker_count);
+			}
+
+			// @DOCLINE Jobs that haven't run yet are discarded, so every submitted job should be waited on first.
+
+		// @DOCLINE ## Submitting and waiting
+
+			// @DOCLINE The function `muu_jobs_submit` submits a job to run on a job system, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_jobs_submit(muJobSystem* js, muJob* job);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_jobs_submit(muJobSystem* js, muJob* job) {
+				if (job->counter) {
+					mu_atomic_fetch_add32(job->counter, 1, MU_ATOMIC_RELAXED);
+				}
+				struct muu_inner_job_worker* self = *muu_inner_job_current();
+				muBool pushed = (self && self->js == js) ? muu_inner_job_deque_push(&self->deque, job) : muu_inner_job_queue_push(&js->queue, &job);
+				if (!pushed) {
+					// Full; running the job right away applies back-pressure to the submitter
+					muu_inner_job_run(job);
+					return;
 				}
-				#define MU_WBES32 muu_wbes32
-			#endif
 
-		// @DOCLINE ## 64-bit
+				// Only wake a worker if one is asleep, keeping submissions off of shared
+				// cache lines otherwise; see muu_inner_job_worker_main for the fence
+				mu_atomic_fence(MU_ATOMIC_SEQ_CST);
+				if (mu_atomic_load32(&js->sleepers, MU_ATOMIC_RELAXED)) {
+					pthread_mutex_lock(&js->mutex);
+					mu_atomic_store32(&js->epoch, mu_atomic_load32(&js->epoch, MU_ATOMIC_RELAXED) + 1, MU_ATOMIC_RELAXED);
+					pthread_cond_signal(&js->cond);
+					pthread_mutex_unlock(&js->mutex);
+				}
+			}
 
-			// @DOCLINE The following macros exist for byte manipulation regarding 64-bit integers:
+			// @DOCLINE Submitting can be done from any thread, including from within a job. If there's no room for the job, it's run immediately on the calling thread.
 
-			// @DOCLINE * `MU_RLEU64` - reads an unsigned 64-bit integer from little-endian byte data; overridable macro to `muu_rleu64`.
-			#ifndef MU_RLEU64
-				MUDEF inline uint64_m muu_rleu64(muByte* b) {
-					return (
-						((uint64_m)(b[0]) << 0)  |
-						((uint64_m)(b[1]) << 8)  |
-						((uint64_m)(b[2]) << 16) |
-						((uint64_m)(b[3]) << 24) |
-						((uint64_m)(b[4]) << 32) |
-						((uint64_m)(b[5]) << 40) |
-						((uint64_m)(b[6]) << 48) |
-						((uint64_m)(b[7]) << 56)
-					);
+			// @DOCLINE The function `muu_jobs_wait` waits until a counter reaches 0, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_jobs_wait(muJobSystem* js, muAtomic32* counter);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_jobs_wait(muJobSystem* js, muAtomic32* counter) {
+				struct muu_inner_job_worker* self = *muu_inner_job_current();
+				if (self && self->js != js) {
+					self = 0;
 				}
-				#define MU_RLEU64 muu_rleu64
-			#endif
+				while (mu_atomic_load32(counter, MU_ATOMIC_ACQUIRE)) {
+					muJob* job = muu_inner_job_find(js, self);
+					if (job) {
+						muu_inner_job_run(job);
+					} else {
+						mu_pause();
+					}
+				}
+			}
 
-			// @DOCLINE * `MU_WLEU64` - writes an unsigned 64-bit integer to little-endian byte data; overridable macro to `muu_wleu64`.
-			#ifndef MU_WLEU64
-				MUDEF inline void muu_wleu64(muByte* b, uint64_m n) {
-					b[0] = (uint8_m)(n >> 0);
-					b[1] = (uint8_m)(n >> 8);
-					b[2] = (uint8_m)(n >> 16);
-					b[3] = (uint8_m)(n >> 24);
-					b[4] = (uint8_m)(n >> 32);
-					b[5] = (uint8_m)(n >> 40);
-					b[6] = (uint8_m)(n >> 48);
-					b[7] = (uint8_m)(n >> 56);
+			// @DOCLINE Instead of blocking, the calling thread runs jobs while waiting, so waiting from within a job doesn't take a worker away from the pool, and can't deadlock it. Once it returns, every job that was counted has run, and everything they wrote is visible to the calling thread. Counters should be zero-initialized before being used.
+
+		// @DOCLINE ## Parallel for
+
+			struct muu_inner_job_for {
+				void (*func)(void* data, size_m begin, size_m end);
+				void* data;
+				size_m count;
+				size_m chunk;
+				muAtomic64 next;
+			};
+
+			// Runs chunks of the range until none are left; run by the calling thread and
+			// by every helper job
+			MUDEF inline void muu_inner_job_for_run(void* arg) {
+				struct muu_inner_job_for* f = (struct muu_inner_job_for*)arg;
+				for (;;) {
+					uint64_m begin = mu_atomic_fetch_add64(&f->next, f->chunk, MU_ATOMIC_RELAXED);
+					if (begin >= f->count) {
+						return;
+					}
+					size_m end = f->count - (size_m)begin < f->chunk ? f->count : (size_m)begin + f->chunk;
+					f->func(f->data, (size_m)begin, end);
 				}
-				#define MU_WLEU64 muu_wleu64
-			#endif
+			}
 
-			// @DOCLINE * `MU_RLES64` - reads a signed 64-bit integer from little-endian byte data; overridable macro to `muu_rles64`.
-			#ifndef MU_RLES64
-				MUDEF inline int64_m muu_rles64(muByte* b) {
-					uint64_m u64 = muu_rleu64(b);
-					return *(int64_m*)&u64;
+			// @DOCLINE The function `muu_jobs_parallel_for` calls a function over chunks of a range in parallel, defined below:
+
+			/* @DOCBEGIN
+			```c
+			MUDEF inline void muu_jobs_parallel_for(muJobSystem* js, size_m count, size_m chunk, void (*func)(void* data, size_m begin, size_m end), void* data);
+			```
+			@DOCEND */
+
+			MUDEF inline void muu_jobs_parallel_for(muJobSystem* js, size_m count, size_m chunk, void (*func)(void* data, size_m begin, size_m end), void* data) {
+				if (!count) {
+					return;
+				}
+				if (!chunk) {
+					// Several chunks per thread so that threads finishing early can help the
+					// others, rounded up to whole cache lines
+					size_m parts = (size_m)(js->worker_count + 1) * 4;
+					chunk = (count + parts - 1) / parts;
+					chunk = (chunk + MU_CACHE_LINE - 1) & ~(size_m)(MU_CACHE_LINE - 1);
 				}
-				#define MU_RLES64 muu_rles64
-			#endif
 
-			// @DOCLINE * `MU_WLES64` - writes a signed 64-bit integer to little-endian byte data; overridable macro to `muu_wles64`.
-			#ifndef MU_WLES64
-				MUDEF inline void muu_wles64(muByte* b, int64_m n) {
-					uint64_m un = *(uint64_m*)&n;
-					b[0] = (uint8_m)(un >> 0);
-					b[1] = (uint8_m)(un >> 8);
-					b[2] = (uint8_m)(un >> 16);
-					b[3] = (uint8_m)(un >> 24);
-					b[4] = (uint8_m)(un >> 32);
-					b[5] = (uint8_m)(un >> 40);
-					b[6] = (uint8_m)(un >> 48);
-					b[7] = (uint8_m)(un >> 56);
+				struct muu_inner_job_for f;
+				f.func = func;
+				f.data = data;
+				f.count = count;
+				f.chunk = chunk;
+				mu_atomic_store64(&f.next, 0, MU_ATOMIC_RELAXED);
+
+				// Every helper runs chunks until the range is exhausted, so a helper that
+				// starts late just finds nothing left to do
+				muAtomic32 counter;
+				mu_atomic_store32(&counter, 0, MU_ATOMIC_RELAXED);
+				muJob job;
+				job.func = muu_inner_job_for_run;
+				job.data = &f;
+				job.counter = &counter;
+				size_m chunks = (count - 1) / chunk + 1;
+				for (size_m i = 1; i < chunks && i <= js->worker_count; ++i) {
+					muu_jobs_submit(js, &job);
 				}
-				#define MU_WLES64 muu_wles64
+
+				muu_inner_job_for_run(&f);
+				muu_jobs_wait(js, &counter);
+			}
+
+			// @DOCLINE `func` is called with `data` and a subrange `[begin, end)` of `[0, count)`, once for every chunk of `chunk` elements (the last chunk may be shorter), from the calling thread and from workers; it returns once every chunk is done. If `chunk` is 0, the range is split into about four chunks per thread, rounded up to a multiple of `MU_CACHE_LINE`.
+
+			// @DOCLINE When processing a byte buffer, chunks should be a multiple of the cache line size so that no two threads write to the same cache line, and large enough that each one amortizes the cost of being handed out (one atomic addition); tens to hundreds of kilobytes per chunk keeps each thread's working set within its own cache. For example, decoding big-endian 16-bit samples in parallel:
+
+			/* @DOCBEGIN
+			```c
+			struct convert { muByte* b; uint16_m* n; };
+
+			void convert_chunk(void* data, size_m begin, size_m end) {
+				struct convert* c = (struct convert*)data;
+				muu_rbeu16_array(c->b + begin * 2, c->n + begin, end - begin);
+			}
+
+			struct convert c = { bytes, samples };
+			muu_jobs_parallel_for(&js, sample_count, 32768, convert_chunk, &c);
+			```
+			@DOCEND */
+
+		#endif /* MU_LINUX && MU_JOBS */
+
+	MU_CPP_EXTERN_END
+
+	// @DOCLINE # C++ templates
+
+		// @DOCLINE muUtility defines an optional C++ layer over the byte manipulation functions in the namespace `mu`, which is only defined if `MU_CPP_TEMPLATES` is defined before the inclusion of muUtility in C++ code. Its functions are templates over the type, endianness, and byte width of a value, so they are always visible for inlining, and they are `constexpr` where the language allows it: integer functions from C++14 onward, and floating-point functions from C++20 onward (using `std::bit_cast`). This allows tables embedded in the source code to be parsed at compile time.
+
+		// @DOCLINE When a call isn't evaluated at compile time and the compiler can tell (using `std::is_constant_evaluated` or its builtin equivalent), the functions use `mu_memcpy` and the byte swapping functions like the C accessors do, so that they compile to the same single load or store (and byte swap, if needed); otherwise, they fall back to a byte-by-byte loop, which is slower at runtime. Before C++14, nothing is evaluated at compile time, so the runtime path is always used.
+
+		#if defined(__cplusplus) && defined(MU_CPP_TEMPLATES)
+
+			#include <type_traits>
+
+			#if defined(_MSVC_LANG)
+				#define MUU_CPLUSPLUS _MSVC_LANG
+			#else
+				#define MUU_CPLUSPLUS __cplusplus
 			#endif
 
-			// @DOCLINE * `MU_RBEU64` - reads an unsigned 64-bit integer from big-endian byte data; overridable macro to `muu_rbeu64`.
-			#ifndef MU_RBEU64
-				MUDEF inline uint64_m muu_rbeu64(muByte* b) {
-					return (
-						((uint64_m)(b[7]) << 0)  |
-						((uint64_m)(b[6]) << 8)  |
-						((uint64_m)(b[5]) << 16) |
-						((uint64_m)(b[4]) << 24) |
-						((uint64_m)(b[3]) << 32) |
-						((uint64_m)(b[2]) << 40) |
-						((uint64_m)(b[1]) << 48) |
-						((uint64_m)(b[0]) << 56)
-					);
-				}
-				#define MU_RBEU64 muu_rbeu64
+			#if MUU_CPLUSPLUS >= 202002L && defined(__has_include)
+				#if __has_include(<bit>)
+					#include <bit>
+				#endif
 			#endif
 
-			// @DOCLINE * `MU_WBEU64` - writes an unsigned 64-bit integer to big-endian byte data; overridable macro to `muu_wbeu64`.
-			#ifndef MU_WBEU64
-				MUDEF inline void muu_wbeu64(muByte* b, uint64_m n) {
-					b[7] = (uint8_m)(n >> 0);
-					b[6] = (uint8_m)(n >> 8);
-					b[5] = (uint8_m)(n >> 16);
-					b[4] = (uint8_m)(n >> 24);
-					b[3] = (uint8_m)(n >> 32);
-					b[2] = (uint8_m)(n >> 40);
-					b[1] = (uint8_m)(n >> 48);
-					b[0] = (uint8_m)(n >> 56);
-				}
-				#define MU_WBEU64 muu_wbeu64
+			#if MUU_CPLUSPLUS >= 201402L
+				#define MUU_CPP_CONSTEXPR constexpr
+			#else
+				#define MUU_CPP_CONSTEXPR inline
 			#endif
 
-			// @DOCLINE * `MU_RBES64` - reads a signed 64-bit integer from big-endian byte data; overridable macro to `muu_rbes64`.
-			#ifndef MU_RBES64
-				MUDEF inline int64_m muu_rbes64(muByte* b) {
-					uint64_m u64 = muu_rbeu64(b);
-					return *(int64_m*)&u64;
-				}
-				#define MU_RBES64 muu_rbes64
+			#if defined(__cpp_lib_bit_cast)
+				#define MUU_CPP_CONSTEXPR_FLOAT constexpr
+			#else
+				#define MUU_CPP_CONSTEXPR_FLOAT inline
 			#endif
 
-			// @DOCLINE * `MU_WBES64` - writes a signed 64-bit integer to big-endian byte data; overridable macro to `muu_wbes64`.
-			#ifndef MU_WBES64
-				MUDEF inline void muu_wbes64(muByte* b, int64_m n) {
-					uint64_m un = *(uint64_m*)&n;
-					b[7] = (uint8_m)(un >> 0);
-					b[6] = (uint8_m)(un >> 8);
-					b[5] = (uint8_m)(un >> 16);
-					b[4] = (uint8_m)(un >> 24);
-					b[3] = (uint8_m)(un >> 32);
-					b[2] = (uint8_m)(un >> 40);
-					b[1] = (uint8_m)(un >> 48);
-					b[0] = (uint8_m)(un >> 56);
-				}
-				#define MU_WBES64 muu_wbes64
+			// Whether a call is evaluated at runtime, which is always the case before C++14
+			#if MUU_CPLUSPLUS < 201402L
+				#define MUU_CPP_RUNTIME() true
+			#elif defined(__cpp_lib_is_constant_evaluated)
+				#define MUU_CPP_RUNTIME() (!std::is_constant_evaluated())
+			#elif defined(__has_builtin)
+				#if __has_builtin(__builtin_is_constant_evaluated)
+					#define MUU_CPP_RUNTIME() (!__builtin_is_constant_evaluated())
+				#endif
+			#elif defined(__GNUC__) && (__GNUC__ >= 9)
+				#define MUU_CPP_RUNTIME() (!__builtin_is_constant_evaluated())
 			#endif
 
-	// @DOCLINE # Set result
+			// The runtime paths are only worth taking if the system's byte order is known
+			#if defined(MUU_CPP_RUNTIME) && !defined(MU_LITTLE_ENDIAN) && !defined(MU_BIG_ENDIAN)
+				#undef MUU_CPP_RUNTIME
+			#endif
 
-		/* @DOCBEGIN
+			namespace mu {
 
-		The `MU_SET_RESULT(res, val)` macro is an overridable function that checks if the given parameter `res` is a null pointer. If it is, it does nothing, but if it isn't, it dereferences the pointer and sets the value to `val`. This macro saves a lot of code, shrinking down what would be this:
+				// @DOCLINE ## Endianness
 
-		```c
-		if (result) {
-			*result = ...;
-		}
-		```
+					// @DOCLINE The enum class `mu::endian` has the values `little` and `big`, and `native`, which is equal to one of them if the byte order of the system is known (see `MU_LITTLE_ENDIAN` and `MU_BIG_ENDIAN`).
+					enum class endian {
+						little,
+						big,
+						#if defined(MU_LITTLE_ENDIAN)
+							native = little,
+						#elif defined(MU_BIG_ENDIAN)
+							native = big,
+						#endif
+					};
 
-		into this:
+				namespace inner {
 
-		```c
-		MU_SET_RESULT(result, ...)
-		```
+					template<size_m S> struct uint_sized;
+					template<> struct uint_sized<1> { typedef uint8_m type; };
+					template<> struct uint_sized<2> { typedef uint16_m type; };
+					template<> struct uint_sized<4> { typedef uint32_m type; };
+					template<> struct uint_sized<8> { typedef uint64_m type; };
 
-		@DOCEND */
+					// Byte swap of the runtime path, which maps to the C functions
+					template<typename U> inline U bswap(U v) noexcept {
+						return (sizeof(U) == 2) ? U(MU_BSWAP16(uint16_m(v))) :
+							(sizeof(U) == 4) ? U(MU_BSWAP32(uint32_m(v))) :
+							(sizeof(U) == 8) ? U(MU_BSWAP64(uint64_m(v))) : v;
+					}
 
-		#ifndef MU_SET_RESULT
-			#define MU_SET_RESULT(res, val) if(res){*res=val;}
-		#endif
+					template<typename U, size_m N, endian E> MUU_CPP_CONSTEXPR U load(const muByte* b) noexcept {
+						#if defined(MUU_CPP_RUNTIME)
+							if (N == sizeof(U) && MUU_CPP_RUNTIME()) {
+								U v = 0;
+								mu_memcpy(&v, b, sizeof(U));
+								return (E == endian::native) ? v : bswap(v);
+							}
+						#endif
+						U v = 0;
+						for (size_m i = 0; i < N; ++i) {
+							v = U(v | (U(b[(E == endian::little) ? i : (N - 1 - i)]) << (8 * i)));
+						}
+						return v;
+					}
 
-	// @DOCLINE # Enum
+					template<typename U, size_m N, endian E> MUU_CPP_CONSTEXPR void store(muByte* b, U v) noexcept {
+						#if defined(MUU_CPP_RUNTIME)
+							if (N == sizeof(U) && MUU_CPP_RUNTIME()) {
+								v = (E == endian::native) ? v : bswap(v);
+								mu_memcpy(b, &v, sizeof(U));
+								return;
+							}
+						#endif
+						for (size_m i = 0; i < N; ++i) {
+							b[(E == endian::little) ? i : (N - 1 - i)] = muByte(v >> (8 * i));
+						}
+					}
 
-		/* @DOCBEGIN
+					// Sign-extends the lower N bytes of 'v' if T is signed and wider than N bytes
+					template<typename T, size_m N, typename U> constexpr T extend(U v) noexcept {
+						return (std::is_signed<T>::value && N < sizeof(T)) ?
+							T(U(U(v ^ (U(1) << (8 * N - 1))) - (U(1) << (8 * N - 1)))) : T(v);
+					}
 
-		The `MU_ENUM(name, ...)` macro is an overridable function used to declare an enumerator. `name` is the name of the enumerator type, and `...` are all of the values. The reason why one would prefer this over the traditional way of declaring enumerators is because it actually makes it a `size_m`, which can avoid errors on certain compilers (looking at you, Microsoft) in regards to treating enumerators like values. It expands like this:
+					template<typename T, typename U> MUU_CPP_CONSTEXPR_FLOAT T from_bits(U v) noexcept {
+						#if defined(__cpp_lib_bit_cast)
+							return std::bit_cast<T>(v);
+						#else
+							T n;
+							mu_memcpy(&n, &v, sizeof(T));
+							return n;
+						#endif
+					}
 
-		```c
-		enum _##name {
-			__VA_ARGS__
-		};
-		typedef enum _##name _##name;
-		typedef size_m name;
-		```
+					template<typename U, typename T> MUU_CPP_CONSTEXPR_FLOAT U to_bits(T n) noexcept {
+						#if defined(__cpp_lib_bit_cast)
+							return std::bit_cast<U>(n);
+						#else
+							U v;
+							mu_memcpy(&v, &n, sizeof(U));
+							return v;
+						#endif
+					}
 
-		@DOCEND */
+				}
 
-		#define MU_ENUM(name, ...) enum _##name{__VA_ARGS__};typedef enum _##name _##name;typedef size_m name;
+				// @DOCLINE ## Byte swapping
 
-	// @DOCLINE # Operating system recognition
+					/* @DOCBEGIN
 
-		/* @DOCBEGIN
+					The function template `mu::byteswap` reverses the byte order of an integer of any integer type, defined below:
 
-		The macros `MU_WIN32` or `MU_LINUX` are defined (if neither were defined before) in order to allow mu libraries to easily check if they're running on a Windows or Linux system.
+					```cpp
+					template<typename T> MUU_CPP_CONSTEXPR T byteswap(T v) noexcept;
+					```
 
-		`MU_WIN32` will be defined if `WIN32` or `_WIN32` are defined, one of which is usually pre-defined on Windows systems.
+					@DOCEND */
 
-		`MU_LINUX` will be defined if `__linux__` is defined.
+					template<typename T> MUU_CPP_CONSTEXPR T byteswap(T v) noexcept {
+						static_assert(std::is_integral<T>::value, "mu::byteswap requires an integer type");
+						typedef typename std::make_unsigned<T>::type U;
+						#if defined(MUU_CPP_RUNTIME)
+							if (MUU_CPP_RUNTIME()) {
+								return T(inner::bswap(U(v)));
+							}
+						#endif
+						U u = U(v), r = 0;
+						for (size_m i = 0; i < sizeof(U); ++i) {
+							r = U(U(r << 8) | U((u >> (8 * i)) & 0xFF));
+						}
+						return T(r);
+					}
 
-		@DOCEND */
+				// @DOCLINE ## Loading and storing
 
-		#if !defined(MU_WIN32) && !defined(MU_LINUX)
-			#if defined(WIN32) || defined(_WIN32)
-				#define MU_WIN32
-			#endif
-			#if defined(__linux__)
-				#define MU_LINUX
-			#endif
-		#endif
+					/* @DOCBEGIN
 
-	MU_CPP_EXTERN_END
+					The function templates `mu::load` and `mu::store` read and write a value of type `T` from and to byte data of endianness `E` that is `N` bytes wide, defined below:
+
+					```cpp
+					template<typename T, mu::endian E, size_m N = sizeof(T)> MUU_CPP_CONSTEXPR T load(const muByte* b) noexcept;
+					template<typename T, mu::endian E, size_m N = sizeof(T)> MUU_CPP_CONSTEXPR void store(muByte* b, T n) noexcept;
+					```
+
+					`T` can be any integer type, in which case `N` can be any width from 1 to `sizeof(T)`, and signed values narrower than `T` are sign-extended when loaded (for example, `mu::load<int32_m, mu::endian::big, 3>` is equivalent to `MU_RBES24`). `T` can also be `float` or `double`, in which case `N` must be `sizeof(T)`.
+
+					The function templates `mu::load_le`, `mu::load_be`, `mu::store_le`, and `mu::store_be` are shorthands for a given endianness, taking `T` and `N` as template parameters. For example:
+
+					```cpp
+					constexpr muByte header[] = { 'm', 'u', 0x01, 0x02 };
+					static_assert(mu::load_be<uint16_m>(&header[2]) == 0x0102, "");
+					```
+
+					@DOCEND */
+
+					template<typename T, endian E, size_m N = sizeof(T)>
+					MUU_CPP_CONSTEXPR typename std::enable_if<std::is_integral<T>::value, T>::type load(const muByte* b) noexcept {
+						static_assert(N >= 1 && N <= sizeof(T), "mu::load width must be between 1 and the size of the type");
+						return inner::extend<T, N>(inner::load<typename std::make_unsigned<T>::type, N, E>(b));
+					}
+
+					template<typename T, endian E, size_m N = sizeof(T)>
+					MUU_CPP_CONSTEXPR_FLOAT typename std::enable_if<std::is_floating_point<T>::value, T>::type load(const muByte* b) noexcept {
+						static_assert(N == sizeof(T), "mu::load width must be the size of a floating-point type");
+						return inner::from_bits<T>(inner::load<typename inner::uint_sized<sizeof(T)>::type, N, E>(b));
+					}
+
+					template<typename T, endian E, size_m N = sizeof(T)>
+					MUU_CPP_CONSTEXPR typename std::enable_if<std::is_integral<T>::value>::type store(muByte* b, T n) noexcept {
+						static_assert(N >= 1 && N <= sizeof(T), "mu::store width must be between 1 and the size of the type");
+						inner::store<typename std::make_unsigned<T>::type, N, E>(b, typename std::make_unsigned<T>::type(n));
+					}
+
+					template<typename T, endian E, size_m N = sizeof(T)>
+					MUU_CPP_CONSTEXPR_FLOAT typename std::enable_if<std::is_floating_point<T>::value>::type store(muByte* b, T n) noexcept {
+						static_assert(N == sizeof(T), "mu::store width must be the size of a floating-point type");
+						typedef typename inner::uint_sized<sizeof(T)>::type U;
+						inner::store<U, N, E>(b, inner::to_bits<U>(n));
+					}
+
+					template<typename T, size_m N = sizeof(T)> MUU_CPP_CONSTEXPR T load_le(const muByte* b) noexcept {
+						return load<T, endian::little, N>(b);
+					}
+
+					template<typename T, size_m N = sizeof(T)> MUU_CPP_CONSTEXPR T load_be(const muByte* b) noexcept {
+						return load<T, endian::big, N>(b);
+					}
+
+					template<typename T, size_m N = sizeof(T)> MUU_CPP_CONSTEXPR void store_le(muByte* b, T n) noexcept {
+						store<T, endian::little, N>(b, n);
+					}
+
+					template<typename T, size_m N = sizeof(T)> MUU_CPP_CONSTEXPR void store_be(muByte* b, T n) noexcept {
+						store<T, endian::big, N>(b, n);
+					}
+
+			}
+
+		#endif /* __cplusplus && MU_CPP_TEMPLATES */
 
 #endif /* MUU_H */
 